@@ -60,6 +60,7 @@ typedef enum statementType
 	Transaction,
 	AggregatePushdown,
 	CatCacheMisses,
+	SingleRowWriteReuses,
 	kMaxStatementType
 } statementType;
 int num_entries = kMaxStatementType;
@@ -98,6 +99,7 @@ static MemoryContext ybrpczMemoryContext = NULL;
 PgBackendStatus **backendStatusArrayPointer = NULL;
 
 static long last_cache_misses_val = 0;
+static uint64_t last_single_row_write_reuses_val = 0;
 
 void		_PG_init(void);
 /*
@@ -181,6 +183,8 @@ set_metric_names(void)
   strcpy(ybpgm_table[Transaction].name, YSQL_METRIC_PREFIX "Transactions");
   strcpy(ybpgm_table[AggregatePushdown].name, YSQL_METRIC_PREFIX "AggregatePushdowns");
   strcpy(ybpgm_table[CatCacheMisses].name, YSQL_METRIC_PREFIX "CatalogCacheMisses");
+  strcpy(ybpgm_table[SingleRowWriteReuses].name,
+         YSQL_METRIC_PREFIX "SingleRowWriteStatementReuses");
 }
 
 /*
@@ -588,6 +592,12 @@ ybpgm_ExecutorEnd(QueryDesc *queryDesc)
 	*/
 	ybpgm_StoreCount(CatCacheMisses, 0, current_cache_misses - last_cache_misses_val);
 	last_cache_misses_val = current_cache_misses;
+
+	/* Single row writes that reused the pggate statement of a previous write. */
+	uint64_t current_single_row_write_reuses = YBCPgGetSingleRowWriteReuseCount();
+	ybpgm_StoreCount(SingleRowWriteReuses, 0,
+	                 current_single_row_write_reuses - last_single_row_write_reuses_val);
+	last_single_row_write_reuses_val = current_single_row_write_reuses;
   }
 
   IncStatementNestingLevel();
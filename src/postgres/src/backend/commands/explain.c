@@ -1726,6 +1726,9 @@ ExplainNode(PlanState *planstate, List *ancestors,
 			if (plan->qual)
 				show_instrumentation_count("Rows Removed by Filter", 2,
 										   planstate, es);
+			if (((NestLoop *) plan)->yb_batch_size > 1)
+				ExplainPropertyInteger("Batch Size", NULL,
+									   ((NestLoop *) plan)->yb_batch_size, es);
 			break;
 		case T_MergeJoin:
 			show_upper_qual(((MergeJoin *) plan)->mergeclauses,
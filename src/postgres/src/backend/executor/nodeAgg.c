@@ -298,6 +298,9 @@ static int find_compatible_pertrans(AggState *aggstate, Aggref *newagg,
 						 List *transnos);
 static void yb_agg_pushdown_supported(AggState *aggstate);
 static void yb_agg_pushdown(AggState *aggstate);
+static void yb_agg_combine_results(AggState *aggstate,
+								   TupleTableSlot *outerslot,
+								   AggStatePerGroup pergroup);
 
 
 /*
@@ -1537,16 +1540,58 @@ yb_agg_pushdown_supported(AggState *aggstate)
 	/* Initially set pushdown supported to false. */
 	aggstate->yb_pushdown_supported = false;
 
-	/* Phase 0 is a dummy phase, so there should be two phases. */
-	if (aggstate->numphases != 2)
-		return;
+	check_outer_plan = false;
 
-	/* Plain agg strategy. */
-	if (aggstate->phase->aggstrategy != AGG_PLAIN)
-		return;
+	if (aggstate->phase->aggstrategy == AGG_PLAIN)
+	{
+		/* Phase 0 is a dummy phase, so there should be two phases. */
+		if (aggstate->numphases != 2)
+			return;
+
+		/* No GROUP BY. */
+		if (aggstate->phase->numsets != 0)
+			return;
+	}
+	else if (aggstate->phase->aggstrategy == AGG_HASHED)
+	{
+		AggStatePerHash perhash;
+		List	   *outerTlist = outerPlanState(aggstate)->plan->targetlist;
+		int			i;
+
+		/* Hashing is the only phase, and there are no grouping sets. */
+		if (aggstate->numphases != 1 || aggstate->num_hashes != 1)
+			return;
+
+		/* Groups are only counted, there is nothing to push down. */
+		if (aggstate->numaggs == 0)
+			return;
+
+		/*
+		 * Columns referenced outside of the aggregates are the grouping
+		 * columns, DocDB does not return any other column values.
+		 */
+		perhash = &aggstate->perhash[0];
+		if (perhash->numhashGrpCols != perhash->numCols)
+			return;
+
+		/* Grouping columns are the regular columns of the scanned table. */
+		for (i = 0; i < perhash->numCols; i++)
+		{
+			TargetEntry *tle = list_nth_node(TargetEntry, outerTlist,
+											 perhash->aggnode->grpColIdx[i] - 1);
+			Var		   *var;
 
-	/* No GROUP BY. */
-	if (aggstate->phase->numsets != 0)
+			if (!IsA(tle->expr, Var))
+				return;
+			var = castNode(Var, tle->expr);
+			if (var->varoattno <= 0 || !YbDataTypeIsValidForKey(var->vartype))
+				return;
+		}
+
+		/* Grouping columns are looked up in the outer plan targetlist. */
+		check_outer_plan = true;
+	}
+	else
 		return;
 
 	/* Foreign scan outer plan. */
@@ -1563,8 +1608,6 @@ yb_agg_pushdown_supported(AggState *aggstate)
 	if (scan_state->ss.ps.qual)
 		return;
 
-	check_outer_plan = false;
-
 	foreach(lc_agg, aggstate->aggs)
 	{
 		AggrefExprState *aggrefstate = (AggrefExprState *) lfirst(lc_agg);
@@ -1703,6 +1746,10 @@ yb_agg_pushdown(AggState *aggstate)
 	List *pushdown_aggs = NIL;
 	int aggno;
 
+	/* Hashed aggregation calls this for every group it returns. */
+	if (scan_state->yb_fdw_aggs != NIL)
+		return;
+
 	for (aggno = 0; aggno < aggstate->numaggs; aggno++)
 	{
 		Aggref *aggref = aggstate->peragg[aggno].aggref;
@@ -1712,6 +1759,81 @@ yb_agg_pushdown(AggState *aggstate)
 	scan_state->yb_fdw_aggs = pushdown_aggs;
 	/* Disable projection for tuples produced by pushed down aggregate operators. */
 	scan_state->ss.ps.ps_ProjInfo = NULL;
+
+	if (aggstate->phase->aggstrategy == AGG_HASHED)
+	{
+		AggStatePerHash perhash = &aggstate->perhash[0];
+		List *outerTlist = outerPlanState(aggstate)->plan->targetlist;
+		Bitmapset *group_attnos = NULL;
+		int i;
+
+		/*
+		 * Without projection, the scan returns grouping columns at their
+		 * original attribute numbers, so take the grouping column values from
+		 * there rather than from the outer plan targetlist positions.
+		 */
+		perhash->largestGrpColIdx = 0;
+		for (i = 0; i < perhash->numCols; i++)
+		{
+			TargetEntry *tle = list_nth_node(TargetEntry, outerTlist,
+											 perhash->aggnode->grpColIdx[i] - 1);
+			AttrNumber attno = castNode(Var, tle->expr)->varoattno;
+
+			perhash->hashGrpColIdxInput[i] = attno;
+			perhash->largestGrpColIdx = Max(attno, perhash->largestGrpColIdx);
+			group_attnos = bms_add_member(group_attnos, attno);
+		}
+		scan_state->yb_fdw_group_attnos = group_attnos;
+	}
+}
+
+/*
+ * Combines one row of partial aggregate results returned by the pushed down
+ * scan into the given per-group states. Aggregate results are the last
+ * numaggs values of the slot, they could be preceded by the grouping columns.
+ */
+static void
+yb_agg_combine_results(AggState *aggstate, TupleTableSlot *outerslot,
+					   AggStatePerGroup pergroup)
+{
+	AggStatePerAgg peragg = aggstate->peragg;
+	int			offset = outerslot->tts_nvalid - aggstate->numaggs;
+	int			aggno;
+
+	Assert(offset >= 0);
+
+	for (aggno = 0; aggno < aggstate->numaggs; aggno++)
+	{
+		MemoryContext oldContext;
+		int transno = peragg[aggno].transno;
+		Aggref *aggref = peragg[aggno].aggref;
+		char *func_name = get_func_name(aggref->aggfnoid);
+		AggStatePerGroup pergroupstate = &pergroup[transno];
+		AggStatePerTrans pertrans = &aggstate->pertrans[transno];
+		FunctionCallInfo fcinfo = &pertrans->transfn_fcinfo;
+		Datum value = outerslot->tts_values[offset + aggno];
+		bool isnull = outerslot->tts_isnull[offset + aggno];
+
+		if (strcmp(func_name, "count") == 0)
+		{
+			/*
+			 * Sum results from each response for COUNT. It is safe to do this
+			 * directly on the datum as it is guaranteed to be an int64.
+			 */
+			oldContext = MemoryContextSwitchTo(
+				aggstate->curaggcontext->ecxt_per_tuple_memory);
+			pergroupstate->transValue += value;
+			MemoryContextSwitchTo(oldContext);
+		}
+		else
+		{
+			/* Set slot result as argument, then advance the transition function. */
+			fcinfo->arg[1] = value;
+			fcinfo->argnull[1] = isnull;
+			advance_transition_function(aggstate, pertrans, pergroupstate);
+		}
+		pfree(func_name);
+	}
 }
 
 /*
@@ -1794,7 +1916,6 @@ agg_retrieve_direct(AggState *aggstate)
 	int			nextSetSize;
 	int			numReset;
 	int			i;
-	int			aggno;
 
 	/*
 	 * get state info from node
@@ -1962,38 +2083,7 @@ agg_retrieve_direct(AggState *aggstate)
 
 				Assert(aggstate->numaggs == outerslot->tts_nvalid);
 
-				for (aggno = 0; aggno < aggstate->numaggs; aggno++)
-				{
-					MemoryContext oldContext;
-					int transno = peragg[aggno].transno;
-					Aggref *aggref = aggstate->peragg[aggno].aggref;
-					char *func_name = get_func_name(aggref->aggfnoid);
-					AggStatePerGroup pergroup = pergroups[currentSet];
-					AggStatePerGroup pergroupstate = &pergroup[transno];
-					AggStatePerTrans pertrans = &aggstate->pertrans[transno];
-					FunctionCallInfo fcinfo = &pertrans->transfn_fcinfo;
-					Datum value = outerslot->tts_values[aggno];
-					bool isnull = outerslot->tts_isnull[aggno];
-
-					if (strcmp(func_name, "count") == 0)
-					{
-						/*
-						 * Sum results from each response for COUNT. It is safe to do this
-						 * directly on the datum as it is guaranteed to be an int64.
-						 */
-						oldContext = MemoryContextSwitchTo(
-							aggstate->curaggcontext->ecxt_per_tuple_memory);
-						pergroupstate->transValue += value;
-						MemoryContextSwitchTo(oldContext);
-					}
-					else
-					{
-						/* Set slot result as argument, then advance the transition function. */
-						fcinfo->arg[1] = value;
-						fcinfo->argnull[1] = isnull;
-						advance_transition_function(aggstate, pertrans, pergroupstate);
-					}
-				}
+				yb_agg_combine_results(aggstate, outerslot, pergroups[currentSet]);
 
 				/* Reset per-input-tuple context after each tuple */
 				ResetExprContext(tmpcontext);
@@ -2206,8 +2296,17 @@ agg_fill_hash_table(AggState *aggstate)
 		/* Find or build hashtable entries */
 		lookup_hash_entries(aggstate);
 
-		/* Advance the aggregates (or combine functions) */
-		advance_aggregates(aggstate);
+		/*
+		 * Advance the aggregates (or combine functions). If aggregates were
+		 * pushed down to YB, the tuple carries partial results of a group
+		 * computed by DocDB, and the same group can be returned by several
+		 * responses, so merge them into the group's transition values.
+		 */
+		if (aggstate->yb_pushdown_supported)
+			yb_agg_combine_results(aggstate, outerslot,
+								   aggstate->hash_pergroup[0]);
+		else
+			advance_aggregates(aggstate);
 
 		/*
 		 * Reset per-input-tuple context after each tuple, but note that the
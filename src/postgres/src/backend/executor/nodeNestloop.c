@@ -24,9 +24,141 @@
 #include "executor/execdebug.h"
 #include "executor/nodeNestloop.h"
 #include "miscadmin.h"
+#include "utils/array.h"
+#include "utils/datum.h"
+#include "utils/lsyscache.h"
 #include "utils/memutils.h"
 
 
+/* ----------------------------------------------------------------
+ *		YbFillBatch
+ *
+ *		Reads the next batch of outer tuples of the batched nested loop,
+ *		and scans the inner plan once for all of them.
+ *
+ *		The single nestloop param is set to the array of outer values of
+ *		the batch, so inner plan returns tuples matching any outer tuple of
+ *		the batch.  Those are matched with the outer tuples by the join
+ *		quals.  Returns false when there are no more outer tuples.
+ * ----------------------------------------------------------------
+ */
+static bool
+YbFillBatch(NestLoopState *node)
+{
+	NestLoop   *nl = (NestLoop *) node->js.ps.plan;
+	NestLoopParam *nlp = linitial_node(NestLoopParam, nl->nestParams);
+	PlanState  *outerPlan = outerPlanState(node);
+	PlanState  *innerPlan = innerPlanState(node);
+	ExprContext *econtext = node->js.ps.ps_ExprContext;
+	MemoryContext oldcontext;
+	Datum	   *values;
+	int			nvalues = 0;
+	int			ntuples = 0;
+
+	ExecClearTuple(node->yb_OuterBatchSlot);
+	ExecClearTuple(node->yb_InnerBatchSlot);
+	tuplestore_clear(node->yb_OuterBatch);
+	tuplestore_clear(node->yb_InnerBatch);
+	if (node->yb_OuterDone)
+		return false;
+
+	MemoryContextReset(node->yb_BatchContext);
+	values = (Datum *) MemoryContextAlloc(node->yb_BatchContext,
+										  nl->yb_batch_size * sizeof(Datum));
+
+	while (ntuples < nl->yb_batch_size)
+	{
+		TupleTableSlot *outerTupleSlot = ExecProcNode(outerPlan);
+		Datum		value;
+		bool		isnull;
+
+		if (TupIsNull(outerTupleSlot))
+		{
+			node->yb_OuterDone = true;
+			break;
+		}
+		tuplestore_puttupleslot(node->yb_OuterBatch, outerTupleSlot);
+		++ntuples;
+
+		/* Null never matches, since index quals are strict */
+		value = slot_getattr(outerTupleSlot, nlp->paramval->varattno, &isnull);
+		if (!isnull)
+		{
+			oldcontext = MemoryContextSwitchTo(node->yb_BatchContext);
+			values[nvalues++] = datumCopy(value, node->yb_ParamTypByVal,
+										  node->yb_ParamTypLen);
+			MemoryContextSwitchTo(oldcontext);
+		}
+	}
+
+	if (ntuples == 0)
+		return false;
+
+	if (nvalues > 0)
+	{
+		ParamExecData *prm = &(econtext->ecxt_param_exec_vals[nlp->paramno]);
+
+		oldcontext = MemoryContextSwitchTo(node->yb_BatchContext);
+		prm->value = PointerGetDatum(construct_array(values, nvalues,
+													 nlp->paramval->vartype,
+													 node->yb_ParamTypLen,
+													 node->yb_ParamTypByVal,
+													 node->yb_ParamTypAlign));
+		prm->isnull = false;
+		MemoryContextSwitchTo(oldcontext);
+
+		/* Flag parameter value as changed, and collect inner tuples */
+		innerPlan->chgParam = bms_add_member(innerPlan->chgParam,
+											 nlp->paramno);
+		ExecReScan(innerPlan);
+		for (;;)
+		{
+			TupleTableSlot *innerTupleSlot = ExecProcNode(innerPlan);
+
+			if (TupIsNull(innerTupleSlot))
+				break;
+			tuplestore_puttupleslot(node->yb_InnerBatch, innerTupleSlot);
+		}
+	}
+
+	return true;
+}
+
+/* ----------------------------------------------------------------
+ *		YbGetNextOuter
+ *
+ *		Returns the next outer tuple of the batched nested loop, reading
+ *		the next batch when the current one is exhausted.
+ * ----------------------------------------------------------------
+ */
+static TupleTableSlot *
+YbGetNextOuter(NestLoopState *node)
+{
+	while (!tuplestore_gettupleslot(node->yb_OuterBatch, true, false,
+									node->yb_OuterBatchSlot))
+	{
+		if (!YbFillBatch(node))
+			return NULL;
+	}
+	return node->yb_OuterBatchSlot;
+}
+
+/* ----------------------------------------------------------------
+ *		YbGetNextInner
+ *
+ *		Returns the next inner tuple of the current batch.
+ * ----------------------------------------------------------------
+ */
+static TupleTableSlot *
+YbGetNextInner(NestLoopState *node)
+{
+	if (tuplestore_gettupleslot(node->yb_InnerBatch, true, false,
+								node->yb_InnerBatchSlot))
+		return node->yb_InnerBatchSlot;
+	return NULL;
+}
+
+
 /* ----------------------------------------------------------------
  *		ExecNestLoop(node)
  *
@@ -106,7 +238,10 @@ ExecNestLoop(PlanState *pstate)
 		if (node->nl_NeedNewOuter)
 		{
 			ENL1_printf("getting new outer tuple");
-			outerTupleSlot = ExecProcNode(outerPlan);
+			if (nl->yb_batch_size > 1)
+				outerTupleSlot = YbGetNextOuter(node);
+			else
+				outerTupleSlot = ExecProcNode(outerPlan);
 
 			/*
 			 * if there are no more outer tuples, then the join is complete..
@@ -122,34 +257,46 @@ ExecNestLoop(PlanState *pstate)
 			node->nl_NeedNewOuter = false;
 			node->nl_MatchedOuter = false;
 
-			/*
-			 * fetch the values of any outer Vars that must be passed to the
-			 * inner scan, and store them in the appropriate PARAM_EXEC slots.
-			 */
-			foreach(lc, nl->nestParams)
+			if (nl->yb_batch_size > 1)
 			{
-				NestLoopParam *nlp = (NestLoopParam *) lfirst(lc);
-				int			paramno = nlp->paramno;
-				ParamExecData *prm;
-
-				prm = &(econtext->ecxt_param_exec_vals[paramno]);
-				/* Param value should be an OUTER_VAR var */
-				Assert(IsA(nlp->paramval, Var));
-				Assert(nlp->paramval->varno == OUTER_VAR);
-				Assert(nlp->paramval->varattno > 0);
-				prm->value = slot_getattr(outerTupleSlot,
-										  nlp->paramval->varattno,
-										  &(prm->isnull));
-				/* Flag parameter value as changed */
-				innerPlan->chgParam = bms_add_member(innerPlan->chgParam,
-													 paramno);
+				/*
+				 * inner tuples of the batch were already fetched, just match
+				 * them with this outer tuple.
+				 */
+				tuplestore_rescan(node->yb_InnerBatch);
 			}
+			else
+			{
+				/*
+				 * fetch the values of any outer Vars that must be passed to
+				 * the inner scan, and store them in the appropriate PARAM_EXEC
+				 * slots.
+				 */
+				foreach(lc, nl->nestParams)
+				{
+					NestLoopParam *nlp = (NestLoopParam *) lfirst(lc);
+					int			paramno = nlp->paramno;
+					ParamExecData *prm;
+
+					prm = &(econtext->ecxt_param_exec_vals[paramno]);
+					/* Param value should be an OUTER_VAR var */
+					Assert(IsA(nlp->paramval, Var));
+					Assert(nlp->paramval->varno == OUTER_VAR);
+					Assert(nlp->paramval->varattno > 0);
+					prm->value = slot_getattr(outerTupleSlot,
+											  nlp->paramval->varattno,
+											  &(prm->isnull));
+					/* Flag parameter value as changed */
+					innerPlan->chgParam = bms_add_member(innerPlan->chgParam,
+														 paramno);
+				}
 
-			/*
-			 * now rescan the inner plan
-			 */
-			ENL1_printf("rescanning inner plan");
-			ExecReScan(innerPlan);
+				/*
+				 * now rescan the inner plan
+				 */
+				ENL1_printf("rescanning inner plan");
+				ExecReScan(innerPlan);
+			}
 		}
 
 		/*
@@ -157,7 +304,10 @@ ExecNestLoop(PlanState *pstate)
 		 */
 		ENL1_printf("getting new inner tuple");
 
-		innerTupleSlot = ExecProcNode(innerPlan);
+		if (nl->yb_batch_size > 1)
+			innerTupleSlot = YbGetNextInner(node);
+		else
+			innerTupleSlot = ExecProcNode(innerPlan);
 		econtext->ecxt_innertuple = innerTupleSlot;
 
 		if (TupIsNull(innerTupleSlot))
@@ -301,6 +451,32 @@ ExecInitNestLoop(NestLoop *node, EState *estate, int eflags)
 		eflags &= ~EXEC_FLAG_REWIND;
 	innerPlanState(nlstate) = ExecInitNode(innerPlan(node), estate, eflags);
 
+	/*
+	 * batched nested loop keeps the tuples of the batch, and the array of
+	 * their values passed to the inner scan.
+	 */
+	if (node->yb_batch_size > 1)
+	{
+		NestLoopParam *nlp = linitial_node(NestLoopParam, node->nestParams);
+
+		nlstate->yb_OuterBatch = tuplestore_begin_heap(false, false, work_mem);
+		nlstate->yb_InnerBatch = tuplestore_begin_heap(false, false, work_mem);
+		nlstate->yb_OuterBatchSlot =
+			ExecInitExtraTupleSlot(estate,
+								   ExecGetResultType(outerPlanState(nlstate)));
+		nlstate->yb_InnerBatchSlot =
+			ExecInitExtraTupleSlot(estate,
+								   ExecGetResultType(innerPlanState(nlstate)));
+		nlstate->yb_OuterDone = false;
+		nlstate->yb_BatchContext = AllocSetContextCreate(CurrentMemoryContext,
+														 "NestLoop batch",
+														 ALLOCSET_DEFAULT_SIZES);
+		get_typlenbyvalalign(nlp->paramval->vartype,
+							 &nlstate->yb_ParamTypLen,
+							 &nlstate->yb_ParamTypByVal,
+							 &nlstate->yb_ParamTypAlign);
+	}
+
 	/*
 	 * Initialize result slot, type and projection.
 	 */
@@ -379,6 +555,11 @@ ExecEndNestLoop(NestLoopState *node)
 	ExecEndNode(outerPlanState(node));
 	ExecEndNode(innerPlanState(node));
 
+	if (node->yb_OuterBatch)
+		tuplestore_end(node->yb_OuterBatch);
+	if (node->yb_InnerBatch)
+		tuplestore_end(node->yb_InnerBatch);
+
 	NL1_printf("ExecEndNestLoop: %s\n",
 			   "node processing ended");
 }
@@ -405,6 +586,16 @@ ExecReScanNestLoop(NestLoopState *node)
 	 * outer Vars are used as run-time keys...
 	 */
 
+	/* Drop the current batch, the next one is read from the start */
+	if (((NestLoop *) node->js.ps.plan)->yb_batch_size > 1)
+	{
+		ExecClearTuple(node->yb_OuterBatchSlot);
+		ExecClearTuple(node->yb_InnerBatchSlot);
+		tuplestore_clear(node->yb_OuterBatch);
+		tuplestore_clear(node->yb_InnerBatch);
+		node->yb_OuterDone = false;
+	}
+
 	node->nl_NeedNewOuter = true;
 	node->nl_MatchedOuter = false;
 }
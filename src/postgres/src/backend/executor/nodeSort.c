@@ -16,11 +16,122 @@
 #include "postgres.h"
 
 #include "access/parallel.h"
+#include "access/stratnum.h"
+#include "catalog/pg_am.h"
+#include "catalog/pg_type.h"
+#include "commands/defrem.h"
 #include "executor/execdebug.h"
 #include "executor/nodeSort.h"
 #include "miscadmin.h"
+#include "utils/lsyscache.h"
+#include "utils/rel.h"
 #include "utils/tuplesort.h"
 
+#include "pg_yb_utils.h"
+
+
+/*
+ * Whether DocDB compares values of the type the same way as the default
+ * btree operator class of the type does.
+ */
+static bool
+yb_sort_pushdown_type_supported(Oid type, Oid collation)
+{
+	switch (type)
+	{
+		case BOOLOID:
+		case INT2OID:
+		case INT4OID:
+		case INT8OID:
+		case OIDOID:
+		case FLOAT4OID:
+		case FLOAT8OID:
+		case DATEOID:
+		case TIMEOID:
+		case TIMESTAMPOID:
+		case TIMESTAMPTZOID:
+			return true;
+		case TEXTOID:
+		case VARCHAROID:
+			/* DocDB compares strings byte-wise, as C collation does. */
+			return !YBIsCollationValidNonC(collation);
+		default:
+			return false;
+	}
+}
+
+/*
+ * Pushes the sort keys and the bound of a bounded sort down to the YB foreign
+ * scan below it, so every tablet returns only its first rows in the sort
+ * order. Sort still sorts and bounds the rows returned by all tablets.
+ */
+static void
+yb_sort_pushdown(SortState *node)
+{
+	Sort	   *plannode = (Sort *) node->ss.ps.plan;
+	ForeignScanState *scan_state;
+	Relation	relation;
+	List	   *outerTlist;
+	List	   *sort_keys = NIL;
+	int			i;
+
+	if (!IsA(outerPlanState(node), ForeignScanState))
+		return;
+
+	scan_state = castNode(ForeignScanState, outerPlanState(node));
+	scan_state->yb_fdw_sort_keys = NIL;
+	scan_state->yb_fdw_sort_limit = 0;
+
+	if (!node->bounded)
+		return;
+
+	relation = scan_state->ss.ss_currentRelation;
+	if (relation == NULL || !IsYBRelation(relation))
+		return;
+
+	/* Rows filtered out by Postgres could not be skipped by DocDB. */
+	if (scan_state->ss.ps.qual || scan_state->yb_fdw_aggs != NIL)
+		return;
+
+	outerTlist = outerPlanState(node)->plan->targetlist;
+	for (i = 0; i < plannode->numCols; i++)
+	{
+		TargetEntry *tle = list_nth_node(TargetEntry, outerTlist,
+										 plannode->sortColIdx[i] - 1);
+		Var		   *var;
+		Oid			opfamily;
+		Oid			opcintype;
+		int16		strategy;
+		SortBy	   *sortby;
+
+		if (!IsA(tle->expr, Var))
+			return;
+		var = castNode(Var, tle->expr);
+		if (var->varoattno <= 0 ||
+			!yb_sort_pushdown_type_supported(var->vartype, plannode->collations[i]))
+			return;
+
+		/* Only the default ordering of the type is supported. */
+		if (!get_ordering_op_properties(plannode->sortOperators[i],
+										&opfamily, &opcintype, &strategy) ||
+			opfamily != get_opclass_family(GetDefaultOpClass(var->vartype,
+															 BTREE_AM_OID)))
+			return;
+
+		sortby = makeNode(SortBy);
+		sortby->node = (Node *) var;
+		sortby->sortby_dir =
+			strategy == BTGreaterStrategyNumber ? SORTBY_DESC : SORTBY_ASC;
+		sortby->sortby_nulls =
+			plannode->nullsFirst[i] ? SORTBY_NULLS_FIRST : SORTBY_NULLS_LAST;
+		sortby->location = -1;
+		sort_keys = lappend(sort_keys, sortby);
+	}
+
+	scan_state->yb_fdw_sort_keys = sort_keys;
+	scan_state->yb_fdw_sort_limit = node->bound;
+}
+
 
 /* ----------------------------------------------------------------
  *		ExecSort
@@ -84,6 +195,7 @@ ExecSort(PlanState *pstate)
 		 */
 		if (IsYugaByteEnabled()) {
 			estate->yb_exec_params.limit_use_default = true;
+			yb_sort_pushdown(node);
 		}
 
 		/*
@@ -218,6 +218,11 @@ static Oid YBCExecuteInsertInternal(Oid dboid,
 	Bitmapset      *pkey    = YBGetTablePrimaryKeyBms(rel);
 	YBCPgStatement insert_stmt = NULL;
 	bool           is_null  = false;
+	/*
+	 * Single row transactions reuse the INSERT statement that pggate keeps
+	 * for the relation, instead of allocating and preparing a new one per row.
+	 */
+	bool           reuse_stmt = is_single_row_txn && !IsCatalogRelation(rel);
 
 	/* Generate a new oid for this row if needed */
 	if (rel->rd_rel->relhasoids)
@@ -227,10 +232,15 @@ static Oid YBCExecuteInsertInternal(Oid dboid,
 	}
 
 	/* Create the INSERT request and add the values from the tuple. */
-	HandleYBStatus(YBCPgNewInsert(dboid,
-	                              YbGetStorageRelid(rel),
-	                              is_single_row_txn,
-	                              &insert_stmt));
+	if (reuse_stmt)
+		HandleYBStatus(YBCPgNewSingleRowInsert(dboid,
+		                                       YbGetStorageRelid(rel),
+		                                       &insert_stmt));
+	else
+		HandleYBStatus(YBCPgNewInsert(dboid,
+		                              YbGetStorageRelid(rel),
+		                              is_single_row_txn,
+		                              &insert_stmt));
 
 	/* Get the ybctid for the tuple and bind to statement */
 	tuple->t_ybctid = YBCGetYBTupleIdFromTuple(rel, tuple, tupleDesc);
@@ -289,8 +299,9 @@ static Oid YBCExecuteInsertInternal(Oid dboid,
 		CacheInvalidateHeapTuple(rel, tuple, NULL);
 	}
 
-	/* Execute the insert */
-	YBCExecWriteStmt(insert_stmt, rel, NULL /* rows_affected_count */, true /* cleanup */);
+	/* Execute the insert. Reused statement is owned by pggate. */
+	YBCExecWriteStmt(insert_stmt, rel, NULL /* rows_affected_count */,
+	                 !reuse_stmt /* cleanup */);
 
 	/* Add row into foreign key cache */
 	if (!is_single_row_txn)
@@ -711,11 +722,19 @@ bool YBCExecuteUpdate(Relation rel,
 	bool           isSingleRow    = mtstate->yb_mt_is_single_row_update_or_delete;
 	Datum          ybctid         = 0;
 
-	/* Create update statement. */
-	HandleYBStatus(YBCPgNewUpdate(dboid,
-								  relid,
-								  estate->es_yb_is_single_row_modify_txn,
-								  &update_stmt));
+	/*
+	 * Create update statement. Single row transactions updating a row by its
+	 * primary key reuse the UPDATE statement that pggate keeps for the
+	 * relation.
+	 */
+	bool reuse_stmt = isSingleRow && estate->es_yb_is_single_row_modify_txn;
+	if (reuse_stmt)
+		HandleYBStatus(YBCPgNewSingleRowUpdate(dboid, relid, &update_stmt));
+	else
+		HandleYBStatus(YBCPgNewUpdate(dboid,
+									  relid,
+									  estate->es_yb_is_single_row_modify_txn,
+									  &update_stmt));
 
 	/*
 	 * Look for ybctid. Raise error if ybctid is not found.
@@ -859,8 +878,9 @@ bool YBCExecuteUpdate(Relation rel,
 		slot->tts_tupleDescriptor = CreateTupleDescCopyConstr(tupleDesc);
 	}
 
-	/* Cleanup. */
-	YBCPgDeleteStatement(update_stmt);
+	/* Cleanup. Reused statement is owned by pggate. */
+	if (!reuse_stmt)
+		YBCPgDeleteStatement(update_stmt);
 	update_stmt = NULL;
 
 	/*
@@ -394,9 +394,58 @@ ybcSetupScanTargets(ForeignScanState *node)
 				break;
 			}
 		}
+
+		/*
+		 * Set the sort keys of the bounded sort above, so every tablet returns
+		 * only its first rows in the sort order.
+		 */
+		foreach(lc, node->yb_fdw_sort_keys)
+		{
+			SortBy *sortby = lfirst_node(SortBy, lc);
+			int attno = castNode(Var, sortby->node)->varoattno;
+			Form_pg_attribute attr = TupleDescAttr(tupdesc, attno - 1);
+			YBCPgTypeAttrs type_attrs = {attr->atttypmod};
+			YBCPgExpr expr = YBCNewColumnRef(ybc_state->handle,
+											 attno,
+											 attr->atttypid,
+											 attr->attcollation,
+											 &type_attrs);
+
+			HandleYBStatus(YBCPgDmlAppendOrderBy(ybc_state->handle,
+												 expr,
+												 sortby->sortby_dir == SORTBY_DESC,
+												 sortby->sortby_nulls == SORTBY_NULLS_FIRST));
+		}
+		if (node->yb_fdw_sort_keys != NIL)
+			HandleYBStatus(YBCPgDmlSetOrderByLimit(ybc_state->handle,
+												   node->yb_fdw_sort_limit));
 	}
 	else
 	{
+		int group_attno = -1;
+		int natts = 0;
+
+		/*
+		 * Set grouping column targets. DocDB returns them at their attribute
+		 * numbers, followed by the aggregate results, so the columns are
+		 * appended in ascending order and the last one determines where the
+		 * aggregate results start.
+		 */
+		while ((group_attno = bms_next_member(node->yb_fdw_group_attnos, group_attno)) >= 0)
+		{
+			Form_pg_attribute attr = TupleDescAttr(tupdesc, group_attno - 1);
+			YBCPgTypeAttrs type_attrs = {attr->atttypmod};
+			YBCPgExpr expr = YBCNewColumnRef(ybc_state->handle,
+											 group_attno,
+											 attr->atttypid,
+											 attr->attcollation,
+											 &type_attrs);
+
+			HandleYBStatus(YBCPgDmlAppendTarget(ybc_state->handle, expr));
+			HandleYBStatus(YBCPgDmlAppendGroupBy(ybc_state->handle, expr));
+			natts = group_attno;
+		}
+
 		/* Set aggregate scan targets. */
 		foreach(lc, node->yb_fdw_aggs)
 		{
@@ -485,8 +534,8 @@ ybcSetupScanTargets(ForeignScanState *node)
 		 * tupledesc that only includes the number of attributes. Switch to per-query memory from
 		 * per-tuple memory so the slot persists across iterations.
 		 */
-		TupleDesc target_tupdesc = CreateTemplateTupleDesc(list_length(node->yb_fdw_aggs),
-														   false /* hasoid */);
+		natts += list_length(node->yb_fdw_aggs);
+		TupleDesc target_tupdesc = CreateTemplateTupleDesc(natts, false /* hasoid */);
 		ExecInitScanTupleSlot(estate, &node->ss, target_tupdesc);
 	}
 	MemoryContextSwitchTo(oldcontext);
@@ -552,8 +601,8 @@ ybcIterateForeignScan(ForeignScanState *node)
 		else
 		{
 			/*
-			 * Aggregate results stored in virtual slot (no tuple). Set the
-			 * number of valid values and mark as non-empty.
+			 * Aggregate results (and grouping columns) stored in virtual slot
+			 * (no tuple). Set the number of valid values and mark as non-empty.
 			 */
 			slot->tts_nvalid = tupdesc->natts;
 			slot->tts_isempty = false;
@@ -850,6 +850,7 @@ _copyNestLoop(const NestLoop *from)
 	 * copy remainder of node
 	 */
 	COPY_NODE_FIELD(nestParams);
+	COPY_SCALAR_FIELD(yb_batch_size);
 
 	return newnode;
 }
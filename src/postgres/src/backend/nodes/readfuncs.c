@@ -2039,6 +2039,7 @@ _readNestLoop(void)
 	ReadCommonJoin(&local_node->join);
 
 	READ_NODE_FIELD(nestParams);
+	READ_INT_FIELD(yb_batch_size);
 
 	READ_DONE();
 }
@@ -161,6 +161,8 @@ static CustomScan *create_customscan_plan(PlannerInfo *root,
 					   CustomPath *best_path,
 					   List *tlist, List *scan_clauses);
 static NestLoop *create_nestloop_plan(PlannerInfo *root, NestPath *best_path);
+static void yb_batch_nestloop(PlannerInfo *root, NestPath *best_path,
+				  NestLoop *join_plan);
 static MergeJoin *create_mergejoin_plan(PlannerInfo *root, MergePath *best_path);
 static HashJoin *create_hashjoin_plan(PlannerInfo *root, HashPath *best_path);
 static Node *replace_nestloop_params(PlannerInfo *root, Node *expr);
@@ -4415,9 +4417,184 @@ create_nestloop_plan(PlannerInfo *root,
 
 	copy_generic_path_info(&join_plan->join.plan, &best_path->path);
 
+	if (IsYugaByteEnabled())
+		yb_batch_nestloop(root, best_path, join_plan);
+
 	return join_plan;
 }
 
+/*
+ * Does the expression reference PARAM_EXEC param with the given id?
+ */
+static bool
+yb_references_param_walker(Node *node, int *paramid)
+{
+	if (node == NULL)
+		return false;
+	if (IsA(node, Param))
+	{
+		Param	   *param = (Param *) node;
+
+		return param->paramkind == PARAM_EXEC && param->paramid == *paramid;
+	}
+	return expression_tree_walker(node, yb_references_param_walker,
+								  (void *) paramid);
+}
+
+/*
+ * If the clause is "expr op $paramid" or "$paramid op expr", returns expr.
+ */
+static Node *
+yb_get_param_opclause_operand(Node *clause, int paramid)
+{
+	OpExpr	   *op;
+	int			i;
+
+	if (!IsA(clause, OpExpr))
+		return NULL;
+	op = (OpExpr *) clause;
+	if (list_length(op->args) != 2)
+		return NULL;
+	for (i = 0; i != 2; ++i)
+	{
+		Node	   *arg = (Node *) list_nth(op->args, i);
+
+		if (IsA(arg, Param) &&
+			((Param *) arg)->paramkind == PARAM_EXEC &&
+			((Param *) arg)->paramid == paramid)
+			return (Node *) list_nth(op->args, 1 - i);
+	}
+	return NULL;
+}
+
+/*
+ * Build "key op ANY($batch)" using operator of the index qual "indexkey op $param".
+ */
+static Expr *
+yb_make_batched_opclause(OpExpr *qual, Node *key, Param *batch_param)
+{
+	ScalarArrayOpExpr *saop = makeNode(ScalarArrayOpExpr);
+
+	saop->opno = qual->opno;
+	saop->opfuncid = qual->opfuncid;
+	saop->useOr = true;
+	saop->inputcollid = qual->inputcollid;
+	saop->args = list_make2(copyObject(key), batch_param);
+	saop->location = qual->location;
+	return (Expr *) saop;
+}
+
+/*
+ * yb_batch_nestloop
+ *	  Make the nestloop batched, if its inner side is an index scan of YB
+ *	  relation, that uses the only nestloop param in "indexkey = $param" qual.
+ *
+ * That qual is replaced by "indexkey = ANY($batch)", where $batch is the array
+ * of outer values of the whole batch of outer rows, so the inner relation is
+ * scanned once per batch using the IN list support of the YB scan.  The
+ * original qual, with $param replaced by the outer value, is added to join
+ * quals, to match the inner rows with the outer rows of the batch.
+ */
+static void
+yb_batch_nestloop(PlannerInfo *root, NestPath *best_path, NestLoop *join_plan)
+{
+	int			batch_size = YbGetNestLoopBatchSize(root, best_path);
+	IndexOptInfo *indexinfo;
+	IndexScan  *inner_plan;
+	NestLoopParam *nlp;
+	ListCell   *lc;
+	ListCell   *lco;
+	int			qual_pos = -1;
+	int			pos = 0;
+	OpExpr	   *qual;
+	Node	   *key;
+	Var		   *indexkey;
+	Param	   *param;
+	Param	   *batch_param;
+	Oid			array_type;
+
+	if (batch_size <= 1 || list_length(join_plan->nestParams) != 1 ||
+		!IsA(innerPlan(join_plan), IndexScan))
+		return;
+
+	nlp = linitial_node(NestLoopParam, join_plan->nestParams);
+	if (!IsA(nlp->paramval, Var))
+		return;
+
+	indexinfo = ((IndexPath *) best_path->innerjoinpath)->indexinfo;
+	inner_plan = (IndexScan *) innerPlan(join_plan);
+	if (list_length(inner_plan->indexqual) !=
+		list_length(inner_plan->indexqualorig))
+		return;
+
+	/* The param should be used by the single index qual only */
+	if (yb_references_param_walker((Node *) inner_plan->scan.plan.targetlist,
+								   &nlp->paramno) ||
+		yb_references_param_walker((Node *) inner_plan->scan.plan.qual,
+								   &nlp->paramno) ||
+		yb_references_param_walker((Node *) inner_plan->indexorderbyorig,
+								   &nlp->paramno))
+		return;
+	forboth(lc, inner_plan->indexqual, lco, inner_plan->indexqualorig)
+	{
+		if (yb_references_param_walker(lfirst(lco), &nlp->paramno))
+		{
+			if (qual_pos >= 0 ||
+				!yb_get_param_opclause_operand(lfirst(lc), nlp->paramno) ||
+				!yb_get_param_opclause_operand(lfirst(lco), nlp->paramno))
+				return;
+			qual_pos = pos;
+		}
+		++pos;
+	}
+	if (qual_pos < 0)
+		return;
+
+	/* Index quals are commuted to have index key on the left */
+	qual = (OpExpr *) list_nth(inner_plan->indexqual, qual_pos);
+	key = yb_get_param_opclause_operand(list_nth(inner_plan->indexqualorig,
+												 qual_pos),
+										nlp->paramno);
+
+	/* Only equality is worth batching, other quals would not be pushed down */
+	if (!IsA(linitial(qual->args), Var) ||
+		!IsA(lsecond(qual->args), Param))
+		return;
+	indexkey = (Var *) linitial(qual->args);
+	if (get_op_opfamily_strategy(qual->opno,
+								 indexinfo->opfamily[indexkey->varattno - 1]) !=
+		BTEqualStrategyNumber)
+		return;
+
+	/* The join clause is evaluated on the inner scan output */
+	foreach(lc, pull_var_clause(key, 0))
+	{
+		if (!tlist_member(lfirst(lc), inner_plan->scan.plan.targetlist))
+			return;
+	}
+
+	param = (Param *) lsecond(qual->args);
+	array_type = get_array_type(param->paramtype);
+	if (!OidIsValid(array_type))
+		return;
+	batch_param = generate_new_exec_param(root, array_type, -1,
+										  param->paramcollid);
+
+	lfirst(list_nth_cell(inner_plan->indexqual, qual_pos)) =
+		yb_make_batched_opclause(qual, (Node *) indexkey, batch_param);
+	lfirst(list_nth_cell(inner_plan->indexqualorig, qual_pos)) =
+		yb_make_batched_opclause(qual, key, batch_param);
+
+	join_plan->join.joinqual =
+		lappend(join_plan->join.joinqual,
+				make_opclause(qual->opno, BOOLOID, false, (Expr *) copyObject(key),
+							  (Expr *) copyObject(nlp->paramval),
+							  InvalidOid, qual->inputcollid));
+
+	nlp->paramno = batch_param->paramid;
+	join_plan->yb_batch_size = batch_size;
+}
+
 static MergeJoin *
 create_mergejoin_plan(PlannerInfo *root,
 					  MergePath *best_path)
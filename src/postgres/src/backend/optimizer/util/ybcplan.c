@@ -25,6 +25,7 @@
 
 #include "optimizer/ybcplan.h"
 #include "access/htup_details.h"
+#include "catalog/catalog.h"
 #include "catalog/pg_proc.h"
 #include "catalog/pg_type.h"
 #include "nodes/makefuncs.h"
@@ -671,3 +672,38 @@ bool YBCIsSupportedSingleRowModifyReturningExpr(Expr *expr) {
 
 	return false;
 }
+
+/*
+ * Returns the number of outer rows, that nested loop join of the given path
+ * should join with a single scan of its inner side, or 1 if the join should
+ * not be batched.
+ *
+ * Each scan of YB relation costs a round trip to DocDB, so scanning the inner
+ * side once per batch of outer rows is cheaper than once per outer row. It is
+ * possible when the inner side is an index scan of YB relation parameterized
+ * by the outer side, and worthwhile when more than one outer row is expected.
+ */
+int YbGetNestLoopBatchSize(PlannerInfo *root, NestPath *path)
+{
+	Path *inner_path = path->innerjoinpath;
+	RangeTblEntry *rte;
+	Relation relation;
+	bool is_batchable;
+
+	if (yb_bnl_batch_size <= 1 || !IsYugaByteEnabled())
+		return 1;
+
+	if (inner_path->pathtype != T_IndexScan ||
+		inner_path->param_info == NULL ||
+		inner_path->parent->rtekind != RTE_RELATION ||
+		path->outerjoinpath->rows <= 1)
+		return 1;
+
+	rte = planner_rt_fetch(inner_path->parent->relid, root);
+	relation = RelationIdGetRelation(rte->relid);
+	/* IN conditions are not pushed down to system tables, see yb_scan.c. */
+	is_batchable = IsYBRelation(relation) && !IsSystemRelation(relation);
+	RelationClose(relation);
+
+	return is_batchable ? yb_bnl_batch_size : 1;
+}
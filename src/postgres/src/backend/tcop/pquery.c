@@ -45,7 +45,8 @@ static void ProcessQuery(PlannedStmt *plan,
 			 QueryEnvironment *queryEnv,
 			 DestReceiver *dest,
 			 char *completionTag,
-			 bool isSingleRowModifyTxn);
+			 bool isSingleRowModifyTxn,
+			 bool isSingleStmtTxn);
 static void FillPortalStore(Portal portal, bool isTopLevel);
 static uint64 RunFromStore(Portal portal, ScanDirection direction, uint64 count,
 			 DestReceiver *dest);
@@ -145,7 +146,8 @@ ProcessQuery(PlannedStmt *plan,
 			 QueryEnvironment *queryEnv,
 			 DestReceiver *dest,
 			 char *completionTag,
-			 bool isSingleRowModifyTxn)
+			 bool isSingleRowModifyTxn,
+			 bool isSingleStmtTxn)
 {
 	QueryDesc  *queryDesc;
 
@@ -166,6 +168,17 @@ ProcessQuery(PlannedStmt *plan,
 		isSingleRowModifyTxn && queryDesc->estate->es_num_result_relations == 1 &&
 		YBCIsSingleRowTxnCapableRel(&queryDesc->estate->es_result_relations[0]);
 
+	/*
+	 * Multi-row modify that forms the whole transaction could be written
+	 * without distributed transaction, when all its rows belong to the same
+	 * tablet. Used in YB mode.
+	 */
+	if (IsYugaByteEnabled())
+		YBCPgSetSingleStatementModifyTxn(
+			isSingleStmtTxn && !queryDesc->estate->es_yb_is_single_row_modify_txn &&
+			queryDesc->estate->es_num_result_relations == 1 &&
+			YBCIsSingleRowTxnCapableRel(&queryDesc->estate->es_result_relations[0]));
+
 	/*
 	 * Run the plan to completion.
 	 */
@@ -1232,6 +1245,7 @@ PortalRunMulti(Portal portal,
 {
 	bool		active_snapshot_set = false;
 	bool        is_single_row_modify_txn = false;
+	bool        is_single_stmt_txn = false;
 	ListCell   *stmtlist_item;
 
 	/*
@@ -1255,6 +1269,7 @@ PortalRunMulti(Portal portal,
 		{
 			PlannedStmt *pstmt = linitial_node(PlannedStmt, portal->stmts);
 			is_single_row_modify_txn = YBCIsSingleRowModify(pstmt);
+			is_single_stmt_txn = true;
 		}
 	}
 
@@ -1322,7 +1337,8 @@ PortalRunMulti(Portal portal,
 							 portal->queryEnv,
 							 dest,
 							 completionTag,
-							 is_single_row_modify_txn);
+							 is_single_row_modify_txn,
+							 is_single_stmt_txn);
 			}
 			else
 			{
@@ -1333,7 +1349,8 @@ PortalRunMulti(Portal portal,
 							 portal->queryEnv,
 							 altdest,
 							 NULL,
-							 is_single_row_modify_txn);
+							 is_single_row_modify_txn,
+							 is_single_stmt_txn);
 			}
 
 			if (log_executor_stats)
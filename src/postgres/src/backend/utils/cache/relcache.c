@@ -1686,8 +1686,8 @@ YBUpdateRelationsPartitioning(bool sys_relations_update_required)
 	heap_close(pg_partitioned_table_desc, AccessShareLock);
 }
 
-void
-YBPreloadRelCache()
+static void
+YBPreloadRelCacheImpl()
 {
 	/*
 	 * Make sure that the connection is still valid.
@@ -1728,6 +1728,28 @@ YBPreloadRelCache()
 	criticalRelcachesBuilt = true;
 }
 
+/*
+ * Preload the relation cache for the given catalog version.
+ * Catalog reads performed here are the same for all backends loading the same catalog version,
+ * so they could be served by the response cache of the local tserver.
+ */
+void
+YBPreloadRelCache(uint64_t catalog_version)
+{
+	YBCPgSetCatalogReadCaching(catalog_version);
+	PG_TRY();
+	{
+		YBPreloadRelCacheImpl();
+	}
+	PG_CATCH();
+	{
+		YBCPgSetCatalogReadCaching(0);
+		PG_RE_THROW();
+	}
+	PG_END_TRY();
+	YBCPgSetCatalogReadCaching(0);
+}
+
 /*
  *		RelationBuildDesc
  *
@@ -4298,7 +4320,7 @@ RelationCacheInitializePhase3(void)
 	 */
 	if (needNewCacheFile && IsYugaByteEnabled())
 	{
-		YBPreloadRelCache();
+		YBPreloadRelCache(yb_catalog_cache_version);
 	}
 
 	/*
@@ -3347,6 +3347,18 @@ static struct config_int ConfigureNamesInt[] =
 		NULL, NULL, NULL
 	},
 
+	{
+		{"yb_bnl_batch_size", PGC_USERSET, QUERY_TUNING_METHOD,
+			gettext_noop("Sets the number of outer rows of nested loop join, "
+						 "that are joined with a single scan of the inner "
+						 "relation."),
+			gettext_noop("Batching is disabled when set to 1.")
+		},
+		&yb_bnl_batch_size,
+		1, 1, 1024,
+		NULL, NULL, NULL
+	},
+
 	/* End-of-list marker */
 	{
 		{NULL, 0, 0, NULL, NULL}, NULL, 0, 0, 0, NULL, NULL, NULL
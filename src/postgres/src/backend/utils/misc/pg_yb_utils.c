@@ -913,6 +913,7 @@ PowerWithUpperLimit(double base, int exp, double upper_limit)
 
 bool yb_enable_create_with_table_oid = false;
 int yb_index_state_flags_update_delay = 1000;
+int yb_bnl_batch_size = 1;
 
 //------------------------------------------------------------------------------
 // YB Debug utils.
@@ -95,14 +95,47 @@ struct YbgExprContextData
 };
 
 /*
- * Evaluate an expression against an expression context.
+ * Expression prepared for evaluation: functions are looked up once, so the
+ * same expression could be evaluated multiple times without repeating that.
+ */
+typedef struct YbgExprStateData *YbgExprState;
+
+struct YbgExprStateData
+{
+	Expr *expr;
+	/* Function info and argument states for function and operator calls. */
+	FmgrInfo *flinfo;
+	int nargs;
+	YbgExprState *args;
+};
+
+/*
+ * Deserialized and prepared expression, allocated in its own memory context.
+ */
+struct YbgPreparedExprData
+{
+	MemoryContext memctx;
+	/* Memory context to restore, set only while the expression is prepared. */
+	MemoryContext saved_memctx;
+	YbgExprState state;
+};
+
+/*
+ * Prepare an expression for evaluation, allocating state in the current
+ * memory context.
  * Currently assumes the expression has been checked by the planner to only
  * allow immutable functions and the node types handled below.
  * TODO: this should use the general YSQL/PG expression evaluation framework, but
  * that requires syscaches and other dependencies to be fully initialized.
  */
-static Datum evalExpr(YbgExprContext ctx, Expr* expr, bool *is_null)
+static YbgExprState prepareExpr(Expr *expr)
 {
+	/* Relabeling does not change the value, so it is not evaluated. */
+	while (IsA(expr, RelabelType))
+		expr = castNode(RelabelType, expr)->arg;
+
+	YbgExprState state = (YbgExprState) palloc0(sizeof(struct YbgExprStateData));
+	state->expr = expr;
 	switch (expr->type)
 	{
 		case T_FuncExpr:
@@ -119,62 +152,86 @@ static Datum evalExpr(YbgExprContext ctx, Expr* expr, bool *is_null)
 				args = func_expr->args;
 				funcid = func_expr->funcid;
 			}
-			else if (IsA(expr, OpExpr))
+			else
 			{
 				OpExpr *op_expr = castNode(OpExpr, expr);
 				args = op_expr->args;
 				funcid = op_expr->opfuncid;
 			}
 
-			FmgrInfo *flinfo = palloc0(sizeof(FmgrInfo));
+			state->flinfo = palloc0(sizeof(FmgrInfo));
+			fmgr_info(funcid, state->flinfo);
+			state->nargs = list_length(args);
+			state->args = (YbgExprState *) palloc0(sizeof(YbgExprState) * (state->nargs + 1));
+			int i = 0;
+			foreach(lc, args)
+			{
+				state->args[i++] = prepareExpr((Expr *) lfirst(lc));
+			}
+			break;
+		}
+		case T_Const:
+		case T_Var:
+			break;
+		default:
+			/* Planner should ensure we never get here. */
+			ereport(ERROR,
+				(errcode(ERRCODE_INTERNAL_ERROR), errmsg(
+				"Unsupported YSQL expression received by DocDB")));
+			break;
+	}
+	return state;
+}
+
+/*
+ * Evaluate a prepared expression against an expression context.
+ */
+static Datum evalExpr(YbgExprContext ctx, YbgExprState state, bool *is_null)
+{
+	switch (state->expr->type)
+	{
+		case T_FuncExpr:
+		case T_OpExpr:
+		{
 			FunctionCallInfoData fcinfo;
 
-			fmgr_info(funcid, flinfo);
 			InitFunctionCallInfoData(fcinfo,
-			                         flinfo,
-			                         args->length,
+			                         state->flinfo,
+			                         state->nargs,
 			                         InvalidOid,
 			                         NULL,
 			                         NULL);
-			int i = 0;
-			foreach(lc, args)
+			for (int i = 0; i < state->nargs; i++)
 			{
-				Expr *arg = (Expr *) lfirst(lc);
-				fcinfo.arg[i] = evalExpr(ctx, arg, &fcinfo.argnull[i]);
+				fcinfo.arg[i] = evalExpr(ctx, state->args[i], &fcinfo.argnull[i]);
 				/*
 				 * Strict functions are guaranteed to return NULL if any of
 				 * their arguments are NULL.
 				 */
-				if (flinfo->fn_strict && fcinfo.argnull[i]) {
+				if (state->flinfo->fn_strict && fcinfo.argnull[i]) {
 					*is_null = true;
 					return (Datum) 0;
 				}
-				i++;
 			}
 			Datum result = FunctionCallInvoke(&fcinfo);
 			*is_null = fcinfo.isnull;
 			return result;
 		}
-		case T_RelabelType:
-		{
-			RelabelType *rt = castNode(RelabelType, expr);
-			return evalExpr(ctx, rt->arg, is_null);
-		}
 		case T_Const:
 		{
-			Const* const_expr = castNode(Const, expr);
+			Const* const_expr = castNode(Const, state->expr);
 			*is_null = const_expr->constisnull;
 			return const_expr->constvalue;
 		}
 		case T_Var:
 		{
-			Var* var_expr = castNode(Var, expr);
+			Var* var_expr = castNode(Var, state->expr);
 			int32_t att_idx = var_expr->varattno - ctx->min_attno;
 			*is_null = bms_is_member(att_idx, ctx->attr_nulls);
 			return ctx->attr_vals[att_idx];
 		}
 		default:
-			/* Planner should ensure we never get here. */
+			/* Rejected by prepareExpr. */
 			ereport(ERROR,
 				(errcode(ERRCODE_INTERNAL_ERROR), errmsg(
 				"Unsupported YSQL expression received by DocDB")));
@@ -222,7 +279,59 @@ YbgStatus YbgEvalExpr(char* expr_cstring, YbgExprContext expr_ctx, uint64_t *dat
 {
 	PG_SETUP_ERROR_REPORTING();
 	Expr *expr = (Expr *) stringToNode(expr_cstring);
-	*datum = (uint64_t) evalExpr(expr_ctx, expr, is_null);
+	*datum = (uint64_t) evalExpr(expr_ctx, prepareExpr(expr), is_null);
+	return PG_STATUS_OK;
+}
+
+YbgStatus YbgPrepareExpr(char* expr_cstring, YbgPreparedExpr *expr)
+{
+	PG_SETUP_ERROR_REPORTING();
+
+	/*
+	 * Nonzero min size keeps the context out of the context freelists, they are
+	 * global and prepared expressions are created and deleted by multiple threads.
+	 */
+	MemoryContext memctx = AllocSetContextCreate((MemoryContext) NULL,
+	                                             "DocDBPreparedExprMemoryContext",
+	                                             ALLOCSET_SMALL_INITSIZE,
+	                                             ALLOCSET_SMALL_INITSIZE,
+	                                             ALLOCSET_SMALL_MAXSIZE);
+	YbgPreparedExpr prepared = (YbgPreparedExpr) MemoryContextAllocZero(
+		memctx, sizeof(struct YbgPreparedExprData));
+	prepared->memctx = memctx;
+	/*
+	 * Set the result before anything that could fail, so the caller is able to
+	 * release it in case of error.
+	 */
+	*expr = prepared;
+
+	prepared->saved_memctx = MemoryContextSwitchTo(memctx);
+	prepared->state = prepareExpr((Expr *) stringToNode(expr_cstring));
+	MemoryContextSwitchTo(prepared->saved_memctx);
+	prepared->saved_memctx = NULL;
+
+	return PG_STATUS_OK;
+}
+
+YbgStatus YbgEvalPreparedExpr(YbgPreparedExpr expr,
+                              YbgExprContext expr_ctx,
+                              uint64_t *datum,
+                              bool *is_null)
+{
+	PG_SETUP_ERROR_REPORTING();
+	*datum = (uint64_t) evalExpr(expr_ctx, expr->state, is_null);
+	return PG_STATUS_OK;
+}
+
+YbgStatus YbgFreePreparedExpr(YbgPreparedExpr expr)
+{
+	PG_SETUP_ERROR_REPORTING();
+
+	/* Preparation has failed, so restore the memory context it has switched to. */
+	if (expr->saved_memctx != NULL)
+		MemoryContextSwitchTo(expr->saved_memctx);
+	MemoryContextDelete(expr->memctx);
+
 	return PG_STATUS_OK;
 }
 
@@ -1707,6 +1707,9 @@ typedef struct ForeignScanState
 
 	/* YB specific attributes. */
 	List	   *yb_fdw_aggs;	/* aggregate pushdown information */
+	Bitmapset  *yb_fdw_group_attnos;	/* attnos of pushed down GROUP BY */
+	List	   *yb_fdw_sort_keys;	/* SortBy list of pushed down ORDER BY */
+	int64		yb_fdw_sort_limit;	/* rows needed from pushed down ORDER BY */
 } ForeignScanState;
 
 /* ----------------
@@ -1760,6 +1763,12 @@ typedef struct JoinState
  *		NeedNewOuter	   true if need new outer tuple on next call
  *		MatchedOuter	   true if found a join match for current outer tuple
  *		NullInnerTupleSlot prepared null tuple for left outer joins
+ *
+ *	 Batched nested loop (YB):
+ *		yb_OuterBatch	   outer tuples of the current batch
+ *		yb_InnerBatch	   inner tuples matching any outer tuple of the batch
+ *		yb_OuterDone	   true if outer plan is exhausted
+ *		yb_BatchContext	   memory holding the param array of the batch
  * ----------------
  */
 typedef struct NestLoopState
@@ -1768,6 +1777,15 @@ typedef struct NestLoopState
 	bool		nl_NeedNewOuter;
 	bool		nl_MatchedOuter;
 	TupleTableSlot *nl_NullInnerTupleSlot;
+	Tuplestorestate *yb_OuterBatch;
+	Tuplestorestate *yb_InnerBatch;
+	TupleTableSlot *yb_OuterBatchSlot;
+	TupleTableSlot *yb_InnerBatchSlot;
+	bool		yb_OuterDone;
+	MemoryContext yb_BatchContext;
+	int16		yb_ParamTypLen;
+	bool		yb_ParamTypByVal;
+	char		yb_ParamTypAlign;
 } NestLoopState;
 
 /* ----------------
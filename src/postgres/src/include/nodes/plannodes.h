@@ -700,12 +700,18 @@ typedef struct Join
  * Vars, but perhaps someday that'd be worth relaxing.  (Note: during plan
  * creation, the paramval can actually be a PlaceHolderVar expression; but it
  * must be a Var with varno OUTER_VAR by the time it gets to the executor.)
+ *
+ * In YB mode nested loop could be batched, when yb_batch_size is greater than
+ * one.  Then up to yb_batch_size outer rows are read at once, nestParams has
+ * the single param, that is set to the array of paramval of these rows, and
+ * the inner subplan is scanned once for the whole batch.
  * ----------------
  */
 typedef struct NestLoop
 {
 	Join		join;
 	List	   *nestParams;		/* list of NestLoopParam nodes */
+	int			yb_batch_size;	/* outer rows per inner scan, if batched */
 } NestLoop;
 
 typedef struct NestLoopParam
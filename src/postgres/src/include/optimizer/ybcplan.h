@@ -47,6 +47,8 @@ bool YBCAllPrimaryKeysProvided(Relation rel, Bitmapset *attrs);
 
 bool YBCIsSupportedSingleRowModifyReturningExpr(Expr *expr);
 
+int YbGetNestLoopBatchSize(PlannerInfo *root, NestPath *path);
+
 #endif // YBCPLAN_H
 
 
@@ -401,6 +401,12 @@ extern bool yb_enable_create_with_table_oid;
  */
 extern int yb_index_state_flags_update_delay;
 
+/*
+ * Number of outer rows of nested loop join, that are joined with a single scan
+ * of the inner YB relation. Nested loop joins are not batched when it is 1.
+ */
+extern int yb_bnl_batch_size;
+
 //------------------------------------------------------------------------------
 // GUC variables needed by YB via their YB pointers.
 extern int StatementTimeout;
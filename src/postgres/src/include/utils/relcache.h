@@ -94,7 +94,7 @@ extern void RelationCacheInitialize(void);
 extern void RelationCacheInitializePhase2(void);
 extern void RelationCacheInitializePhase3(void);
 
-extern void YBPreloadRelCache();
+extern void YBPreloadRelCache(uint64_t catalog_version);
 
 /*
  * Routine to create a relcache entry for an about-to-be-created relation
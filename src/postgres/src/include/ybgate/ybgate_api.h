@@ -129,6 +129,32 @@ YbgStatus YbgExprContextAddColValue(YbgExprContext expr_ctx, int32_t attno, uint
  */
 YbgStatus YbgEvalExpr(char* expr_cstring, YbgExprContext expr_ctx, uint64_t *datum, bool *is_null);
 
+#ifdef __cplusplus
+typedef void* YbgPreparedExpr;
+#else
+typedef struct YbgPreparedExprData* YbgPreparedExpr;
+#endif
+
+/*
+ * Deserialize an expression and prepare it for evaluation.
+ * The prepared expression uses its own memory context, so it could be evaluated
+ * multiple times, until released with YbgFreePreparedExpr.
+ * If preparation fails, but expr is set, it still should be released.
+ */
+YbgStatus YbgPrepareExpr(char* expr_cstring, YbgPreparedExpr *expr);
+
+/*
+ * Evaluate a prepared expression, same as YbgEvalExpr does.
+ * A prepared expression should not be evaluated by multiple threads concurrently.
+ */
+YbgStatus YbgEvalPreparedExpr(YbgPreparedExpr expr, YbgExprContext expr_ctx,
+							  uint64_t *datum, bool *is_null);
+
+/*
+ * Release the prepared expression.
+ */
+YbgStatus YbgFreePreparedExpr(YbgPreparedExpr expr);
+
 /*
  * Given a 'datum' of array type, split datum into individual elements of type 'type' and store
  * the result in 'result_datum_array', with number of elements in 'nelems'. This will error out
@@ -450,6 +450,9 @@ void HandleExtraFields(YBPgsqlWriteOp* op, tserver::WriteRequestPB* req) {
   if (op->write_time()) {
     req->set_external_hybrid_time(op->write_time().ToUint64());
   }
+  if (op->check_read_time_conflicts()) {
+    req->set_check_read_time_conflicts(true);
+  }
 }
 
 void HandleExtraFields(YBqlReadOp* op, tserver::ReadRequestPB* req) {
@@ -60,6 +60,7 @@
 #include "yb/client/yb_op.h"
 #include "yb/client/yb_table_name.h"
 
+#include "yb/common/transaction_error.h"
 #include "yb/common/wire_protocol.h"
 
 #include "yb/gutil/stl_util.h"
@@ -468,6 +469,20 @@ void Batcher::AllLookupsDone() {
   }
   ops_info_.groups.emplace_back(group_start, ops_queue_.end());
 
+  if (ops_info_.groups.size() > 1 && !transaction_) {
+    for (const auto& op : ops_queue_) {
+      // Such operations were routed to a single tablet by the caller, and should be written
+      // atomically, but the tablet has been split since then. So caller should retry them.
+      if (op.yb_op->type() == YBOperation::Type::PGSQL_WRITE &&
+          down_cast<YBPgsqlWriteOp*>(op.yb_op.get())->check_read_time_conflicts()) {
+        Abort(STATUS_EC_FORMAT(
+            TryAgain, TransactionError(TransactionErrorCode::kConflict),
+            "Atomic write spans $0 tablets", ops_info_.groups.size()));
+        return;
+      }
+    }
+  }
+
   ExecuteOperations(Initial::kTrue);
 }
 
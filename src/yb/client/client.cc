@@ -1974,6 +1974,11 @@ void YBClient::LookupAllTablets(const std::shared_ptr<const YBTable>& table,
   data_->meta_cache_->LookupAllTablets(table, deadline, std::move(callback));
 }
 
+void YBClient::PreserveTabletsLedBy(
+    const std::string& ts_uuid, std::vector<const TabletId*>* tablet_ids) {
+  data_->meta_cache_->PreserveTabletsLedBy(ts_uuid, tablet_ids);
+}
+
 std::future<Result<internal::RemoteTabletPtr>> YBClient::LookupTabletByKeyFuture(
     const std::shared_ptr<YBTable>& table,
     const std::string& partition_key,
@@ -777,6 +777,9 @@ class YBClient {
                         CoarseTimePoint deadline,
                         LookupTabletRangeCallback callback);
 
+  // Leaves in tablet_ids only tablets whose cached leader is the tablet server with ts_uuid.
+  void PreserveTabletsLedBy(const std::string& ts_uuid, std::vector<const TabletId*>* tablet_ids);
+
   std::future<Result<internal::RemoteTabletPtr>> LookupTabletByKeyFuture(
       const std::shared_ptr<YBTable>& table,
       const std::string& partition_key,
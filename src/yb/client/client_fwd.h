@@ -81,6 +81,7 @@ class YBOperation;
 typedef std::shared_ptr<YBOperation> YBOperationPtr;
 
 class TableHandle;
+class TransactionHeartbeatBatcher;
 class TransactionManager;
 class TransactionPool;
 class YBColumnSpec;
@@ -2037,6 +2037,21 @@ RemoteTabletPtr MetaCache::LookupTabletByIdFastPathUnlocked(const TabletId& tabl
   return nullptr;
 }
 
+void MetaCache::PreserveTabletsLedBy(
+    const std::string& ts_uuid, std::vector<const TabletId*>* tablet_ids) {
+  SharedLock<decltype(mutex_)> lock(mutex_);
+  auto filter = [this, &ts_uuid](const TabletId* id) REQUIRES_SHARED(mutex_) {
+    auto tablet = LookupTabletByIdFastPathUnlocked(*id);
+    if (!tablet) {
+      return true;
+    }
+    auto leader = tablet->LeaderTServer();
+    return !leader || leader->permanent_uuid() != ts_uuid;
+  };
+  tablet_ids->erase(std::remove_if(tablet_ids->begin(), tablet_ids->end(), filter),
+                    tablet_ids->end());
+}
+
 template <class Lock>
 bool MetaCache::DoLookupTabletById(
     const TabletId& tablet_id,
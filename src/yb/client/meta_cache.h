@@ -526,6 +526,10 @@ class MetaCache : public RefCountedThreadSafe<MetaCache> {
                         LookupTabletCallback callback,
                         UseCache use_cache);
 
+  // Leaves in tablet_ids only tablets that are known, from cached information, to be led by the
+  // tablet server with specified uuid.
+  void PreserveTabletsLedBy(const std::string& ts_uuid, std::vector<const TabletId*>* tablet_ids);
+
   // Return the local tablet server if available.
   RemoteTabletServer* local_tserver() const {
     return local_tserver_;
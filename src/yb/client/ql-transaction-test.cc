@@ -22,12 +22,15 @@
 #include "yb/client/transaction_rpc.h"
 #include "yb/client/txn-test-base.h"
 #include "yb/client/yb_op.h"
+#include "yb/client/yb_table_name.h"
 
 #include "yb/common/ql_value.h"
 
 #include "yb/consensus/consensus.h"
 #include "yb/consensus/log.h"
 
+#include "yb/master/master_defaults.h"
+
 #include "yb/rocksdb/db.h"
 
 #include "yb/rpc/rpc.h"
@@ -36,6 +39,7 @@
 #include "yb/tablet/tablet_bootstrap_if.h"
 #include "yb/tablet/tablet_peer.h"
 #include "yb/tablet/transaction_coordinator.h"
+#include "yb/tablet/transaction_participant.h"
 
 #include "yb/tserver/mini_tablet_server.h"
 #include "yb/tserver/tablet_server.h"
@@ -66,6 +70,8 @@ DECLARE_bool(enable_load_balancing);
 DECLARE_bool(fail_on_out_of_range_clock_skew);
 DECLARE_bool(flush_rocksdb_on_shutdown);
 DECLARE_bool(rocksdb_disable_compactions);
+DECLARE_bool(transaction_colocate_status_tablet);
+DECLARE_bool(transaction_single_tablet_commit);
 DECLARE_int32(TEST_delay_init_tablet_peer_ms);
 DECLARE_int32(log_min_seconds_to_retain);
 DECLARE_int32(remote_bootstrap_max_chunk_size);
@@ -511,6 +517,49 @@ TEST_F(QLTransactionTest, ResendApplying) {
   AssertNoRunningTransactions();
 }
 
+// Transaction that wrote to a single tablet should be committed by this tablet, without status
+// tablet sending APPLYING to it.
+TEST_F(QLTransactionTest, SingleTabletCommit) {
+  FLAGS_transaction_single_tablet_commit = true;
+  DisableApplyingIntents();
+
+  auto txn = CreateTransaction();
+  auto session = CreateSession(txn);
+  ASSERT_OK(WriteRow(session, 0 /* key */, 1 /* value */, WriteOpType::INSERT, Flush::kFalse));
+  ASSERT_OK(WriteRow(session, 0 /* key */, 2 /* value */, WriteOpType::UPDATE));
+  ASSERT_OK(txn->CommitFuture().get());
+
+  ASSERT_OK(WaitFor(
+      [this] { return CountRunningTransactions() == 0; }, kTransactionApplyTime,
+      "Transaction applied"));
+  ASSERT_EQ(2, ASSERT_RESULT(SelectRow(CreateSession(), 0 /* key */)));
+  // Client marks transaction record as committed, so it is removed without expiration.
+  ASSERT_OK(WaitTransactionsCleaned());
+
+  // Without single tablet commit, transaction is committed by the status tablet, but is not
+  // applied, since APPLYING is ignored. So intents stay until applying is enabled.
+  FLAGS_transaction_single_tablet_commit = false;
+  txn = CreateTransaction();
+  ASSERT_OK(WriteRow(CreateSession(txn), 1 /* key */, 1 /* value */));
+  ASSERT_OK(txn->CommitFuture().get());
+  ASSERT_TRUE(HasTransactions());
+  ASSERT_GT(CountRunningTransactions(), 0);
+
+  SetIgnoreApplyingProbability(0.0);
+  ASSERT_OK(WaitTransactionsCleaned());
+}
+
+TEST_F(QLTransactionTest, SingleTabletCommitWriteConflict) {
+  FLAGS_transaction_single_tablet_commit = true;
+  auto txn = CreateTransaction();
+  ASSERT_OK(WriteRow(CreateSession(txn), 0 /* key */, 1 /* value */));
+  ASSERT_OK(WriteRow(CreateSession(), 0 /* key */, 2 /* value */));
+
+  ASSERT_NOK(txn->CommitFuture().get());
+  ASSERT_EQ(2, ASSERT_RESULT(SelectRow(CreateSession(), 0 /* key */)));
+  ASSERT_OK(WaitTransactionsCleaned());
+}
+
 TEST_F(QLTransactionTest, ConflictResolution) {
   constexpr int kTotalTransactions = 5;
   constexpr int kNumRows = 10;
@@ -1466,6 +1515,64 @@ TEST_F_EX(QLTransactionTest, ChangeLeader, QLTransactionBigLogSegmentSizeTest) {
   ASSERT_LE(expirations.load() * 100, successes * 5);
 }
 
+// Leaders of data tablets are changed while transactions are committed on single tablet. Every
+// successfully committed transaction should be visible, and no intents or transaction records
+// should be left.
+TEST_F(QLTransactionTest, SingleTabletCommitChangeLeader) {
+  constexpr auto kTestTime = 5s;
+
+  FLAGS_transaction_single_tablet_commit = true;
+  FLAGS_transaction_rpc_timeout_ms = MonoDelta(1min).ToMilliseconds();
+
+  std::atomic<bool> stopped{false};
+  std::vector<int32_t> committed_keys;
+  std::thread writer([this, &stopped, &committed_keys] {
+    CDSAttacher attacher;
+    for (int32_t key = 0; !stopped.load(std::memory_order_acquire); ++key) {
+      auto txn = CreateTransaction();
+      auto write_status = ResultToStatus(WriteRow(CreateSession(txn), key, key));
+      if (!write_status.ok()) {
+        LOG(INFO) << "Write of " << key << " failed: " << write_status;
+        continue;
+      }
+      auto status = txn->CommitFuture().get();
+      if (status.ok()) {
+        committed_keys.push_back(key);
+      } else {
+        LOG(INFO) << "Commit of " << key << " failed: " << status;
+      }
+    }
+  });
+
+  auto test_finish = std::chrono::steady_clock::now() + kTestTime;
+  while (std::chrono::steady_clock::now() < test_finish) {
+    for (size_t i = 0; i != cluster_->num_tablet_servers(); ++i) {
+      auto peers = cluster_->mini_tablet_server(i)->server()->tablet_manager()->GetTabletPeers();
+      for (const auto& peer : peers) {
+        if (peer->consensus() &&
+            peer->consensus()->GetLeaderStatus() != consensus::LeaderStatus::NOT_LEADER &&
+            peer->tablet()->transaction_participant() &&
+            !peer->tablet()->transaction_coordinator()) {
+          consensus::LeaderStepDownRequestPB req;
+          req.set_tablet_id(peer->tablet_id());
+          consensus::LeaderStepDownResponsePB resp;
+          ASSERT_OK(peer->consensus()->StepDown(&req, &resp));
+        }
+      }
+    }
+    std::this_thread::sleep_for(1s);
+  }
+  stopped.store(true, std::memory_order_release);
+  writer.join();
+
+  ASSERT_GT(committed_keys.size(), 0);
+  auto session = CreateSession();
+  for (auto key : committed_keys) {
+    ASSERT_EQ(key, ASSERT_RESULT(SelectRow(session, key)));
+  }
+  ASSERT_OK(WaitTransactionsCleaned());
+}
+
 class RemoteBootstrapTest : public QLTransactionTest {
  protected:
   void SetUp() override {
@@ -1777,5 +1884,53 @@ TEST_F(QLTransactionTest, DeleteTableDuringWrite) {
   }, 10s * kTimeMultiplier, "Cleanup transactions from coordinator"));
 }
 
+// Checks that status tablet of transaction is led by the tablet server that leads the tablet of
+// its first write, when transaction_colocate_status_tablet is set. Also compares commit latency.
+TEST_F(QLTransactionTest, ColocatedStatusTablet) {
+  constexpr int kTransactions = 50;
+
+  // Load status tablets to meta cache, so their leaders are known when status tablet is picked.
+  auto status_table = ASSERT_RESULT(client_->OpenTable(YBTableName(
+      YQL_DATABASE_CQL, master::kSystemNamespaceName, kGlobalTransactionsTableName)));
+  auto status_tablets = ASSERT_RESULT(client_->LookupAllTabletsFuture(
+      status_table, CoarseMonoClock::now() + 10s * kTimeMultiplier).get());
+  LOG(INFO) << "Status tablets: " << status_tablets.size();
+
+  int key = 0;
+  for (bool colocate : {false, true}) {
+    FLAGS_transaction_colocate_status_tablet = colocate;
+    int num_colocated = 0;
+    MonoDelta commit_time;
+    for (int i = 0; i != kTransactions; ++i, ++key) {
+      auto txn = CreateTransaction();
+      ASSERT_OK(WriteRow(CreateSession(txn), key, key));
+      auto metadata = ASSERT_RESULT(Copy(txn->GetMetadata().get()));
+
+      auto* status_tablet_leader = FindTabletLeader(cluster_.get(), metadata.status_tablet);
+      ASSERT_NE(status_tablet_leader, nullptr);
+      auto peers = status_tablet_leader->server()->tablet_manager()->GetTabletPeers();
+      for (const auto& peer : peers) {
+        auto tablet = peer->shared_tablet();
+        if (tablet && tablet->transaction_participant() &&
+            tablet->transaction_participant()->LocalCommitData(metadata.transaction_id) &&
+            peer->LeaderStatus() != consensus::LeaderStatus::NOT_LEADER) {
+          ++num_colocated;
+          break;
+        }
+      }
+
+      auto start = MonoTime::Now();
+      ASSERT_OK(txn->CommitFuture().get());
+      commit_time += MonoTime::Now() - start;
+    }
+    LOG(INFO) << "Colocate status tablet: " << colocate << ", colocated transactions: "
+              << num_colocated << " of " << kTransactions << ", avg commit time: "
+              << commit_time.ToMicroseconds() / kTransactions << "us";
+    if (colocate) {
+      ASSERT_EQ(num_colocated, kTransactions);
+    }
+  }
+}
+
 } // namespace client
 } // namespace yb
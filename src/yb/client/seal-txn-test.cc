@@ -27,6 +27,7 @@ using namespace std::literals;
 
 DECLARE_bool(enable_load_balancing);
 DECLARE_bool(enable_transaction_sealing);
+DECLARE_bool(transaction_parallel_commit);
 DECLARE_bool(TEST_fail_on_replicated_batch_idx_set_in_txn_record);
 DECLARE_double(transaction_max_missed_heartbeat_periods);
 DECLARE_int32(TEST_write_rejection_percentage);
@@ -151,5 +152,22 @@ TEST_F(SealTxnTest, Update) {
   AssertNoRunningTransactions();
 }
 
+// Commit transaction while its last batch is still in flight, and check that coordinator commits
+// it without anybody reading its intents.
+TEST_F(SealTxnTest, ParallelCommit) {
+  FLAGS_transaction_parallel_commit = true;
+
+  auto txn = CreateTransaction();
+  auto session = CreateSession(txn);
+  ASSERT_OK(WriteRows(session, /* transaction = */ 0, WriteOpType::INSERT, Flush::kFalse));
+  auto flush_future = session->FlushFuture();
+  auto commit_future = txn->CommitFuture();
+  ASSERT_OK(flush_future.get().status);
+  ASSERT_OK(commit_future.get());
+  LOG(INFO) << "Committed: " << txn->id();
+  AssertNoRunningTransactions();
+  ASSERT_NO_FATALS(VerifyData());
+}
+
 } // namespace client
 } // namespace yb
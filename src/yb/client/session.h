@@ -117,6 +117,10 @@ class YBSession : public std::enable_shared_from_this<YBSession> {
   // Changes transaction used by this session.
   void SetTransaction(YBTransactionPtr transaction);
 
+  const YBTransactionPtr& transaction() const {
+    return batcher_config_.transaction;
+  }
+
   // Set the timeout for writes made in this session.
   void SetTimeout(MonoDelta delta);
 
@@ -22,6 +22,7 @@
 #include "yb/client/in_flight_op.h"
 #include "yb/client/meta_cache.h"
 #include "yb/client/transaction_cleanup.h"
+#include "yb/client/transaction_heartbeat_batcher.h"
 #include "yb/client/transaction_manager.h"
 #include "yb/client/transaction_rpc.h"
 #include "yb/client/yb_op.h"
@@ -37,6 +38,7 @@
 
 #include "yb/tserver/tserver_service.pb.h"
 
+#include "yb/util/capabilities.h"
 #include "yb/util/countdown_latch.h"
 #include "yb/util/flag_tags.h"
 #include "yb/util/format.h"
@@ -71,6 +73,29 @@ DEFINE_uint64(transaction_heartbeat_usec, 500000 * yb::kTimeMultiplier,
 DEFINE_bool(transaction_disable_heartbeat_in_tests, false, "Disable heartbeat during test.");
 DECLARE_uint64(max_clock_skew_usec);
 
+DEFINE_bool(transaction_single_tablet_commit, false,
+            "Commit transactions that wrote intents to a single tablet directly at that tablet, "
+            "without transaction status tablet round trip. Used only when leader of this tablet "
+            "reports that it supports single tablet commit.");
+TAG_FLAG(transaction_single_tablet_commit, advanced);
+TAG_FLAG(transaction_single_tablet_commit, runtime);
+
+DEFINE_bool(transaction_parallel_commit, false,
+            "Do not wait for running write operations of transaction during commit. Instead "
+            "replicate sealed transaction record, listing batches of the transaction, "
+            "concurrently with them. Transaction is committed when all listed batches are "
+            "replicated. Used only when tablet servers report that they have "
+            "enable_transaction_sealing.");
+TAG_FLAG(transaction_parallel_commit, advanced);
+TAG_FLAG(transaction_parallel_commit, runtime);
+
+DEFINE_bool(transaction_colocate_status_tablet, false,
+            "Pick status tablet of transaction lazily, on its first write, preferring status "
+            "tablets led by the same tablet server as the first written tablet. "
+            "So heartbeats, commit and status requests of short transactions stay local.");
+TAG_FLAG(transaction_colocate_status_tablet, advanced);
+TAG_FLAG(transaction_colocate_status_tablet, runtime);
+
 DEFINE_test_flag(int32, transaction_inject_flushed_delay_ms, 0,
                  "Inject delay before processing flushed operations by transaction.");
 
@@ -80,6 +105,10 @@ DEFINE_test_flag(bool, disable_proactive_txn_cleanup_on_abort, false,
 DECLARE_string(placement_cloud);
 DECLARE_string(placement_region);
 
+// Reported only by tablet servers with enable_transaction_sealing, see Heartbeater.
+DEFINE_CAPABILITY(TransactionSealing, 0x7c3e91d5);
+DEFINE_CAPABILITY(SingleTabletCommit, 0x3d0f6e8b);
+
 namespace yb {
 namespace client {
 
@@ -345,13 +374,21 @@ class YBTransaction::Impl final : public internal::TxnBatcherIf {
         }
       }
 
+      std::string preferred_leader_uuid;
       if (defer) {
         if (waiter) {
           waiters_.push_back(std::move(waiter));
         }
+        if (initial && !ops_info->groups.empty() && metadata_.status_tablet.empty() &&
+            GetAtomicFlag(&FLAGS_transaction_colocate_status_tablet)) {
+          auto* leader = ops_info->groups.front().begin->tablet->LeaderTServer();
+          if (leader) {
+            preferred_leader_uuid = leader->permanent_uuid();
+          }
+        }
         lock.unlock();
         VLOG_WITH_PREFIX(2) << "Prepare, rejected (not ready, requesting status tablet)";
-        RequestStatusTablet(deadline);
+        RequestStatusTablet(deadline, preferred_leader_uuid);
         return false;
       }
 
@@ -390,6 +427,7 @@ class YBTransaction::Impl final : public internal::TxnBatcherIf {
 
     boost::optional<Status> notify_commit_status;
     bool abort = false;
+    bool abort_sealed = false;
 
     CommitCallback commit_callback;
     {
@@ -421,6 +459,14 @@ class YBTransaction::Impl final : public internal::TxnBatcherIf {
             if (prev_tablet_id == nullptr || tablet_id != *prev_tablet_id) {
               prev_tablet_id = &tablet_id;
               tablets_[tablet_id].has_metadata = true;
+              if (!LeaderSupportsSealing(*op.tablet)) {
+                sealing_supported_ = false;
+              }
+              auto* leader = op.tablet->LeaderTServer();
+              if (!leader || !leader->HasCapability(CAPABILITY_SingleTabletCommit)) {
+                // Older tablet server would handle such commit as regular APPLYING.
+                single_tablet_commit_supported_ = false;
+              }
             }
           }
         }
@@ -441,10 +487,14 @@ class YBTransaction::Impl final : public internal::TxnBatcherIf {
       if (running_requests_ == 0 && commit_replicated_) {
         notify_commit_status = status_;
         commit_callback = std::move(commit_callback_);
+        // Operation that was running during parallel commit could require read restart.
+        abort_sealed = notify_commit_status->ok() && IsRestartRequired();
       }
     }
 
-    if (notify_commit_status) {
+    if (abort_sealed) {
+      AbortSealed(std::move(commit_callback));
+    } else if (notify_commit_status) {
       VLOG_WITH_PREFIX(4) << "Sealing done: " << *notify_commit_status;
       commit_callback(*notify_commit_status);
     }
@@ -460,6 +510,12 @@ class YBTransaction::Impl final : public internal::TxnBatcherIf {
     TRACE_TO(trace_, __func__);
     {
       UNIQUE_LOCK(lock, mutex_);
+      if (!seal_only && running_requests_ > 0 && CanCommitInParallelUnlocked()) {
+        // Overlap commit record replication with the last write batches. Sealed transaction
+        // reports completion only after all its running operations are flushed.
+        VLOG_WITH_PREFIX(4) << "Parallel commit with " << running_requests_ << " running requests";
+        seal_only = SealOnly::kTrue;
+      }
       auto status = CheckCouldCommitUnlocked(seal_only);
       if (!status.ok()) {
         lock.unlock();
@@ -773,6 +829,11 @@ class YBTransaction::Impl final : public internal::TxnBatcherIf {
       return;
     }
 
+    if (CanCommitOnSingleTabletUnlocked(seal_only)) {
+      DoSingleTabletCommit(deadline, transaction);
+      return;
+    }
+
     tserver::UpdateTransactionRequestPB req;
     req.set_tablet_id(status_tablet_->tablet_id());
     req.set_propagated_hybrid_time(manager_->Now().ToUint64());
@@ -820,6 +881,108 @@ class YBTransaction::Impl final : public internal::TxnBatcherIf {
         &commit_handle_);
   }
 
+  // When all intents of the transaction were written to a single tablet, this tablet could commit
+  // transaction itself, applying intents with one Raft operation. Status tablet is not involved
+  // in such commit, and is only notified afterwards to drop the transaction record.
+  bool CanCommitOnSingleTabletUnlocked(SealOnly seal_only) REQUIRES(mutex_) {
+    return FLAGS_transaction_single_tablet_commit && single_tablet_commit_supported_ &&
+           !seal_only && !child_ &&
+           running_requests_ == 0 && tablets_.size() == 1 &&
+           tablets_.begin()->second.has_metadata;
+  }
+
+  void DoSingleTabletCommit(CoarseTimePoint deadline, const YBTransactionPtr& transaction)
+      REQUIRES(mutex_) {
+    VLOG_WITH_PREFIX(2) << "Commit on single tablet: " << tablets_.begin()->first;
+    // Keep transaction record alive while commit is in progress, so status tablet does not abort
+    // transaction that could still be committed by the participant.
+    single_tablet_commit_in_progress_.store(true, std::memory_order_release);
+
+    tserver::UpdateTransactionRequestPB req;
+    req.set_tablet_id(tablets_.begin()->first);
+    req.set_propagated_hybrid_time(manager_->Now().ToUint64());
+    auto& state = *req.mutable_state();
+    state.set_transaction_id(metadata_.transaction_id.data(), metadata_.transaction_id.size());
+    state.set_status(TransactionStatus::APPLYING);
+    state.set_single_tablet_commit(true);
+    state.add_tablets(status_tablet_->tablet_id());
+    if (subtransaction_opt_ != boost::none) {
+      subtransaction_opt_->get().aborted.ToPB(state.mutable_aborted()->mutable_set());
+    }
+
+    manager_->rpcs().RegisterAndStart(
+        UpdateTransaction(
+            deadline,
+            nullptr /* remote_tablet */,
+            manager_->client(),
+            &req,
+            [this, transaction](const auto& status, const auto& req, const auto& resp) {
+              this->SingleTabletCommitDone(status, resp, transaction);
+            }),
+        &commit_handle_);
+  }
+
+  void SingleTabletCommitDone(const Status& status,
+                              const tserver::UpdateTransactionResponsePB& response,
+                              const YBTransactionPtr& transaction) EXCLUDES(mutex_) {
+    TRACE_TO(trace_, __func__);
+    VLOG_WITH_PREFIX(1) << "Committed on single tablet: " << status;
+
+    UpdateClock(response, manager_);
+    manager_->rpcs().Unregister(&commit_handle_);
+    single_tablet_commit_in_progress_.store(false, std::memory_order_release);
+
+    CommitCallback commit_callback;
+    decltype(status_tablet_) status_tablet;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      commit_callback = std::move(commit_callback_);
+      status_tablet = status_tablet_;
+    }
+    commit_callback(status);
+
+    if (status.ok()) {
+      SendResolveRecordRequest(transaction, status_tablet);
+      return;
+    }
+    // Commit operation was not replicated, or its result is unknown. In the latter case it is
+    // still safe to abort transaction record: new leader of the participant applies replicated
+    // commit before serving requests, and then does not have intents of this transaction anymore.
+    SendAbortRequest(TransactionRpcDeadline(), transaction, status_tablet);
+    // Commit result could be unknown, so use graceful cleanup, the same way as CommitDone does.
+    DoAbortCleanup(transaction, CleanupType::kGraceful);
+  }
+
+  // Marks transaction record of transaction committed on a single tablet as committed. Commit
+  // record does not list any tablets, so status tablet does not send APPLYING anywhere and removes
+  // the record right after that.
+  void SendResolveRecordRequest(
+      const YBTransactionPtr& transaction, const internal::RemoteTabletPtr& status_tablet) {
+    tserver::UpdateTransactionRequestPB req;
+    req.set_tablet_id(status_tablet->tablet_id());
+    req.set_propagated_hybrid_time(manager_->Now().ToUint64());
+    auto& state = *req.mutable_state();
+    state.set_transaction_id(metadata_.transaction_id.data(), metadata_.transaction_id.size());
+    state.set_status(TransactionStatus::COMMITTED);
+
+    manager_->rpcs().RegisterAndStart(
+        UpdateTransaction(
+            TransactionRpcDeadline(),
+            status_tablet.get(),
+            manager_->client(),
+            &req,
+            [this, transaction](const auto& status, const auto& req, const auto& resp) {
+              UpdateClock(resp, manager_);
+              manager_->rpcs().Unregister(&commit_handle_);
+              // Not resolved record would expire, and the participant does not have intents of
+              // this transaction anymore, so it is enough to log the failure.
+              LOG_IF_WITH_PREFIX(WARNING, !status.ok())
+                  << "Failed to resolve record of transaction committed on single tablet: "
+                  << status;
+            }),
+        &commit_handle_);
+  }
+
   void DoAbort(CoarseTimePoint deadline, const YBTransactionPtr& transaction) EXCLUDES(mutex_) {
     decltype(status_tablet_) status_tablet;
     {
@@ -833,6 +996,14 @@ class YBTransaction::Impl final : public internal::TxnBatcherIf {
       CoarseTimePoint deadline,
       const YBTransactionPtr& transaction,
       internal::RemoteTabletPtr status_tablet) EXCLUDES(mutex_) {
+    SendAbortRequest(deadline, transaction, status_tablet);
+    DoAbortCleanup(transaction, CleanupType::kImmediate);
+  }
+
+  void SendAbortRequest(
+      CoarseTimePoint deadline,
+      const YBTransactionPtr& transaction,
+      const internal::RemoteTabletPtr& status_tablet) EXCLUDES(mutex_) {
     tserver::AbortTransactionRequestPB req;
     req.set_tablet_id(status_tablet->tablet_id());
     req.set_propagated_hybrid_time(manager_->Now().ToUint64());
@@ -846,8 +1017,6 @@ class YBTransaction::Impl final : public internal::TxnBatcherIf {
             &req,
             std::bind(&Impl::AbortDone, this, _1, _2, transaction)),
         &abort_handle_);
-
-    DoAbortCleanup(transaction, CleanupType::kImmediate);
   }
 
   void DoAbortCleanup(const YBTransactionPtr& transaction, CleanupType cleanup_type)
@@ -885,6 +1054,7 @@ class YBTransaction::Impl final : public internal::TxnBatcherIf {
 
     Status actual_status = status.IsAlreadyPresent() ? Status::OK() : status;
     CommitCallback commit_callback;
+    bool abort_sealed = false;
     if (state_.load(std::memory_order_acquire) != TransactionState::kCommitted &&
         actual_status.ok()) {
       std::lock_guard<std::mutex> lock(mutex_);
@@ -892,11 +1062,19 @@ class YBTransaction::Impl final : public internal::TxnBatcherIf {
       if (running_requests_ != 0) {
         return;
       }
+      // Operation that was running during sealing could fail before the seal record was
+      // replicated, or require read restart.
+      actual_status = status_;
       commit_callback = std::move(commit_callback_);
+      abort_sealed = actual_status.ok() && IsRestartRequired();
     } else {
       std::lock_guard<std::mutex> lock(mutex_);
       commit_callback = std::move(commit_callback_);
     }
+    if (abort_sealed) {
+      AbortSealed(std::move(commit_callback));
+      return;
+    }
     VLOG_WITH_PREFIX(4) << "Commit done: " << actual_status;
     commit_callback(actual_status);
 
@@ -920,7 +1098,11 @@ class YBTransaction::Impl final : public internal::TxnBatcherIf {
     manager_->rpcs().Unregister(&abort_handle_);
   }
 
-  void RequestStatusTablet(const CoarseTimePoint& deadline) EXCLUDES(mutex_) {
+  // If preferred_leader_uuid is not empty, then status tablet led by this tablet server is
+  // preferred when picking status tablet for the transaction.
+  void RequestStatusTablet(
+      const CoarseTimePoint& deadline,
+      const std::string& preferred_leader_uuid = std::string()) EXCLUDES(mutex_) {
     TRACE_TO(trace_, __func__);
     bool expected = false;
     if (!requested_status_tablet_.compare_exchange_strong(
@@ -932,7 +1114,7 @@ class YBTransaction::Impl final : public internal::TxnBatcherIf {
     if (metadata_.status_tablet.empty()) {
       manager_->PickStatusTablet(
           std::bind(&Impl::StatusTabletPicked, this, _1, deadline, transaction),
-          metadata_.locality);
+          metadata_.locality, preferred_leader_uuid);
     } else {
       LookupStatusTablet(metadata_.status_tablet, deadline, transaction);
     }
@@ -1059,26 +1241,28 @@ class YBTransaction::Impl final : public internal::TxnBatcherIf {
     // TODO(savepoints) -- Attach metadata about aborted subtransactions in heartbeat.
     state.set_transaction_id(metadata_.transaction_id.data(), metadata_.transaction_id.size());
     state.set_status(status);
+    auto deadline = CoarseMonoClock::now() + timeout;
+    auto callback = std::bind(&Impl::HeartbeatDone, this, _1, _2, _3, status, transaction);
+    auto* heartbeat_batcher = manager_->heartbeat_batcher();
     manager_->rpcs().RegisterAndStart(
-        UpdateTransaction(
-            CoarseMonoClock::now() + timeout,
-            status_tablet.get(),
-            manager_->client(),
-            &req,
-            std::bind(&Impl::HeartbeatDone, this, _1, _2, _3, status, transaction)),
+        heartbeat_batcher && status == TransactionStatus::PENDING
+            ? heartbeat_batcher->Heartbeat(deadline, status_tablet, &req, std::move(callback))
+            : UpdateTransaction(
+                  deadline, status_tablet.get(), manager_->client(), &req, std::move(callback)),
         &heartbeat_handle_);
   }
 
-  static bool AllowHeartbeat(TransactionState current_state, TransactionStatus status) {
+  bool AllowHeartbeat(TransactionState current_state, TransactionStatus status) {
     switch (current_state) {
       case TransactionState::kRunning:
         return true;
       case TransactionState::kReleased: FALLTHROUGH_INTENDED;
       case TransactionState::kSealed:
         return status == TransactionStatus::CREATED;
-      case TransactionState::kAborted: FALLTHROUGH_INTENDED;
-      case TransactionState::kCommitted:
+      case TransactionState::kAborted:
         return false;
+      case TransactionState::kCommitted:
+        return single_tablet_commit_in_progress_.load(std::memory_order_acquire);
     }
     FATAL_INVALID_ENUM_VALUE(TransactionState, current_state);
   }
@@ -1181,6 +1365,59 @@ class YBTransaction::Impl final : public internal::TxnBatcherIf {
     callback(child_txn_data_pb);
   }
 
+  // Whether tablet server that leads the tablet reported that it has transaction sealing enabled.
+  static bool LeaderSupportsSealing(const internal::RemoteTablet& tablet) {
+    auto* leader = tablet.LeaderTServer();
+    return leader && leader->HasCapability(CAPABILITY_TransactionSealing);
+  }
+
+  // Whether transaction could be sealed while its requests are still running, see
+  // transaction_parallel_commit. Sealing should be enabled on the status tablet and on all tablets
+  // where transaction wrote so far.
+  bool CanCommitInParallelUnlocked() REQUIRES(mutex_) {
+    return GetAtomicFlag(&FLAGS_transaction_parallel_commit) && ready_ && sealing_supported_ &&
+           LeaderSupportsSealing(*status_tablet_);
+  }
+
+  // Transaction was sealed by parallel commit, but one of the requests that were running during
+  // sealing requires read restart, so the transaction should not be committed. Coordinator aborts
+  // sealed transaction only when some of its batches are not replicated yet, otherwise it is
+  // committed and commit is reported as successful.
+  void AbortSealed(CommitCallback commit_callback) EXCLUDES(mutex_) {
+    VLOG_WITH_PREFIX(2) << "Abort sealed transaction that requires restart";
+    auto transaction = transaction_->shared_from_this();
+    decltype(status_tablet_) status_tablet;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      status_tablet = status_tablet_;
+    }
+    tserver::AbortTransactionRequestPB req;
+    req.set_tablet_id(status_tablet->tablet_id());
+    req.set_propagated_hybrid_time(manager_->Now().ToUint64());
+    req.set_transaction_id(metadata_.transaction_id.data(), metadata_.transaction_id.size());
+
+    manager_->rpcs().RegisterAndStart(
+        AbortTransaction(
+            TransactionRpcDeadline(),
+            status_tablet.get(),
+            manager_->client(),
+            &req,
+            [this, transaction, commit_callback = std::move(commit_callback)](
+                const Status& status, const tserver::AbortTransactionResponsePB& response) {
+              AbortDone(status, response, transaction);
+              if (!status.ok()) {
+                commit_callback(status);
+              } else if (response.status() == TransactionStatus::COMMITTED) {
+                VLOG_WITH_PREFIX(2) << "Sealed transaction was committed";
+                commit_callback(Status::OK());
+              } else {
+                commit_callback(STATUS(
+                    IllegalState, "Commit of transaction that requires restart is not allowed"));
+              }
+            }),
+        &abort_handle_);
+  }
+
   CHECKED_STATUS CheckCouldCommitUnlocked(SealOnly seal_only) REQUIRES(mutex_) {
     RETURN_NOT_OK(CheckRunningUnlocked());
     if (child_) {
@@ -1258,6 +1495,15 @@ class YBTransaction::Impl final : public internal::TxnBatcherIf {
   // We might need to fix this before turning on transactions sealing.
   // https://github.com/yugabyte/yugabyte-db/issues/7984.
   size_t running_requests_ GUARDED_BY(mutex_) = 0;
+  // Whether leaders of all tablets where transaction wrote reported that they have transaction
+  // sealing enabled.
+  bool sealing_supported_ GUARDED_BY(mutex_) = true;
+  // Whether leaders of all tablets where transaction wrote reported that they support single
+  // tablet commit.
+  bool single_tablet_commit_supported_ GUARDED_BY(mutex_) = true;
+  // Set while commit request is sent directly to the participant tablet, heartbeats are sent
+  // during this time.
+  std::atomic<bool> single_tablet_commit_in_progress_{false};
   // Set to true after commit record is replicated. Used only during transaction sealing.
   bool commit_replicated_ = false;
 };
@@ -0,0 +1,233 @@
+// Copyright (c) YugaByte, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+// in compliance with the License.  You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied.  See the License for the specific language governing permissions and limitations
+// under the License.
+//
+
+#include "yb/client/transaction_heartbeat_batcher.h"
+
+#include "yb/client/meta_cache.h"
+
+#include "yb/common/wire_protocol.h"
+
+#include "yb/tserver/tserver_service.pb.h"
+
+#include "yb/util/format.h"
+#include "yb/util/logging.h"
+#include "yb/util/status_format.h"
+
+namespace yb {
+namespace client {
+
+class TransactionHeartbeatBatcher::Command : public rpc::RpcCommand {
+ public:
+  Command(TransactionHeartbeatBatcher* batcher, CoarseTimePoint deadline,
+          const internal::RemoteTabletPtr& status_tablet,
+          tserver::UpdateTransactionRequestPB* req, UpdateTransactionCallback callback)
+      : batcher_(batcher), deadline_(deadline), status_tablet_(status_tablet),
+        callback_(std::move(callback)) {
+    req_.Swap(req);
+  }
+
+  void SendRpc() override {
+    batcher_->Enqueue(std::static_pointer_cast<Command>(shared_from_this()));
+  }
+
+  std::string ToString() const override {
+    return Format("Batched heartbeat: $0", req_.ShortDebugString());
+  }
+
+  void Finished(const Status& status) override {
+    Done(status, tserver::UpdateTransactionResponsePB());
+  }
+
+  void Abort() override {
+    batcher_->Abort(this);
+  }
+
+  CoarseTimePoint deadline() const override {
+    return deadline_;
+  }
+
+  const internal::RemoteTabletPtr& status_tablet() const {
+    return status_tablet_;
+  }
+
+  const TabletId& status_tablet_id() const {
+    return req_.tablet_id();
+  }
+
+  const tserver::UpdateTransactionRequestPB& request() const {
+    return req_;
+  }
+
+  void Done(const Status& status, const tserver::UpdateTransactionResponsePB& response) {
+    callback_(status, req_, response);
+  }
+
+ private:
+  TransactionHeartbeatBatcher* const batcher_;
+  const CoarseTimePoint deadline_;
+  const internal::RemoteTabletPtr status_tablet_;
+  tserver::UpdateTransactionRequestPB req_;
+  UpdateTransactionCallback callback_;
+};
+
+TransactionHeartbeatBatcher::TransactionHeartbeatBatcher(YBClient* client) : client_(client) {
+}
+
+TransactionHeartbeatBatcher::~TransactionHeartbeatBatcher() {
+  Shutdown();
+}
+
+void TransactionHeartbeatBatcher::Shutdown() {
+  Batch aborted;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (closing_) {
+      return;
+    }
+    closing_ = true;
+    for (auto& queue : queues_) {
+      aborted.insert(aborted.end(), queue.second.queued.begin(), queue.second.queued.end());
+      queue.second.queued.clear();
+    }
+  }
+  for (const auto& command : aborted) {
+    command->Finished(STATUS(Aborted, "Transaction heartbeat batcher is shutting down"));
+  }
+  rpcs_.Shutdown();
+}
+
+rpc::RpcCommandPtr TransactionHeartbeatBatcher::Heartbeat(
+    CoarseTimePoint deadline, const internal::RemoteTabletPtr& status_tablet,
+    tserver::UpdateTransactionRequestPB* req, UpdateTransactionCallback callback) {
+  DCHECK_EQ(req->state().status(), TransactionStatus::PENDING);
+  return std::make_shared<Command>(this, deadline, status_tablet, req, std::move(callback));
+}
+
+void TransactionHeartbeatBatcher::Enqueue(const CommandPtr& command) {
+  Batch batch;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!closing_) {
+      auto& queue = queues_[command->status_tablet_id()];
+      queue.queued.push_back(command);
+      if (queue.in_flight) {
+        return;
+      }
+      queue.in_flight = true;
+      batch.swap(queue.queued);
+    }
+  }
+  if (batch.empty()) {
+    command->Finished(STATUS(Aborted, "Transaction heartbeat batcher is shutting down"));
+    return;
+  }
+  Send(std::move(batch));
+}
+
+void TransactionHeartbeatBatcher::Abort(Command* command) {
+  CommandPtr aborted;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = queues_.find(command->status_tablet_id());
+    if (it == queues_.end()) {
+      return;
+    }
+    auto& queued = it->second.queued;
+    for (auto i = queued.begin(); i != queued.end(); ++i) {
+      if (i->get() == command) {
+        aborted = std::move(*i);
+        queued.erase(i);
+        break;
+      }
+    }
+  }
+  // Heartbeat that is already sent will be completed with the response of its batch.
+  if (aborted) {
+    aborted->Finished(STATUS(Aborted, "Transaction heartbeat aborted"));
+  }
+}
+
+void TransactionHeartbeatBatcher::Send(Batch batch) {
+  tserver::HeartbeatTransactionsRequestPB req;
+  const auto& first = *batch.front();
+  req.set_tablet_id(first.status_tablet_id());
+  uint64_t propagated_hybrid_time = 0;
+  auto deadline = CoarseTimePoint::min();
+  for (const auto& command : batch) {
+    const auto& command_req = command->request();
+    req.add_transaction_id(command_req.state().transaction_id());
+    propagated_hybrid_time = std::max(
+        propagated_hybrid_time, command_req.propagated_hybrid_time());
+    deadline = std::max(deadline, command->deadline());
+  }
+  req.set_propagated_hybrid_time(propagated_hybrid_time);
+
+  VLOG(4) << "Send " << batch.size() << " heartbeats to " << req.tablet_id();
+
+  auto status_tablet = first.status_tablet();
+  auto handle = rpcs_.Prepare();
+  if (handle == rpcs_.InvalidHandle()) {
+    BatchDone(STATUS(Aborted, "Transaction heartbeat batcher is shutting down"),
+              tserver::HeartbeatTransactionsResponsePB(), batch);
+    return;
+  }
+  *handle = HeartbeatTransactions(
+      deadline,
+      status_tablet.get(),
+      client_,
+      &req,
+      [this, handle, batch = std::move(batch)](
+          const Status& status, const tserver::HeartbeatTransactionsResponsePB& response) {
+        rpcs_.Unregister(handle);
+        BatchDone(status, response, batch);
+      });
+  (**handle).SendRpc();
+}
+
+void TransactionHeartbeatBatcher::BatchDone(
+    const Status& status, const tserver::HeartbeatTransactionsResponsePB& response,
+    const Batch& batch) {
+  tserver::UpdateTransactionResponsePB command_response;
+  if (response.has_propagated_hybrid_time()) {
+    command_response.set_propagated_hybrid_time(response.propagated_hybrid_time());
+  }
+  for (size_t i = 0; i != batch.size(); ++i) {
+    Status command_status = status;
+    if (command_status.ok()) {
+      command_status = i < static_cast<size_t>(response.status().size())
+          ? StatusFromPB(response.status(i))
+          : STATUS_FORMAT(IllegalState, "Heartbeat result missing: $0",
+                          response.ShortDebugString());
+    }
+    batch[i]->Done(command_status, command_response);
+  }
+
+  // Send heartbeats that were queued while this batch was in flight.
+  Batch next_batch;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = queues_.find(batch.front()->status_tablet_id());
+    if (it == queues_.end()) {
+      return;
+    }
+    next_batch.swap(it->second.queued);
+    if (next_batch.empty()) {
+      queues_.erase(it);
+      return;
+    }
+  }
+  Send(std::move(next_batch));
+}
+
+} // namespace client
+} // namespace yb
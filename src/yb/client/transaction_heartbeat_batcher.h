@@ -0,0 +1,87 @@
+// Copyright (c) YugaByte, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+// in compliance with the License.  You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied.  See the License for the specific language governing permissions and limitations
+// under the License.
+//
+
+#ifndef YB_CLIENT_TRANSACTION_HEARTBEAT_BATCHER_H
+#define YB_CLIENT_TRANSACTION_HEARTBEAT_BATCHER_H
+
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "yb/client/client_fwd.h"
+#include "yb/client/transaction_rpc.h"
+
+#include "yb/common/entity_ids_types.h"
+
+#include "yb/rpc/rpc.h"
+
+#include "yb/util/thread_annotations.h"
+
+namespace yb {
+namespace client {
+
+// Sends heartbeats of pending transactions, merging heartbeats of all transactions of the same
+// status tablet into a single HeartbeatTransactions RPC.
+//
+// Heartbeat is sent immediately when there is no heartbeat RPC in flight to its status tablet.
+// Otherwise it is queued, and all queued heartbeats are sent together when response to the
+// previous RPC is received. So heartbeats are not delayed by batching, while the number of
+// heartbeat RPCs to each status tablet is limited to one per round trip.
+class TransactionHeartbeatBatcher {
+ public:
+  explicit TransactionHeartbeatBatcher(YBClient* client);
+  ~TransactionHeartbeatBatcher();
+
+  TransactionHeartbeatBatcher(const TransactionHeartbeatBatcher&) = delete;
+  void operator=(const TransactionHeartbeatBatcher&) = delete;
+
+  void Shutdown();
+
+  // Returns command that sends PENDING heartbeat specified by req, it should be started using
+  // rpc::Rpcs like regular transaction RPC. Callback is invoked with the same arguments as
+  // UpdateTransaction callback.
+  MUST_USE_RESULT rpc::RpcCommandPtr Heartbeat(
+      CoarseTimePoint deadline, const internal::RemoteTabletPtr& status_tablet,
+      tserver::UpdateTransactionRequestPB* req, UpdateTransactionCallback callback);
+
+ private:
+  class Command;
+  typedef std::shared_ptr<Command> CommandPtr;
+  typedef std::vector<CommandPtr> Batch;
+
+  struct StatusTabletQueue {
+    // Whether there is heartbeat RPC in flight to this status tablet.
+    bool in_flight = false;
+    Batch queued;
+  };
+
+  void Enqueue(const CommandPtr& command);
+  void Abort(Command* command);
+  void Send(Batch batch);
+  void BatchDone(
+      const Status& status, const tserver::HeartbeatTransactionsResponsePB& response,
+      const Batch& batch);
+
+  YBClient* const client_;
+  rpc::Rpcs rpcs_;
+
+  std::mutex mutex_;
+  bool closing_ GUARDED_BY(mutex_) = false;
+  std::unordered_map<TabletId, StatusTabletQueue> queues_ GUARDED_BY(mutex_);
+};
+
+} // namespace client
+} // namespace yb
+
+#endif // YB_CLIENT_TRANSACTION_HEARTBEAT_BATCHER_H
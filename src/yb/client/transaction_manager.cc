@@ -18,6 +18,7 @@
 #include "yb/client/client.h"
 #include "yb/client/meta_cache.h"
 #include "yb/client/table.h"
+#include "yb/client/transaction_heartbeat_batcher.h"
 #include "yb/client/yb_table_name.h"
 
 #include "yb/master/catalog_manager.h"
@@ -26,18 +27,26 @@
 
 #include "yb/server/server_base_options.h"
 
+#include "yb/util/flag_tags.h"
 #include "yb/util/format.h"
 #include "yb/util/status_format.h"
 #include "yb/util/status_log.h"
 #include "yb/util/string_util.h"
 #include "yb/util/thread_restrictions.h"
 
+using namespace std::placeholders;
+
 DEFINE_uint64(transaction_manager_workers_limit, 50,
               "Max number of workers used by transaction manager");
 
 DEFINE_uint64(transaction_manager_queue_limit, 500,
               "Max number of tasks used by transaction manager");
 
+DEFINE_bool(transaction_batch_heartbeats, false,
+            "Send heartbeats of all pending transactions of the same status tablet in a single "
+            "RPC. Requires all tablet servers to support HeartbeatTransactions RPC.");
+TAG_FLAG(transaction_batch_heartbeats, advanced);
+
 namespace yb {
 namespace client {
 
@@ -52,7 +61,8 @@ class TransactionTableState {
   }
 
   void InvokeCallback(const PickStatusTabletCallback& callback,
-                      TransactionLocality locality) EXCLUDES(mutex_) {
+                      TransactionLocality locality,
+                      const LocalTabletFilter& preferred_tablet_filter) EXCLUDES(mutex_) {
     SharedLock<yb::RWMutex> lock(mutex_);
     const auto& tablets = PickTabletList(locality);
     if (tablets.empty()) {
@@ -60,7 +70,11 @@ class TransactionTableState {
           IllegalState, "No $0 transaction tablets found", TransactionLocality_Name(locality)));
       return;
     }
-    if (PickStatusTabletId(tablets, callback)) {
+    if (preferred_tablet_filter &&
+        PickStatusTabletId(tablets, preferred_tablet_filter, callback)) {
+      return;
+    }
+    if (PickStatusTabletId(tablets, local_tablet_filter_, callback)) {
       return;
     }
     YB_LOG_EVERY_N_SECS(WARNING, 1) << "No placement local transaction status tablet found";
@@ -105,17 +119,18 @@ class TransactionTableState {
   // Picks a status tablet id from 'tablets' filtered by 'filter'. Returns true if a
   // tablet id was picked successfully, and false if there were no applicable tablet ids.
   bool PickStatusTabletId(const std::vector<TabletId>& tablets,
+                          const LocalTabletFilter& filter,
                           const PickStatusTabletCallback& callback) REQUIRES_SHARED(mutex_) {
     if (tablets.empty()) {
       return false;
     }
-    if (local_tablet_filter_) {
+    if (filter) {
       std::vector<const TabletId*> ids;
       ids.reserve(tablets.size());
       for (const auto& id : tablets) {
         ids.push_back(&id);
       }
-      local_tablet_filter_(&ids);
+      filter(&ids);
       if (!ids.empty()) {
         callback(*RandomElement(ids));
         return true;
@@ -166,9 +181,10 @@ class LoadStatusTabletsTask {
                         TransactionTableState* table_state,
                         uint64_t version,
                         PickStatusTabletCallback callback = PickStatusTabletCallback(),
-                        TransactionLocality locality = TransactionLocality::GLOBAL)
+                        TransactionLocality locality = TransactionLocality::GLOBAL,
+                        LocalTabletFilter preferred_tablet_filter = LocalTabletFilter())
       : client_(client), table_state_(table_state), version_(version), callback_(callback),
-        locality_(locality) {
+        locality_(locality), preferred_tablet_filter_(std::move(preferred_tablet_filter)) {
   }
 
   void Run() {
@@ -186,7 +202,7 @@ class LoadStatusTabletsTask {
     table_state_->UpdateStatusTablets(version_, std::move(*tablets));
 
     if (callback_) {
-      table_state_->InvokeCallback(callback_, locality_);
+      table_state_->InvokeCallback(callback_, locality_, preferred_tablet_filter_);
     }
   }
 
@@ -209,18 +225,21 @@ class LoadStatusTabletsTask {
   uint64_t version_;
   PickStatusTabletCallback callback_;
   TransactionLocality locality_;
+  LocalTabletFilter preferred_tablet_filter_;
 };
 
 class InvokeCallbackTask {
  public:
   InvokeCallbackTask(TransactionTableState* table_state,
                      PickStatusTabletCallback callback,
-                     TransactionLocality locality)
-      : table_state_(table_state), callback_(std::move(callback)), locality_(locality) {
+                     TransactionLocality locality,
+                     LocalTabletFilter preferred_tablet_filter)
+      : table_state_(table_state), callback_(std::move(callback)), locality_(locality),
+        preferred_tablet_filter_(std::move(preferred_tablet_filter)) {
   }
 
   void Run() {
-    table_state_->InvokeCallback(callback_, locality_);
+    table_state_->InvokeCallback(callback_, locality_, preferred_tablet_filter_);
   }
 
   void Done(const Status& status) {
@@ -234,6 +253,7 @@ class InvokeCallbackTask {
   TransactionTableState* table_state_;
   PickStatusTabletCallback callback_;
   TransactionLocality locality_;
+  LocalTabletFilter preferred_tablet_filter_;
 };
 } // namespace
 
@@ -250,6 +270,9 @@ class TransactionManager::Impl {
         tasks_pool_(FLAGS_transaction_manager_queue_limit),
         invoke_callback_tasks_(FLAGS_transaction_manager_queue_limit) {
     CHECK(clock);
+    if (FLAGS_transaction_batch_heartbeats) {
+      heartbeat_batcher_ = std::make_unique<TransactionHeartbeatBatcher>(client_);
+    }
   }
 
   ~Impl() {
@@ -268,12 +291,18 @@ class TransactionManager::Impl {
     }
   }
 
-  void PickStatusTablet(PickStatusTabletCallback callback, TransactionLocality locality) {
+  void PickStatusTablet(PickStatusTabletCallback callback, TransactionLocality locality,
+                        const std::string& preferred_leader_uuid) {
+    LocalTabletFilter preferred_tablet_filter;
+    if (!preferred_leader_uuid.empty()) {
+      preferred_tablet_filter = std::bind(
+          &YBClient::PreserveTabletsLedBy, client_, preferred_leader_uuid, _1);
+    }
     if (table_state_.IsInitialized()) {
       if (ThreadRestrictions::IsWaitAllowed()) {
-        table_state_.InvokeCallback(callback, locality);
+        table_state_.InvokeCallback(callback, locality, preferred_tablet_filter);
       } else if (!invoke_callback_tasks_.Enqueue(
-            &thread_pool_, &table_state_, callback, locality)) {
+            &thread_pool_, &table_state_, callback, locality, preferred_tablet_filter)) {
         callback(STATUS_FORMAT(ServiceUnavailable,
                                "Invoke callback queue overflow, number of tasks: $0",
                                invoke_callback_tasks_.size()));
@@ -297,7 +326,7 @@ class TransactionManager::Impl {
 
     if (!tasks_pool_.Enqueue(
         &thread_pool_, client_, &table_state_, status_tablets_version_.load(), callback,
-        locality)) {
+        locality, preferred_tablet_filter)) {
       callback(STATUS_FORMAT(ServiceUnavailable, "Tasks overflow, exists: $0", tasks_pool_.size()));
     }
   }
@@ -314,6 +343,10 @@ class TransactionManager::Impl {
     return rpcs_;
   }
 
+  TransactionHeartbeatBatcher* heartbeat_batcher() {
+    return heartbeat_batcher_.get();
+  }
+
   HybridTime Now() const {
     return clock_->Now();
   }
@@ -328,6 +361,9 @@ class TransactionManager::Impl {
 
   void Shutdown() {
     rpcs_.Shutdown();
+    if (heartbeat_batcher_) {
+      heartbeat_batcher_->Shutdown();
+    }
     thread_pool_.Shutdown();
   }
 
@@ -354,6 +390,7 @@ class TransactionManager::Impl {
   yb::rpc::TasksPool<LoadStatusTabletsTask> tasks_pool_;
   yb::rpc::TasksPool<InvokeCallbackTask> invoke_callback_tasks_;
   yb::rpc::Rpcs rpcs_;
+  std::unique_ptr<TransactionHeartbeatBatcher> heartbeat_batcher_;
 };
 
 TransactionManager::TransactionManager(
@@ -368,8 +405,9 @@ void TransactionManager::UpdateTxnTableVersionsHash(uint64_t hash) {
 }
 
 void TransactionManager::PickStatusTablet(
-    PickStatusTabletCallback callback, TransactionLocality locality) {
-  impl_->PickStatusTablet(std::move(callback), locality);
+    PickStatusTabletCallback callback, TransactionLocality locality,
+    const std::string& preferred_leader_uuid) {
+  impl_->PickStatusTablet(std::move(callback), locality, preferred_leader_uuid);
 }
 
 YBClient* TransactionManager::client() const {
@@ -380,6 +418,10 @@ rpc::Rpcs& TransactionManager::rpcs() {
   return impl_->rpcs();
 }
 
+TransactionHeartbeatBatcher* TransactionManager::heartbeat_batcher() {
+  return impl_->heartbeat_batcher();
+}
+
 const scoped_refptr<ClockBase>& TransactionManager::clock() const {
   return impl_->clock();
 }
@@ -50,11 +50,17 @@ class TransactionManager {
   // manager, and the old list of cached tablets will be used.
   void UpdateTxnTableVersionsHash(uint64_t hash);
 
-  void PickStatusTablet(PickStatusTabletCallback callback, TransactionLocality locality);
+  // When preferred_leader_uuid is not empty, status tablet led by this tablet server is picked if
+  // there is such tablet according to the meta cache.
+  void PickStatusTablet(PickStatusTabletCallback callback, TransactionLocality locality,
+                        const std::string& preferred_leader_uuid = std::string());
 
   rpc::Rpcs& rpcs();
   YBClient* client() const;
 
+  // Batches heartbeats of pending transactions, null when transaction_batch_heartbeats is not set.
+  TransactionHeartbeatBatcher* heartbeat_batcher();
+
   const scoped_refptr<ClockBase>& clock() const;
   HybridTime Now() const;
   HybridTimeRange NowRange() const;
@@ -27,6 +27,7 @@
 #include "yb/rpc/messenger.h"
 #include "yb/rpc/scheduler.h"
 
+#include "yb/util/atomic.h"
 #include "yb/util/flag_tags.h"
 #include "yb/util/metrics.h"
 #include "yb/util/result.h"
@@ -34,6 +35,8 @@
 using namespace std::literals;
 using namespace std::placeholders;
 
+DECLARE_bool(transaction_colocate_status_tablet);
+
 DEFINE_int32(transaction_pool_cleanup_interval_ms, 5000,
              "How frequently we should cleanup transaction pool");
 
@@ -101,6 +104,11 @@ class SingleLocalityPool {
   }
 
   YBTransactionPtr Take() {
+    if (GetAtomicFlag(&FLAGS_transaction_colocate_status_tablet)) {
+      // Status tablet of prepared transaction is already picked, so it could not be colocated
+      // with the first write of the transaction.
+      return std::make_shared<YBTransaction>(&manager_, locality_);
+    }
     YBTransactionPtr result, new_txn;
     uint64_t old_taken;
     IncrementCounter(cache_queries_);
@@ -289,6 +297,10 @@ class TransactionPool::Impl {
     std::lock_guard<std::mutex> lock(mutex_);
     return last_transaction_;
   }
+
+  TransactionManager& manager() const {
+    return *manager_;
+  }
  private:
   TransactionManager* manager_;
   SingleLocalityPool global_pool_;
@@ -331,5 +343,9 @@ YBTransactionPtr TransactionPool::GetLastTransaction() {
   return impl_->GetLastTransaction();
 }
 
+TransactionManager& TransactionPool::manager() const {
+  return impl_->manager();
+}
+
 } // namespace client
 } // namespace yb
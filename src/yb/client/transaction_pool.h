@@ -58,6 +58,9 @@ class TransactionPool {
   // TEST_track_last_transaction gflag is set.
   YBTransactionPtr GetLastTransaction();
 
+  // Manager used to create transactions of this pool.
+  TransactionManager& manager() const;
+
  private:
   class Impl;
   std::unique_ptr<Impl> impl_;
@@ -487,6 +487,8 @@ class YBPgsqlWriteOp : public YBPgsqlOp {
 
   bool IsTransactional() const override;
 
+  bool is_single_row_txn() const { return is_single_row_txn_; }
+
   void set_is_single_row_txn(bool is_single_row_txn) {
     is_single_row_txn_ = is_single_row_txn;
   }
@@ -494,6 +496,12 @@ class YBPgsqlWriteOp : public YBPgsqlOp {
   const HybridTime& write_time() const { return write_time_; }
   void SetWriteTime(const HybridTime& value) { write_time_ = value; }
 
+  bool check_read_time_conflicts() const { return check_read_time_conflicts_; }
+
+  // Marks this operation as part of atomic single tablet write, that is executed without
+  // transaction. Tablet fails such write if any of its rows were modified after the read time.
+  void set_check_read_time_conflicts(bool value) { check_read_time_conflicts_ = value; }
+
   static std::unique_ptr<YBPgsqlWriteOp> NewInsert(const YBTablePtr& table);
   static std::unique_ptr<YBPgsqlWriteOp> NewUpdate(const YBTablePtr& table);
   static std::unique_ptr<YBPgsqlWriteOp> NewDelete(const YBTablePtr& table);
@@ -510,6 +518,7 @@ class YBPgsqlWriteOp : public YBPgsqlOp {
   // Else could be distributed transaction (or non-transactional) depending on target table type.
   bool is_single_row_txn_ = false;
   HybridTime write_time_;
+  bool check_read_time_conflicts_ = false;
 };
 
 class YBPgsqlReadOp : public YBPgsqlOp {
@@ -149,6 +149,9 @@ void TableProperties::ToTablePropertiesPB(TablePropertiesPB *pb) const {
   }
   pb->set_is_ysql_catalog_table(is_ysql_catalog_table_);
   pb->set_retain_delete_markers(retain_delete_markers_);
+  if (compaction_time_window_ms_) {
+    pb->set_compaction_time_window_ms(*compaction_time_window_ms_);
+  }
 }
 
 TableProperties TableProperties::FromTablePropertiesPB(const TablePropertiesPB& pb) {
@@ -180,6 +183,9 @@ TableProperties TableProperties::FromTablePropertiesPB(const TablePropertiesPB&
   if (pb.has_retain_delete_markers()) {
     table_properties.SetRetainDeleteMarkers(pb.retain_delete_markers());
   }
+  if (pb.has_compaction_time_window_ms()) {
+    table_properties.SetCompactionTimeWindow(pb.compaction_time_window_ms());
+  }
   return table_properties;
 }
 
@@ -208,6 +214,9 @@ void TableProperties::AlterFromTablePropertiesPB(const TablePropertiesPB& pb) {
   if (pb.has_retain_delete_markers()) {
     SetRetainDeleteMarkers(pb.retain_delete_markers());
   }
+  if (pb.has_compaction_time_window_ms()) {
+    SetCompactionTimeWindow(pb.compaction_time_window_ms());
+  }
 }
 
 void TableProperties::Reset() {
@@ -220,6 +229,7 @@ void TableProperties::Reset() {
   num_tablets_ = 0;
   is_ysql_catalog_table_ = false;
   retain_delete_markers_ = false;
+  compaction_time_window_ms_.reset();
 }
 
 string TableProperties::ToString() const {
@@ -232,6 +242,9 @@ string TableProperties::ToString() const {
   if (HasCopartitionTableId()) {
     result += Format("copartition_table_id: $0 ", copartition_table_id_);
   }
+  if (HasCompactionTimeWindow()) {
+    result += Format("compaction_time_window_ms: $0 ", CompactionTimeWindow());
+  }
   return result + Format(
       "consistency_level: $0 is_ysql_catalog_table: $1 }",
       consistency_level_,
@@ -302,7 +302,8 @@ class TableProperties {
 
     return default_time_to_live_ == other.default_time_to_live_ &&
            use_mangled_column_name_ == other.use_mangled_column_name_ &&
-           contain_counters_ == other.contain_counters_;
+           contain_counters_ == other.contain_counters_ &&
+           CompactionTimeWindow() == other.CompactionTimeWindow();
 
     // Ignoring num_tablets_.
     // Ignoring retain_delete_markers_.
@@ -338,6 +339,7 @@ class TableProperties {
     // Ignoring contain_counters_.
     // Ignoring retain_delete_markers_.
     // Ignoring wal_retention_secs_.
+    // Ignoring compaction_time_window_ms_.
     return true;
   }
 
@@ -425,6 +427,19 @@ class TableProperties {
     retain_delete_markers_ = retain_delete_markers;
   }
 
+  bool HasCompactionTimeWindow() const {
+    return CompactionTimeWindow() != 0;
+  }
+
+  // Width of the time window for time-window compaction in milliseconds, 0 disables it.
+  void SetCompactionTimeWindow(uint64_t compaction_time_window_ms) {
+    compaction_time_window_ms_ = compaction_time_window_ms;
+  }
+
+  uint64_t CompactionTimeWindow() const {
+    return compaction_time_window_ms_.get_value_or(0);
+  }
+
   void ToTablePropertiesPB(TablePropertiesPB *pb) const;
 
   static TableProperties FromTablePropertiesPB(const TablePropertiesPB& pb);
@@ -451,6 +466,8 @@ class TableProperties {
   bool use_mangled_column_name_ = false;
   int num_tablets_ = 0;
   bool is_ysql_catalog_table_ = false;
+  // Not set when the time window was not specified, so alter does not change it.
+  boost::optional<uint64_t> compaction_time_window_ms_;
 };
 
 // The schema for a set of rows.
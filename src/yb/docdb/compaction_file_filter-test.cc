@@ -27,6 +27,7 @@
 #include "yb/docdb/doc_ttl_util.h"
 #include "yb/docdb/docdb_compaction_filter.h"
 #include "yb/docdb/primitive_value.h"
+#include "yb/docdb/value.h"
 
 #include "yb/rocksdb/compaction_filter.h"
 #include "yb/rocksdb/db/version_edit.h"
@@ -477,5 +478,37 @@ TEST_F(ExpirationFilterTest, TestFilterMixTableAndValueTTLWithTrustValueTTLFlag)
   TestFilterFilesAgainstResults(&factory, frontiers, expected_results);
 }
 
+TEST_F(ExpirationFilterTest, TestTimeWindowFunction) {
+  DocDBCompactionFileFilterFactory factory =
+      DocDBCompactionFileFilterFactory(retention_policy_, clock_);
+  SetRetentionPolicy(retention_policy_, MonoDelta::FromSeconds(100));
+  // Time windows are disabled by default.
+  ASSERT_FALSE(factory.GetTimeWindowFunction());
+
+  retention_policy_->SetCompactionTimeWindowForTests(MonoDelta::FromSeconds(10));
+  auto time_window_function = factory.GetTimeWindowFunction();
+  ASSERT_TRUE(time_window_function);
+
+  const auto window_start = HybridTime::FromMicros(1000 * MonoTime::kMicrosecondsPerSecond);
+  auto files = CreateFilePtrs({
+    CreateConsensusFrontier(window_start),
+    CreateConsensusFrontier(window_start.AddSeconds(9)),
+    CreateConsensusFrontier(window_start.AddSeconds(10)),
+    CreateConsensusFrontier(window_start.AddSeconds(25)),
+  });
+  EXPECT_EQ(time_window_function(*files[0]), time_window_function(*files[1]));
+  EXPECT_EQ(time_window_function(*files[0]) + 1, time_window_function(*files[2]));
+  EXPECT_EQ(time_window_function(*files[0]) + 2, time_window_function(*files[3]));
+  DeleteFilePtrs(&files);
+
+  // Time windows are not used by tables without default TTL.
+  SetRetentionPolicy(retention_policy_, Value::kMaxTtl);
+  ASSERT_FALSE(factory.GetTimeWindowFunction());
+
+  retention_policy_->SetCompactionTimeWindowForTests(MonoDelta());
+  SetRetentionPolicy(retention_policy_, MonoDelta::FromSeconds(100));
+  ASSERT_FALSE(factory.GetTimeWindowFunction());
+}
+
 }  // namespace docdb
 }  // namespace yb
@@ -20,6 +20,7 @@
 #include "yb/docdb/consensus_frontier.h"
 #include "yb/docdb/doc_ttl_util.h"
 #include "yb/docdb/docdb_compaction_filter.h"
+#include "yb/docdb/value.h"
 
 #include "yb/gutil/casts.h"
 
@@ -190,6 +191,22 @@ unique_ptr<CompactionFileFilter> DocDBCompactionFileFilterFactory::CreateCompact
       table_ttl, history_cutoff, min_kept_ht, filter_ht, mode);
 }
 
+std::function<uint64_t(const FileMetaData&)>
+    DocDBCompactionFileFilterFactory::GetTimeWindowFunction() {
+  const auto retention = retention_policy_->GetRetentionDirective();
+  const auto& time_window = retention.compaction_time_window;
+  // Without table TTL files of old windows are never dropped, so there is no reason to keep them
+  // apart.
+  if (!time_window.Initialized() || time_window <= MonoDelta::kZero ||
+      retention.table_ttl.Equals(Value::kMaxTtl)) {
+    return nullptr;
+  }
+  const uint64_t time_window_us = time_window.ToMicroseconds();
+  return [time_window_us](const FileMetaData& file) -> uint64_t {
+    return ExtractExpirationTime(&file).created_ht.GetPhysicalValueMicros() / time_window_us;
+  };
+}
+
 const char* DocDBCompactionFileFilterFactory::Name() const {
   return "DocDBCompactionFileFilterFactory";
 }
@@ -98,6 +98,10 @@ class DocDBCompactionFileFilterFactory : public rocksdb::CompactionFileFilterFac
   std::unique_ptr<rocksdb::CompactionFileFilter> CreateCompactionFileFilter(
       const std::vector<rocksdb::FileMetaData*>& inputs) override;
 
+  // Buckets files by the physical part of their max hybrid time when table has both compaction time
+  // window and default TTL set.
+  std::function<uint64_t(const rocksdb::FileMetaData&)> GetTimeWindowFunction() override;
+
   const char* Name() const override;
 
  private:
@@ -702,10 +702,12 @@ class ConflictResolverContextBase : public ConflictResolverContext {
  public:
   ConflictResolverContextBase(const DocOperations& doc_ops,
                               HybridTime resolution_ht,
-                              Counter* conflicts_metric)
+                              Counter* conflicts_metric,
+                              TransactionIdSet* blockers = nullptr)
       : doc_ops_(doc_ops),
         resolution_ht_(resolution_ht),
-        conflicts_metric_(conflicts_metric) {
+        conflicts_metric_(conflicts_metric),
+        blockers_(blockers) {
   }
 
   const DocOperations& doc_ops() {
@@ -742,17 +744,31 @@ class ConflictResolverContextBase : public ConflictResolverContext {
         transactions[i].priority = ids_and_priorities[i].second;
       }
     }
+    const TransactionId* blocker = nullptr;
     for (const auto& transaction : transactions) {
       auto their_priority = transaction.priority;
       if (transaction.wait_policy == WAIT_SKIP) {
+        if (blockers_) {
+          blockers_->clear();
+        }
         return STATUS(InternalError, "Skip locking since entity is already locked",
                       TransactionError(TransactionErrorCode::kSkipLocking));
       }
       if (our_priority < their_priority) {
-        return MakeConflictStatus(
-            our_transaction_id, transaction.id, "higher priority", GetConflictsMetric());
+        // When caller is able to wait, collect all transactions with higher priority, so caller
+        // could wait for them.
+        if (!blockers_) {
+          return MakeConflictStatus(
+              our_transaction_id, transaction.id, "higher priority", GetConflictsMetric());
+        }
+        blockers_->insert(transaction.id);
+        blocker = &transaction.id;
       }
     }
+    if (blocker) {
+      return MakeConflictStatus(
+          our_transaction_id, *blocker, "higher priority", GetConflictsMetric());
+    }
     fetched_metadata_for_transactions_ = true;
 
     return Status::OK();
@@ -767,6 +783,9 @@ class ConflictResolverContextBase : public ConflictResolverContext {
   bool fetched_metadata_for_transactions_ = false;
 
   Counter* conflicts_metric_ = nullptr;
+
+  // When not null, filled with ids of transactions with higher priority that we conflict with.
+  TransactionIdSet* blockers_ = nullptr;
 };
 
 // Utility class for ResolveTransactionConflicts implementation.
@@ -776,8 +795,9 @@ class TransactionConflictResolverContext : public ConflictResolverContextBase {
                                      const KeyValueWriteBatchPB& write_batch,
                                      HybridTime resolution_ht,
                                      HybridTime read_time,
-                                     Counter* conflicts_metric)
-      : ConflictResolverContextBase(doc_ops, resolution_ht, conflicts_metric),
+                                     Counter* conflicts_metric,
+                                     TransactionIdSet* blockers)
+      : ConflictResolverContextBase(doc_ops, resolution_ht, conflicts_metric, blockers),
         write_batch_(write_batch),
         read_time_(read_time),
         transaction_id_(FullyDecodeTransactionId(write_batch.transaction().transaction_id()))
@@ -954,8 +974,10 @@ class OperationConflictResolverContext : public ConflictResolverContextBase {
  public:
   OperationConflictResolverContext(const DocOperations* doc_ops,
                                    HybridTime resolution_ht,
+                                   HybridTime read_time,
                                    Counter* conflicts_metric)
-      : ConflictResolverContextBase(*doc_ops, resolution_ht, conflicts_metric) {
+      : ConflictResolverContextBase(*doc_ops, resolution_ht, conflicts_metric),
+        read_time_(read_time) {
   }
 
   virtual ~OperationConflictResolverContext() {}
@@ -968,9 +990,28 @@ class OperationConflictResolverContext : public ConflictResolverContextBase {
 
     IntentTypeSet strong_intent_types;
 
-    EnumerateIntentsCallback callback = [&strong_intent_types, resolver](
+    const auto transaction_id = TransactionId::Nil();
+    KeyBytes checker_buffer;
+    boost::optional<StrongConflictChecker> checker;
+    if (read_time_ != HybridTime::kMax) {
+      checker.emplace(
+          transaction_id, read_time_, resolver, GetConflictsMetric(), &checker_buffer);
+      // Iterator on intents DB should be created before iterator on regular DB, see
+      // TransactionConflictResolverContext::ReadConflicts.
+      resolver->EnsureIntentIteratorCreated();
+    }
+
+    EnumerateIntentsCallback callback = [&strong_intent_types, resolver, &checker](
         IntentStrength intent_strength, FullDocKey full_doc_key, Slice,
-        KeyBytes* encoded_key_buffer, LastKey) {
+        KeyBytes* encoded_key_buffer, LastKey) -> Status {
+      if (checker) {
+        // Operation was executed against snapshot at read_time_, so it should not overwrite
+        // records written after this time.
+        const bool strong = intent_strength == IntentStrength::kStrong;
+        if (strong || full_doc_key) {
+          RETURN_NOT_OK(checker->Check(encoded_key_buffer->AsSlice(), strong, WAIT_ERROR));
+        }
+      }
       return resolver->ReadIntentConflicts(
           intent_strength == IntentStrength::kStrong ? strong_intent_types
                                                      : StrongToWeak(strong_intent_types),
@@ -1020,11 +1061,21 @@ class OperationConflictResolverContext : public ConflictResolverContextBase {
   Result<bool> CheckConflictWithCommitted(
       const TransactionData& transaction_data, HybridTime commit_time) override {
     if (commit_time != HybridTime::kMax) {
+      if (read_time_ != HybridTime::kMax && !transaction_data.all_lock_only_conflicts &&
+          commit_time >= read_time_) {
+        return MakeConflictStatus(
+            TransactionId::Nil(), transaction_data.id, "committed", GetConflictsMetric());
+      }
       MakeResolutionAtLeast(commit_time);
       return true;
     }
     return false;
   }
+
+ private:
+  // Read time used to execute operations, HybridTime::kMax when operations are not bound to
+  // a snapshot and conflicts with committed records should not be checked.
+  const HybridTime read_time_;
 };
 
 } // namespace
@@ -1037,11 +1088,12 @@ void ResolveTransactionConflicts(const DocOperations& doc_ops,
                                  PartialRangeKeyIntents partial_range_key_intents,
                                  TransactionStatusManager* status_manager,
                                  Counter* conflicts_metric,
+                                 TransactionIdSet* blockers,
                                  ResolutionCallback callback) {
   DCHECK(hybrid_time.is_valid());
   TRACE("ResolveTransactionConflicts");
   auto context = std::make_unique<TransactionConflictResolverContext>(
-      doc_ops, write_batch, hybrid_time, read_time, conflicts_metric);
+      doc_ops, write_batch, hybrid_time, read_time, conflicts_metric, blockers);
   auto resolver = std::make_shared<ConflictResolver>(
       doc_db, status_manager, partial_range_key_intents, std::move(context), std::move(callback));
   // Resolve takes a self reference to extend lifetime.
@@ -1051,14 +1103,15 @@ void ResolveTransactionConflicts(const DocOperations& doc_ops,
 
 void ResolveOperationConflicts(const DocOperations& doc_ops,
                                HybridTime resolution_ht,
+                               HybridTime read_time,
                                const DocDB& doc_db,
                                PartialRangeKeyIntents partial_range_key_intents,
                                TransactionStatusManager* status_manager,
                                Counter* conflicts_metric,
                                ResolutionCallback callback) {
   TRACE("ResolveOperationConflicts");
-  auto context = std::make_unique<OperationConflictResolverContext>(&doc_ops, resolution_ht,
-                                                                    conflicts_metric);
+  auto context = std::make_unique<OperationConflictResolverContext>(
+      &doc_ops, resolution_ht, read_time, conflicts_metric);
   auto resolver = std::make_shared<ConflictResolver>(
       doc_db, status_manager, partial_range_key_intents, std::move(context), std::move(callback));
   // Resolve takes a self reference to extend lifetime.
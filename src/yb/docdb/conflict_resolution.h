@@ -48,6 +48,8 @@ using ResolutionCallback = boost::function<void(const Result<HybridTime>&)>;
 // db - db that contains tablet data.
 // status_manager - status manager that should be used during this conflict resolution.
 // conflicts_metric - transaction_conflicts metric to update.
+// blockers - when not null and resolution fails because of conflict with transactions of higher
+//            priority, it is filled with ids of those transactions, so caller could wait for them.
 void ResolveTransactionConflicts(const DocOperations& doc_ops,
                                  const KeyValueWriteBatchPB& write_batch,
                                  HybridTime resolution_ht,
@@ -56,6 +58,7 @@ void ResolveTransactionConflicts(const DocOperations& doc_ops,
                                  PartialRangeKeyIntents partial_range_key_intents,
                                  TransactionStatusManager* status_manager,
                                  Counter* conflicts_metric,
+                                 TransactionIdSet* blockers,
                                  ResolutionCallback callback);
 
 // Resolves conflicts for doc operations.
@@ -68,10 +71,14 @@ void ResolveTransactionConflicts(const DocOperations& doc_ops,
 //
 // doc_ops - doc operations that would be applied as part of operation.
 // resolution_ht - current hybrid time. Used to request status of conflicting transactions.
+// read_time - read time of the snapshot that operations were based on. When specified, records
+//             written after this time, including commits of conflicting transactions, are also
+//             treated as conflicts. HybridTime::kMax if operations are not bound to a snapshot.
 // db - db that contains tablet data.
 // status_manager - status manager that should be used during this conflict resolution.
 void ResolveOperationConflicts(const DocOperations& doc_ops,
                                HybridTime resolution_ht,
+                               HybridTime read_time,
                                const DocDB& doc_db,
                                PartialRangeKeyIntents partial_range_key_intents,
                                TransactionStatusManager* status_manager,
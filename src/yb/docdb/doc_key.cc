@@ -1193,6 +1193,10 @@ DocDbAwareV3FilterPolicy::GetKeyTransformer() const {
   return &DocKeyComponentsExtractor<DocKeyPart::kUpToHashOrFirstRange>::GetInstance();
 }
 
+const rocksdb::FilterPolicy::KeyTransformer* DocKeyDataBlockHashIndexKeyTransformer() {
+  return &DocKeyComponentsExtractor<DocKeyPart::kWholeDocKey>::GetInstance();
+}
+
 DocKeyEncoderAfterTableIdStep DocKeyEncoder::CotableId(const Uuid& cotable_id) {
   if (!cotable_id.IsNil()) {
     std::string bytes;
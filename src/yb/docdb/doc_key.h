@@ -869,6 +869,11 @@ class DocDbAwareV3FilterPolicy : public DocDbAwareFilterPolicyBase {
   const KeyTransformer* GetKeyTransformer() const override;
 };
 
+// Returns key transformer extracting the whole encoded DocKey from the key, used as hash index key
+// for RocksDB data block hash index (see rocksdb::DataBlockHashIndex). Returns empty key for
+// non-DocKey keys, so they are not indexed.
+const rocksdb::FilterPolicy::KeyTransformer* DocKeyDataBlockHashIndexKeyTransformer();
+
 }  // namespace docdb
 }  // namespace yb
 
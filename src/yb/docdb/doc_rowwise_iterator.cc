@@ -1056,6 +1056,29 @@ Status DocRowwiseIterator::Init(TableType table_type) {
   return Status::OK();
 }
 
+Status DocRowwiseIterator::InitForTuples(
+    const std::vector<Slice>& tuple_ids, rocksdb::QueryId query_id) {
+  std::vector<std::string> tuple_keys;
+  tuple_keys.reserve(tuple_ids.size());
+  for (const auto& tuple_id : tuple_ids) {
+    tuple_keys.push_back(TupleKey(tuple_id).ToBuffer());
+  }
+  db_iter_ = CreateIntentAwareIterator(
+      doc_db_,
+      std::vector<Slice>(tuple_keys.begin(), tuple_keys.end()),
+      query_id,
+      txn_op_context_,
+      deadline_,
+      read_time_);
+  // Iterator is positioned by SeekTuple, which also bounds it by the sought tuple.
+  row_ready_ = false;
+  has_bound_key_ = false;
+  ignore_ttl_ = true;
+  bound_by_tuple_ = true;
+
+  return Status::OK();
+}
+
 Result<bool> DocRowwiseIterator::InitScanChoices(
     const DocQLScanSpec& doc_spec, const KeyBytes& lower_doc_key, const KeyBytes& upper_doc_key) {
 
@@ -1435,32 +1458,45 @@ Result<Slice> DocRowwiseIterator::GetTupleId() const {
   return tuple_id;
 }
 
-Result<bool> DocRowwiseIterator::SeekTuple(const Slice& tuple_id) {
+Slice DocRowwiseIterator::TupleKey(const Slice& tuple_id) {
   // If cotable id / pgtable id is present in the table schema, then
   // we need to prepend it in the tuple key to seek.
-  if (schema_.has_cotable_id() || schema_.has_pgtable_id()) {
-    uint32_t size = schema_.has_pgtable_id() ? sizeof(PgTableOid) : kUuidSize;
-    if (!tuple_key_) {
-      tuple_key_.emplace();
-      tuple_key_->Reserve(1 + size + tuple_id.size());
-
-      if (schema_.has_cotable_id()) {
-        std::string bytes;
-        schema_.cotable_id().EncodeToComparable(&bytes);
-        tuple_key_->AppendValueType(ValueType::kTableId);
-        tuple_key_->AppendRawBytes(bytes);
-      } else {
-        tuple_key_->AppendValueType(ValueType::kPgTableOid);
-        tuple_key_->AppendUInt32(schema_.pgtable_id());
-      }
+  if (!schema_.has_cotable_id() && !schema_.has_pgtable_id()) {
+    return tuple_id;
+  }
+  uint32_t size = schema_.has_pgtable_id() ? sizeof(PgTableOid) : kUuidSize;
+  if (!tuple_key_) {
+    tuple_key_.emplace();
+    tuple_key_->Reserve(1 + size + tuple_id.size());
+
+    if (schema_.has_cotable_id()) {
+      std::string bytes;
+      schema_.cotable_id().EncodeToComparable(&bytes);
+      tuple_key_->AppendValueType(ValueType::kTableId);
+      tuple_key_->AppendRawBytes(bytes);
     } else {
-      tuple_key_->Truncate(1 + size);
+      tuple_key_->AppendValueType(ValueType::kPgTableOid);
+      tuple_key_->AppendUInt32(schema_.pgtable_id());
     }
-    tuple_key_->AppendRawBytes(tuple_id);
-    db_iter_->Seek(*tuple_key_);
   } else {
-    db_iter_->Seek(tuple_id);
+    tuple_key_->Truncate(1 + size);
+  }
+  tuple_key_->AppendRawBytes(tuple_id);
+  return tuple_key_->AsSlice();
+}
+
+Result<bool> DocRowwiseIterator::SeekTuple(const Slice& tuple_id) {
+  const auto tuple_key = TupleKey(tuple_id);
+  if (bound_by_tuple_) {
+    // Read only the sought tuple, so HasNext does not walk through the following rows when the
+    // tuple is missing or deleted.
+    bound_key_.Reset(tuple_key);
+    bound_key_.AppendValueType(ValueType::kHighest);
+    has_bound_key_ = true;
+    done_ = false;
+    db_iter_->SetUpperbound(bound_key_);
   }
+  db_iter_->Seek(tuple_key);
 
   iter_key_.Clear();
   row_ready_ = false;
@@ -16,6 +16,7 @@
 
 #include <string>
 #include <atomic>
+#include <vector>
 
 #include "yb/docdb/doc_reader.h"
 #include "yb/rocksdb/db.h"
@@ -74,6 +75,12 @@ class DocRowwiseIterator : public YQLRowwiseIteratorIf {
   CHECKED_STATUS Init(const QLScanSpec& spec);
   CHECKED_STATUS Init(const PgsqlScanSpec& spec);
 
+  // Init iterator for reading a batch of YSQL tuples with SeekTuple, tuple_ids have the same format
+  // as for SeekTuple. Only SST files that could contain some of the tuples are read, so it is
+  // cheaper than iterator per tuple. Tuples should be sought in increasing order of tuple id, so
+  // blocks loaded for the previous tuple are reused.
+  CHECKED_STATUS InitForTuples(const std::vector<Slice>& tuple_ids, rocksdb::QueryId query_id);
+
   // This must always be called before NextRow. The implementation actually finds the
   // first row to scan, and NextRow expects the RocksDB iterator to already be properly
   // positioned.
@@ -121,6 +128,9 @@ class DocRowwiseIterator : public YQLRowwiseIteratorIf {
   template <class T>
   CHECKED_STATUS DoInit(const T& spec);
 
+  // Returns the key of the tuple with the given id in regular DB, see SeekTuple.
+  Slice TupleKey(const Slice& tuple_id);
+
   Result<bool> InitScanChoices(
       const DocQLScanSpec& doc_spec, const KeyBytes& lower_doc_key, const KeyBytes& upper_doc_key);
 
@@ -225,6 +235,9 @@ class DocRowwiseIterator : public YQLRowwiseIteratorIf {
   // Key for seeking a YSQL tuple. Used only when the table has a cotable id.
   boost::optional<KeyBytes> tuple_key_;
 
+  // Whether iterator was initialized by InitForTuples, so SeekTuple bounds it by the sought tuple.
+  bool bound_by_tuple_ = false;
+
   mutable std::unique_ptr<DocDBTableReader> doc_reader_ = nullptr;
 
   mutable bool ignore_ttl_ = false;
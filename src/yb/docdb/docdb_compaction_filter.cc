@@ -381,7 +381,8 @@ HistoryRetentionDirective ManualHistoryRetentionPolicy::GetRetentionDirective()
   std::lock_guard<std::mutex> lock(deleted_cols_mtx_);
   return {history_cutoff_.load(std::memory_order_acquire),
           std::make_shared<ColumnIds>(deleted_cols_), table_ttl_.load(std::memory_order_acquire),
-          ShouldRetainDeleteMarkersInMajorCompaction::kFalse};
+          ShouldRetainDeleteMarkersInMajorCompaction::kFalse,
+          compaction_time_window_.load(std::memory_order_acquire)};
 }
 
 void ManualHistoryRetentionPolicy::SetHistoryCutoff(HybridTime history_cutoff) {
@@ -397,5 +398,9 @@ void ManualHistoryRetentionPolicy::SetTableTTLForTests(MonoDelta ttl) {
   table_ttl_.store(ttl, std::memory_order_release);
 }
 
+void ManualHistoryRetentionPolicy::SetCompactionTimeWindowForTests(MonoDelta time_window) {
+  compaction_time_window_.store(time_window, std::memory_order_release);
+}
+
 }  // namespace docdb
 }  // namespace yb
@@ -61,6 +61,9 @@ struct HistoryRetentionDirective {
   MonoDelta table_ttl;
 
   ShouldRetainDeleteMarkersInMajorCompaction retain_delete_markers_in_major_compaction{false};
+
+  // Width of the time window for time-window compaction, not initialized when it is disabled.
+  MonoDelta compaction_time_window;
 };
 
 // DocDB compaction filter. A new instance of this class is created for every compaction.
@@ -197,6 +200,8 @@ class ManualHistoryRetentionPolicy : public HistoryRetentionPolicy {
 
   void SetTableTTLForTests(MonoDelta ttl);
 
+  void SetCompactionTimeWindowForTests(MonoDelta time_window);
+
  private:
   std::atomic<HybridTime> history_cutoff_{HybridTime::kMin};
 
@@ -204,6 +209,8 @@ class ManualHistoryRetentionPolicy : public HistoryRetentionPolicy {
   ColumnIds deleted_cols_ GUARDED_BY(deleted_cols_mtx_);
 
   std::atomic<MonoDelta> table_ttl_{MonoDelta::kMax};
+
+  std::atomic<MonoDelta> compaction_time_window_{MonoDelta()};
 };
 
 }  // namespace docdb
@@ -41,6 +41,7 @@ class QLWriteOperation;
 class RedisWriteOperation;
 class SharedLockManager;
 class SubDocKey;
+class WaitQueue;
 class YQLRowwiseIteratorIf;
 class YQLStorageIf;
 
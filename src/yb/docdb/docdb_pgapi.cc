@@ -14,6 +14,8 @@
 
 #include "yb/docdb/docdb_pgapi.h"
 
+#include <algorithm>
+
 #include "yb/common/ql_expr.h"
 #include "yb/common/schema.h"
 
@@ -22,6 +24,8 @@
 #include "yb/yql/pggate/pg_value.h"
 #include "yb/yql/pggate/pg_expr.h"
 
+#include "yb/util/atomic.h"
+#include "yb/util/flag_tags.h"
 #include "yb/util/result.h"
 
 // This file comes from this directory:
@@ -29,6 +33,12 @@
 // added as a special include path to CMakeLists.txt
 #include "pg_type_d.h" // NOLINT
 
+DEFINE_int32(ysql_prepared_pushdown_expr_cache_size, 64,
+             "Max number of pushed down YSQL expressions, that are kept prepared for evaluation "
+             "by each thread. 0 to deserialize expression on every evaluation.");
+TAG_FLAG(ysql_prepared_pushdown_expr_cache_size, advanced);
+TAG_FLAG(ysql_prepared_pushdown_expr_cache_size, runtime);
+
 using yb::pggate::PgValueFromPB;
 using yb::pggate::PgValueToPB;
 
@@ -92,14 +102,17 @@ const YBCPgTypeEntity* DocPgGetTypeEntity(YbgTypeDesc pg_type) {
     return Singleton<DocPgTypeAnalyzer>::get()->GetTypeEntity(pg_type.type_id);
 }
 
-Status DocPgEvalExpr(const std::string& expr_str,
-                     std::vector<DocPgParamDesc> params,
-                     const QLTableRow& table_row,
-                     const Schema *schema,
-                     QLValue* result) {
-  PG_RETURN_NOT_OK(YbgPrepareMemoryContext());
+namespace {
 
-  char *expr_cstring = const_cast<char *>(expr_str.c_str());
+// Evaluates expression against table row, using evaluator to compute the result from the
+// expression context.
+template <class Evaluator>
+Status DoEvalExpr(const std::vector<DocPgParamDesc>& params,
+                  const QLTableRow& table_row,
+                  const Schema *schema,
+                  const Evaluator& evaluator,
+                  QLValue* result) {
+  PG_RETURN_NOT_OK(YbgPrepareMemoryContext());
 
   // Create the context expression evaluation.
   // Since we currently only allow referencing the target col just set min/max attr to col_attno.
@@ -149,7 +162,7 @@ Status DocPgEvalExpr(const std::string& expr_str,
   // Evaluate the expression and get the result.
   bool is_null = false;
   uint64_t datum;
-  PG_RETURN_NOT_OK(YbgEvalExpr(expr_cstring, expr_ctx, &datum, &is_null));
+  PG_RETURN_NOT_OK(evaluator(expr_ctx, &datum, &is_null));
 
   // Assuming first arg is the target column, so using it for the return type.
   // YSQL layer should guarantee this when producing the params.
@@ -161,6 +174,105 @@ Status DocPgEvalExpr(const std::string& expr_str,
   return s;
 }
 
+bool ParamsEqual(const std::vector<DocPgParamDesc>& lhs, const std::vector<DocPgParamDesc>& rhs) {
+  return std::equal(
+      lhs.begin(), lhs.end(), rhs.begin(), rhs.end(),
+      [](const DocPgParamDesc& l, const DocPgParamDesc& r) {
+        return l.attno == r.attno && l.typid == r.typid && l.typmod == r.typmod;
+      });
+}
+
+// Expressions prepared by the current thread. The same pushed down expression is usually
+// evaluated many times in a row, e.g. by all single row writes of the same statement.
+class DocPgPreparedExprCache {
+ public:
+  Result<const DocPgPreparedExpr*> Get(
+      const std::string& expr_str, const std::vector<DocPgParamDesc>& params, size_t capacity) {
+    auto it = exprs_.find(expr_str);
+    if (it != exprs_.end() && ParamsEqual(it->second->params(), params)) {
+      return it->second.get();
+    }
+    auto expr = VERIFY_RESULT(DocPgPreparedExpr::Make(expr_str, params));
+    if (it != exprs_.end()) {
+      it->second = std::move(expr);
+      return it->second.get();
+    }
+    // Statements are rarely mixed, so just start over instead of tracking usage.
+    if (exprs_.size() >= capacity) {
+      exprs_.clear();
+    }
+    return exprs_.emplace(expr_str, std::move(expr)).first->second.get();
+  }
+
+ private:
+  std::unordered_map<std::string, std::unique_ptr<DocPgPreparedExpr>> exprs_;
+};
+
+thread_local std::unique_ptr<DocPgPreparedExprCache> prepared_expr_cache_;
+
+} // namespace
+
+Status DocPgEvalExpr(const std::string& expr_str,
+                     std::vector<DocPgParamDesc> params,
+                     const QLTableRow& table_row,
+                     const Schema *schema,
+                     QLValue* result) {
+  auto cache_capacity = GetAtomicFlag(&FLAGS_ysql_prepared_pushdown_expr_cache_size);
+  if (cache_capacity > 0) {
+    if (!prepared_expr_cache_) {
+      prepared_expr_cache_ = std::make_unique<DocPgPreparedExprCache>();
+    }
+    auto expr = VERIFY_RESULT(prepared_expr_cache_->Get(expr_str, params, cache_capacity));
+    return expr->Eval(table_row, schema, result);
+  }
+
+  char *expr_cstring = const_cast<char *>(expr_str.c_str());
+  return DoEvalExpr(
+      params, table_row, schema,
+      [expr_cstring](YbgExprContext expr_ctx, uint64_t* datum, bool* is_null) {
+        return YbgEvalExpr(expr_cstring, expr_ctx, datum, is_null);
+      },
+      result);
+}
+
+DocPgPreparedExpr::DocPgPreparedExpr(YbgPreparedExpr expr, std::vector<DocPgParamDesc> params)
+    : expr_(expr), params_(std::move(params)) {
+}
+
+DocPgPreparedExpr::~DocPgPreparedExpr() {
+  auto status = YbgFreePreparedExpr(expr_);
+  LOG_IF(DFATAL, status.err_code != 0)
+      << "Failed to free prepared expression: "
+      << (status.err_msg != nullptr ? status.err_msg : "<unknown>");
+}
+
+Result<std::unique_ptr<DocPgPreparedExpr>> DocPgPreparedExpr::Make(
+    const std::string& expr_str, std::vector<DocPgParamDesc> params) {
+  SCHECK(!params.empty(), InvalidArgument, "Expression without params");
+  PG_RETURN_NOT_OK(YbgPrepareMemoryContext());
+
+  YbgPreparedExpr expr = nullptr;
+  auto status = YbgPrepareExpr(const_cast<char *>(expr_str.c_str()), &expr);
+  if (status.err_code != 0 && expr != nullptr) {
+    // Restores memory context, so it is freed first.
+    YbgFreePreparedExpr(expr);
+  }
+  PG_RETURN_NOT_OK(status);
+  PG_RETURN_NOT_OK(YbgResetMemoryContext());
+
+  return std::unique_ptr<DocPgPreparedExpr>(new DocPgPreparedExpr(expr, std::move(params)));
+}
+
+Status DocPgPreparedExpr::Eval(
+    const QLTableRow& table_row, const Schema *schema, QLValue* result) const {
+  return DoEvalExpr(
+      params_, table_row, schema,
+      [this](YbgExprContext expr_ctx, uint64_t* datum, bool* is_null) {
+        return YbgEvalPreparedExpr(expr_, expr_ctx, datum, is_null);
+      },
+      result);
+}
+
 Status ExtractTextArrayFromQLBinaryValue(const QLValuePB& ql_value,
                                          vector<QLValuePB> *const ql_value_vec) {
   PG_RETURN_NOT_OK(YbgPrepareMemoryContext());
@@ -24,6 +24,7 @@
 #ifndef YB_DOCDB_DOCDB_PGAPI_H_
 #define YB_DOCDB_DOCDB_PGAPI_H_
 
+#include <memory>
 #include <vector>
 
 #include "yb/common/common_fwd.h"
@@ -55,12 +56,40 @@ const YBCPgTypeEntity* DocPgGetTypeEntity(YbgTypeDesc pg_type);
 // Expressions/Values
 //-----------------------------------------------------------------------------
 
+// Evaluates the expression against table row.
+// Unless disabled by ysql_prepared_pushdown_expr_cache_size, expression is prepared once per
+// thread, so repeated evaluations of the same expression skip deserialization.
 Status DocPgEvalExpr(const std::string& expr_str,
                      std::vector<DocPgParamDesc> params,
                      const QLTableRow& table_row,
                      const Schema *schema,
                      QLValue* result);
 
+// YSQL expression, that is deserialized and prepared once, and then evaluated against multiple
+// rows. Should not be used by multiple threads concurrently.
+class DocPgPreparedExpr {
+ public:
+  static Result<std::unique_ptr<DocPgPreparedExpr>> Make(
+      const std::string& expr_str, std::vector<DocPgParamDesc> params);
+
+  ~DocPgPreparedExpr();
+
+  DocPgPreparedExpr(const DocPgPreparedExpr&) = delete;
+  void operator=(const DocPgPreparedExpr&) = delete;
+
+  Status Eval(const QLTableRow& table_row, const Schema *schema, QLValue* result) const;
+
+  const std::vector<DocPgParamDesc>& params() const {
+    return params_;
+  }
+
+ private:
+  DocPgPreparedExpr(YbgPreparedExpr expr, std::vector<DocPgParamDesc> params);
+
+  YbgPreparedExpr expr_;
+  std::vector<DocPgParamDesc> params_;
+};
+
 // Given a 'ql_value' with a binary value, interpret the binary value as a text
 // array, and store the individual elements in 'ql_value_vec';
 Status ExtractTextArrayFromQLBinaryValue(const QLValuePB& ql_value,
@@ -121,6 +121,14 @@ DEFINE_int32(max_nexts_to_avoid_seek, 2,
 
 DEFINE_bool(use_multi_level_index, true, "Whether to use multi-level data index.");
 
+DEFINE_bool(use_docdb_data_block_hash_index, false,
+            "Whether to build hash index over DocKeys inside RocksDB data blocks. It allows point "
+            "seeks to locate the restart interval inside data block without binary search.");
+
+DEFINE_double(docdb_data_block_hash_table_util_ratio, 0.75,
+              "Desired ratio of the number of distinct DocKeys in data block to the number of "
+              "buckets in data block hash index.");
+
 DEFINE_string(
     regular_tablets_data_block_key_value_encoding, "shared_prefix",
     "Key-value encoding to use for regular data blocks in RocksDB. Possible options: "
@@ -146,6 +154,23 @@ DEFINE_string(compression_type, "Snappy",
 DEFINE_int32(block_restart_interval, kDefaultBlockStartInterval,
              "Controls the number of keys to look at for computing the diff encoding.");
 
+DEFINE_int32(index_block_restart_interval, 1,
+             "Number of entries between restart points in RocksDB index blocks. Values above 1 "
+             "enable shared prefix compression of index keys, trading index size for a short "
+             "linear scan inside restart interval on seek.");
+
+DEFINE_bool(db_delta_encode_index_block_handles, false,
+            "Whether to store block handles of RocksDB data index entries in compact form, "
+            "omitting offset of the block which directly follows the previous block.");
+
+DEFINE_bool(rocksdb_use_direct_reads, false,
+            "Whether to read RocksDB SST files with O_DIRECT, so user reads rely on the block "
+            "cache only and do not compete for the OS page cache.");
+
+DEFINE_bool(rocksdb_use_direct_io_for_flush_and_compaction, false,
+            "Whether to read RocksDB compaction inputs and write flush and compaction outputs "
+            "with O_DIRECT, so background jobs do not evict hot data from the OS page cache.");
+
 namespace yb {
 
 namespace {
@@ -365,6 +390,24 @@ unique_ptr<IntentAwareIterator> CreateIntentAwareIterator(
       doc_db, read_opts, deadline, read_time, txn_op_context);
 }
 
+unique_ptr<IntentAwareIterator> CreateIntentAwareIterator(
+    const DocDB& doc_db,
+    const std::vector<Slice>& user_keys_for_filter,
+    const rocksdb::QueryId query_id,
+    const TransactionOperationContext& txn_op_context,
+    CoarseTimePoint deadline,
+    const ReadHybridTime& read_time) {
+  rocksdb::ReadOptions read_opts = PrepareReadOptions(
+      doc_db.regular, BloomFilterMode::DONT_USE_BLOOM_FILTER, boost::none, query_id,
+      nullptr /* file_filter */, nullptr /* iterate_upper_bound */);
+  if (FLAGS_use_docdb_aware_bloom_filter) {
+    read_opts.table_aware_file_filter = doc_db.regular->GetOptions().table_factory->
+        NewTableAwareReadFileFilter(read_opts, user_keys_for_filter);
+  }
+  return std::make_unique<IntentAwareIterator>(
+      doc_db, read_opts, deadline, read_time, txn_op_context);
+}
+
 namespace {
 
 std::mutex rocksdb_flags_mutex;
@@ -459,6 +502,11 @@ void AutoInitFromBlockBasedTableOptions(rocksdb::BlockBasedTableOptions* table_o
     } else {
       table_options->block_restart_interval = FLAGS_block_restart_interval;
     }
+
+  table_options->index_block_restart_interval =
+      std::min(std::max(FLAGS_index_block_restart_interval, kMinBlockStartInterval),
+               kMaxBlockStartInterval);
+  table_options->delta_encode_index_block_handles = FLAGS_db_delta_encode_index_block_handles;
 }
 
 class HybridTimeFilteringIterator : public rocksdb::FilteringIterator {
@@ -577,6 +625,9 @@ void InitRocksDBOptions(
   options->initial_seqno = FLAGS_initial_seqno;
   options->boundary_extractor = DocBoundaryValuesExtractorInstance();
   options->compaction_measure_io_stats = FLAGS_rocksdb_compaction_measure_io_stats;
+  options->use_direct_reads = FLAGS_rocksdb_use_direct_reads;
+  options->use_direct_io_for_flush_and_compaction =
+      FLAGS_rocksdb_use_direct_io_for_flush_and_compaction;
   options->memory_monitor = tablet_options.memory_monitor;
   if (FLAGS_db_write_buffer_size != -1) {
     options->write_buffer_size = FLAGS_db_write_buffer_size;
@@ -630,6 +681,14 @@ void InitRocksDBOptions(
     table_options.index_type = rocksdb::IndexType::kBinarySearch;
   }
 
+  if (FLAGS_use_docdb_data_block_hash_index) {
+    table_options.data_block_index_type = rocksdb::DataBlockIndexType::kBinarySearchAndHash;
+    table_options.data_block_hash_table_util_ratio = FLAGS_docdb_data_block_hash_table_util_ratio;
+  }
+  // Set even if building of data block hash index is disabled, so we can use hash index of SST
+  // files written before.
+  table_options.data_block_hash_index_key_transformer = DocKeyDataBlockHashIndexKeyTransformer();
+
   options->table_factory.reset(rocksdb::NewBlockBasedTableFactory(table_options));
 
   // Compaction related options.
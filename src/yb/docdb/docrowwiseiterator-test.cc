@@ -13,6 +13,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "yb/common/common.pb.h"
 #include "yb/common/ql_expr.h"
@@ -1269,5 +1270,56 @@ TEST_F(DocRowwiseIteratorTest, ScanWithinTheSameTxn) {
   ASSERT_EQ(intents_db_options_.statistics->getTickerCount(rocksdb::Tickers::NUMBER_DB_SEEK), 3);
 }
 
+TEST_F(DocRowwiseIteratorTest, SeekTuplesBatch) {
+  const KeyBytes encoded_doc_key3(DocKey(PrimitiveValues("row3", 33333)).Encode());
+  const KeyBytes missing_doc_key(DocKey(PrimitiveValues("row2", 22223)).Encode());
+
+  ASSERT_OK(SetPrimitive(
+      DocPath(kEncodedDocKey1, PrimitiveValue(30_ColId)),
+      PrimitiveValue("row1_c"), HybridTime::FromMicros(1000)));
+  ASSERT_OK(SetPrimitive(
+      DocPath(kEncodedDocKey2, PrimitiveValue(30_ColId)),
+      PrimitiveValue("row2_c"), HybridTime::FromMicros(1000)));
+  // Rows in different SST files and memtable.
+  FlushRocksDB();
+  ASSERT_OK(SetPrimitive(
+      DocPath(encoded_doc_key3, PrimitiveValue(30_ColId)),
+      PrimitiveValue("row3_c"), HybridTime::FromMicros(1000)));
+  FlushRocksDB();
+  ASSERT_OK(SetPrimitive(
+      DocPath(kEncodedDocKey1, PrimitiveValue(40_ColId)),
+      PrimitiveValue(10000), HybridTime::FromMicros(2000)));
+
+  const Schema &projection = kProjectionForIteratorTests;
+  DocRowwiseIterator iter(
+      projection, kSchemaForIteratorTests, kNonTransactionalOperationContext, doc_db(),
+      CoarseTimePoint::max() /* deadline */, ReadHybridTime::FromMicros(3000));
+  std::vector<Slice> tuple_ids = {
+      kEncodedDocKey1.AsSlice(), missing_doc_key.AsSlice(), encoded_doc_key3.AsSlice() };
+  ASSERT_OK(iter.InitForTuples(tuple_ids, rocksdb::kDefaultQueryId));
+
+  QLTableRow row;
+  QLValue value;
+
+  ASSERT_TRUE(ASSERT_RESULT(iter.SeekTuple(kEncodedDocKey1.AsSlice())));
+  ASSERT_OK(iter.NextRow(&row));
+  ASSERT_OK(row.GetValue(projection.column_id(0), &value));
+  ASSERT_EQ("row1_c", value.string_value());
+  ASSERT_OK(row.GetValue(projection.column_id(1), &value));
+  ASSERT_EQ(10000, value.int64_value());
+
+  ASSERT_FALSE(ASSERT_RESULT(iter.SeekTuple(missing_doc_key.AsSlice())));
+  // Seek is bounded by the sought tuple, so the following row is not read.
+  ASSERT_FALSE(ASSERT_RESULT(iter.HasNext()));
+
+  row.Clear();
+  ASSERT_TRUE(ASSERT_RESULT(iter.SeekTuple(encoded_doc_key3.AsSlice())));
+  ASSERT_OK(iter.NextRow(&row));
+  ASSERT_OK(row.GetValue(projection.column_id(0), &value));
+  ASSERT_EQ("row3_c", value.string_value());
+  ASSERT_OK(row.GetValue(projection.column_id(1), &value));
+  ASSERT_TRUE(value.IsNull());
+}
+
 }  // namespace docdb
 }  // namespace yb
@@ -74,6 +74,14 @@ class LockBatch {
   // Unlocks this batch if it is non-empty.
   void Reset();
 
+  // Releases locks held by this batch, but keeps its entries, so the same locks could be
+  // reacquired by Relock. Used to let other requests proceed while the owner of this batch waits
+  // for conflicting transactions.
+  void Unlock();
+
+  // Reacquires locks released by Unlock.
+  CHECKED_STATUS Relock(CoarseTimePoint deadline);
+
  private:
   void MoveFrom(LockBatch* other);
 
@@ -90,6 +98,9 @@ class LockBatch {
 
     LockBatchEntries key_to_type;
 
+    // Entries released by Unlock.
+    LockBatchEntries unlocked_key_to_type;
+
     SharedLockManager* shared_lock_manager = nullptr;
 
     Status status;
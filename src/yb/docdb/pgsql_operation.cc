@@ -13,7 +13,9 @@
 
 #include "yb/docdb/pgsql_operation.h"
 
+#include <algorithm>
 #include <limits>
+#include <numeric>
 #include <string>
 #include <unordered_set>
 #include <vector>
@@ -37,8 +39,10 @@
 #include "yb/docdb/ql_storage_interface.h"
 
 #include "yb/util/flag_tags.h"
+#include "yb/util/random_util.h"
 #include "yb/util/result.h"
 #include "yb/util/scope_exit.h"
+#include "yb/util/size_literals.h"
 #include "yb/util/status_format.h"
 #include "yb/util/trace.h"
 
@@ -56,9 +60,24 @@ DEFINE_bool(pgsql_consistent_transactional_paging, true,
             "be stale. The latter is preferable for long scans. The data returned for the first "
             "page of results is never stale regardless of this flag.");
 
+DEFINE_uint64(pgsql_grouped_aggregate_memory_limit_bytes, 16_MB,
+              "Approximate memory limit for partial aggregate results of the groups accumulated "
+              "by a single YSQL read request with GROUP BY. When the limit is exceeded, results of "
+              "the accumulated groups are added to the response and aggregation starts over, so "
+              "the same group could be returned several times.");
+TAG_FLAG(pgsql_grouped_aggregate_memory_limit_bytes, advanced);
+
+DEFINE_bool(pgsql_enable_columnar_result, true,
+            "Whether rows of YSQL scans are returned in columnar format, when the request accepts "
+            "it.");
+TAG_FLAG(pgsql_enable_columnar_result, advanced);
+TAG_FLAG(pgsql_enable_columnar_result, runtime);
+
 DEFINE_test_flag(int32, slowdown_pgsql_aggregate_read_ms, 0,
                  "If set > 0, slows down the response to pgsql aggregate read by this amount.");
 
+using namespace yb::size_literals;  // NOLINT.
+
 namespace yb {
 namespace docdb {
 
@@ -798,23 +817,18 @@ Result<size_t> PgsqlReadOperation::ExecuteSample(const YQLStorageIf& ql_storage,
   table_iter_ = VERIFY_RESULT(CreateIterator(
       ql_storage, request_, projection, schema, txn_op_context_,
       deadline, read_time, is_explicit_request_read_time));
-  bool scan_time_exceeded = false;
-  while (scanned_rows++ < row_count_limit &&
-         VERIFY_RESULT(table_iter_->HasNext()) &&
-         !scan_time_exceeded) {
+  // Adds the row with the given ybctid to the sample, the row represents weight rows of the table.
+  auto sample_row = [&](const Slice& ybctid, double weight) {
     if (numrows < targrows) {
       // Select first targrows of the table. If first partition(s) have less than that, next
       // partition starts to continue populating it's reservoir starting from the numrows' position:
       // the numrows, as well as other sampling state variables is returned and copied over to the
       // next sampling request
-      Slice ybctid = VERIFY_RESULT(table_iter_->GetTupleId());
       reservoir[numrows++].set_binary_value(ybctid.data(), ybctid.size());
     } else {
       // At least targrows tuples have already been collected, now algorithm skips increasing number
       // of row before taking next one into the reservoir
       if (rowstoskip <= 0) {
-        // Take ybctid of the current row
-        Slice ybctid = VERIFY_RESULT(table_iter_->GetTupleId());
         // Pick random tuple in the reservoir to replace
         double rvalue;
         int k;
@@ -825,18 +839,75 @@ Result<size_t> PgsqlReadOperation::ExecuteSample(const YQLStorageIf& ql_storage,
         // Choose next number of rows to skip
         YbgReservoirGetNextS(rstate, samplerows, targrows, &rowstoskip);
       } else {
-        rowstoskip -= 1;
+        rowstoskip -= weight;
       }
     }
-    // Taking tuple ID does not advance the table iterator. Move it now.
-    table_iter_->SkipRow();
-    // Periodically check if we are running out of time
-    if (scanned_rows % 1024 == 0) {
-      scan_time_exceeded = CoarseMonoClock::now() >= deadline;
+  };
+  bool scan_time_exceeded = false;
+  std::vector<rocksdb::DataBlockBounds> blocks;
+  uint64_t num_blocks = 0;
+  // Tuple id is the regular DB key only when there is no cotable id / pgtable id prefix, so block
+  // sampling is not used for colocated tables.
+  if (sampling_state.block_sample_rows() > 0 && !request_.has_paging_state() &&
+      !schema.has_cotable_id() && !schema.has_pgtable_id()) {
+    blocks = VERIFY_RESULT(ql_storage.SampleDataBlocks(
+        sampling_state.block_sample_rows(), &num_blocks));
+    // Scan all rows if the tablet is too small to benefit from sampling its blocks.
+    if (blocks.size() >= num_blocks) {
+      blocks.clear();
+    }
+  }
+  if (!blocks.empty()) {
+    // Read rows of randomly picked key ranges until block_sample_rows rows are read. Ranges do not
+    // overlap and cover the whole tablet, so each row is read at most once and represents
+    // num_blocks / blocks_read rows of the tablet.
+    std::shuffle(blocks.begin(), blocks.end(), ThreadLocalRandom());
+    const size_t block_sample_rows = sampling_state.block_sample_rows();
+    std::vector<std::string> ybctids;
+    size_t blocks_read = 0;
+    for (const auto& block : blocks) {
+      if (ybctids.size() >= block_sample_rows || scan_time_exceeded) {
+        break;
+      }
+      ++blocks_read;
+      RETURN_NOT_OK(table_iter_->SeekTuple(block.lower_bound));
+      while (VERIFY_RESULT(table_iter_->HasNext())) {
+        Slice ybctid = VERIFY_RESULT(table_iter_->GetTupleId());
+        if (!block.upper_bound.empty() && ybctid.compare(block.upper_bound) > 0) {
+          break;
+        }
+        // Row that starts in the previous range is counted there.
+        if (ybctid.compare(block.lower_bound) > 0) {
+          ybctids.push_back(ybctid.ToBuffer());
+        }
+        table_iter_->SkipRow();
+        if (++scanned_rows % 1024 == 0) {
+          scan_time_exceeded = CoarseMonoClock::now() >= deadline;
+        }
+      }
+    }
+    const double weight = static_cast<double>(num_blocks) / blocks_read;
+    for (const auto& ybctid : ybctids) {
+      samplerows += weight;
+      sample_row(ybctid, weight);
     }
+    VLOG(1) << "Block sampling read " << ybctids.size() << " rows of " << blocks_read << " out of "
+            << num_blocks << " data blocks";
+  } else {
+    while (scanned_rows++ < row_count_limit &&
+           VERIFY_RESULT(table_iter_->HasNext()) &&
+           !scan_time_exceeded) {
+      sample_row(VERIFY_RESULT(table_iter_->GetTupleId()), 1);
+      // Taking tuple ID does not advance the table iterator. Move it now.
+      table_iter_->SkipRow();
+      // Periodically check if we are running out of time
+      if (scanned_rows % 1024 == 0) {
+        scan_time_exceeded = CoarseMonoClock::now() >= deadline;
+      }
+    }
+    // Count live rows we have scanned TODO how to count dead rows?
+    samplerows += (scanned_rows - 1);
   }
-  // Count live rows we have scanned TODO how to count dead rows?
-  samplerows += (scanned_rows - 1);
   // Return collected tuples from the reservoir.
   // Tuples are returned as (index, ybctid) pairs, where index is in [0..targrows-1] range.
   // As mentioned above, for large tables reservoirs become increasingly sparse from page to page.
@@ -864,12 +935,16 @@ Result<size_t> PgsqlReadOperation::ExecuteSample(const YQLStorageIf& ql_storage,
   YbgSamplerGetState(rstate, &rstate_w, &randstate);
   new_sampling_state->set_rstate_w(rstate_w);
   new_sampling_state->set_rand_state(randstate);
+  new_sampling_state->set_block_sample_rows(sampling_state.block_sample_rows());
   YbgDeleteMemoryContext();
 
-  // Return paging state if scan has not been completed
-  RETURN_NOT_OK(SetPagingStateIfNecessary(table_iter_.get(), scanned_rows, row_count_limit,
-                                          scan_time_exceeded, &schema, read_time,
-                                          has_paging_state));
+  // Return paging state if scan has not been completed. Rows of sampled blocks represent the whole
+  // tablet, so block sampling is always completed by a single request.
+  if (blocks.empty()) {
+    RETURN_NOT_OK(SetPagingStateIfNecessary(table_iter_.get(), scanned_rows, row_count_limit,
+                                            scan_time_exceeded, &schema, read_time,
+                                            has_paging_state));
+  }
   return fetched_rows;
 }
 
@@ -929,6 +1004,13 @@ Result<size_t> PgsqlReadOperation::ExecuteScalar(const YQLStorageIf& ql_storage,
   // Set scan start time.
   bool scan_time_exceeded = false;
 
+  // Rows of plain scan are returned in columnar format, if the caller accepts it.
+  boost::optional<pggate::PgColumnarResultWriter> columnar_writer;
+  if (FLAGS_pgsql_enable_columnar_result && request_.accept_columnar_result() &&
+      !request_.is_aggregate() && request_.order_by().empty() && !request_.targets().empty()) {
+    columnar_writer.emplace(request_.targets().size());
+  }
+
   // Fetching data.
   int match_count = 0;
   QLTableRow row;
@@ -962,8 +1044,18 @@ Result<size_t> PgsqlReadOperation::ExecuteScalar(const YQLStorageIf& ql_storage,
     }
     if (is_match) {
       match_count++;
-      if (request_.is_aggregate()) {
+      if (request_.is_aggregate() && request_.group_by_exprs().empty()) {
         RETURN_NOT_OK(EvalAggregate(row));
+      } else if (request_.is_aggregate()) {
+        RETURN_NOT_OK(EvalGroupedAggregate(row));
+        if (aggr_groups_memory_ > FLAGS_pgsql_grouped_aggregate_memory_limit_bytes) {
+          fetched_rows += VERIFY_RESULT(PopulateGroupedAggregates(result_buffer));
+        }
+      } else if (!request_.order_by().empty()) {
+        RETURN_NOT_OK(EvalTopN(row));
+      } else if (columnar_writer) {
+        RETURN_NOT_OK(PopulateColumnarResultSet(row, columnar_writer.get_ptr()));
+        ++fetched_rows;
       } else {
         RETURN_NOT_OK(PopulateResultSet(row, result_buffer));
         ++fetched_rows;
@@ -976,11 +1068,22 @@ Result<size_t> PgsqlReadOperation::ExecuteScalar(const YQLStorageIf& ql_storage,
     }
   }
 
-  if (request_.is_aggregate() && match_count > 0) {
+  if (request_.is_aggregate() && !request_.group_by_exprs().empty()) {
+    fetched_rows += VERIFY_RESULT(PopulateGroupedAggregates(result_buffer));
+  } else if (request_.is_aggregate() && match_count > 0) {
     RETURN_NOT_OK(PopulateAggregate(row, result_buffer));
     ++fetched_rows;
   }
 
+  if (!request_.is_aggregate() && !request_.order_by().empty()) {
+    fetched_rows += VERIFY_RESULT(PopulateTopN(result_buffer));
+  }
+
+  if (columnar_writer) {
+    columnar_writer->Serialize(result_buffer);
+    response_.set_is_columnar_result(true);
+  }
+
   if (PREDICT_FALSE(FLAGS_TEST_slowdown_pgsql_aggregate_read_ms > 0) && request_.is_aggregate()) {
     TRACE("Sleeping for $0 ms", FLAGS_TEST_slowdown_pgsql_aggregate_read_ms);
     SleepFor(MonoDelta::FromMilliseconds(FLAGS_TEST_slowdown_pgsql_aggregate_read_ms));
@@ -1001,21 +1104,39 @@ Result<size_t> PgsqlReadOperation::ExecuteBatchYbctid(const YQLStorageIf& ql_sto
   Schema projection;
   RETURN_NOT_OK(CreateProjection(schema, request_.column_refs(), &projection));
 
-  QLTableRow row;
-  size_t row_count = 0;
-  for (const PgsqlBatchArgumentPB& batch_argument : request_.batch_arguments()) {
-    // Get the row.
-    RETURN_NOT_OK(ql_storage.GetIterator(request_.stmt_id(), projection, schema, txn_op_context_,
-                                         deadline, read_time, batch_argument.ybctid().value(),
-                                         &table_iter_));
+  // Read all rows with a single iterator, seeking ybctids in increasing order, so blocks loaded
+  // for one row are reused for the following ones. Rows are returned in the request order.
+  const auto& batch_arguments = request_.batch_arguments();
+  std::vector<size_t> read_order(batch_arguments.size());
+  std::iota(read_order.begin(), read_order.end(), 0);
+  std::sort(read_order.begin(), read_order.end(), [&batch_arguments](size_t lhs, size_t rhs) {
+    return batch_arguments.Get(lhs).ybctid().value().binary_value() <
+           batch_arguments.Get(rhs).ybctid().value().binary_value();
+  });
+  std::vector<Slice> ybctids;
+  ybctids.reserve(read_order.size());
+  for (auto idx : read_order) {
+    ybctids.emplace_back(batch_arguments.Get(idx).ybctid().value().binary_value());
+  }
 
-    if (VERIFY_RESULT(table_iter_->HasNext())) {
-      row.Clear();
-      RETURN_NOT_OK(table_iter_->NextRow(projection, &row));
+  RETURN_NOT_OK(ql_storage.GetIterator(request_.stmt_id(), projection, schema, txn_op_context_,
+                                       deadline, read_time, ybctids, &table_iter_));
+
+  std::vector<boost::optional<QLTableRow>> rows(batch_arguments.size());
+  for (size_t i = 0; i != read_order.size(); ++i) {
+    if (VERIFY_RESULT(table_iter_->SeekTuple(ybctids[i]))) {
+      auto& row = rows[read_order[i]];
+      row.emplace();
+      RETURN_NOT_OK(table_iter_->NextRow(projection, row.get_ptr()));
+    }
+  }
 
+  size_t row_count = 0;
+  for (int i = 0; i != batch_arguments.size(); ++i) {
+    if (rows[i]) {
       // Populate result set.
-      RETURN_NOT_OK(PopulateResultSet(row, result_buffer));
-      response_.add_batch_orders(batch_argument.order());
+      RETURN_NOT_OK(PopulateResultSet(*rows[i], result_buffer));
+      response_.add_batch_orders(batch_arguments.Get(i).order());
       row_count++;
     }
   }
@@ -1085,6 +1206,16 @@ Status PgsqlReadOperation::PopulateResultSet(const QLTableRow& table_row,
   return Status::OK();
 }
 
+Status PgsqlReadOperation::PopulateColumnarResultSet(const QLTableRow& table_row,
+                                                     pggate::PgColumnarResultWriter *writer) {
+  QLExprResult result;
+  for (const PgsqlExpressionPB& expr : request_.targets()) {
+    RETURN_NOT_OK(EvalExpr(expr, table_row, result.Writer()));
+    RETURN_NOT_OK(writer->AppendValue(result.Value()));
+  }
+  return Status::OK();
+}
+
 Status PgsqlReadOperation::GetTupleId(QLValue *result) const {
   // Get row key and save to QLValue.
   // TODO(neil) Check if we need to append a table_id and other info to TupleID. For example, we
@@ -1117,6 +1248,123 @@ Status PgsqlReadOperation::PopulateAggregate(const QLTableRow& table_row,
   return Status::OK();
 }
 
+Status PgsqlReadOperation::EvalGroupedAggregate(const QLTableRow& table_row) {
+  // Group is identified by the wire encoding of its grouping column values, so equal values always
+  // fall into the same group.
+  group_key_buffer_.clear();
+  QLExprResult group_value;
+  for (const PgsqlExpressionPB& expr : request_.group_by_exprs()) {
+    RETURN_NOT_OK(EvalExpr(expr, table_row, group_value.Writer()));
+    RETURN_NOT_OK(pggate::WriteColumn(group_value.Value(), &group_key_buffer_));
+  }
+
+  const auto column_count = request_.targets().size();
+  auto group_key = group_key_buffer_.ToString();
+  auto it = aggr_groups_.find(group_key);
+  const bool is_new_group = it == aggr_groups_.end();
+  if (is_new_group) {
+    aggr_groups_memory_ +=
+        group_key.size() + column_count * sizeof(QLExprResult) + kAggregateGroupOverhead;
+    it = aggr_groups_.emplace(std::move(group_key), std::vector<QLExprResult>()).first;
+    it->second.resize(column_count);
+  }
+
+  int aggr_index = 0;
+  for (const PgsqlExpressionPB& expr : request_.targets()) {
+    auto& result = it->second[aggr_index++];
+    if (expr.has_column_id()) {
+      // Grouping column has the same value in all rows of the group. Result could reference the
+      // value in the row, so it is copied.
+      if (is_new_group) {
+        RETURN_NOT_OK(EvalExpr(expr, table_row, result.Writer()));
+        result.ForceNewValue();
+      }
+      continue;
+    }
+    RETURN_NOT_OK(EvalExpr(expr, table_row, result.Writer()));
+  }
+  return Status::OK();
+}
+
+Result<size_t> PgsqlReadOperation::PopulateGroupedAggregates(faststring *result_buffer) {
+  const size_t num_groups = aggr_groups_.size();
+  for (const auto& group : aggr_groups_) {
+    for (const auto& result : group.second) {
+      RETURN_NOT_OK(pggate::WriteColumn(result.Value(), result_buffer));
+    }
+  }
+  aggr_groups_.clear();
+  aggr_groups_memory_ = 0;
+  return num_groups;
+}
+
+int PgsqlReadOperation::CompareOrderByKeys(
+    const std::vector<QLValuePB>& lhs, const std::vector<QLValuePB>& rhs) const {
+  for (int i = 0; i != request_.order_by_size(); ++i) {
+    const auto& order_by = request_.order_by(i);
+    const bool lhs_is_null = IsNull(lhs[i]);
+    const bool rhs_is_null = IsNull(rhs[i]);
+    if (lhs_is_null || rhs_is_null) {
+      if (lhs_is_null == rhs_is_null) {
+        continue;
+      }
+      // Position of NULL does not depend on the sort direction.
+      return lhs_is_null == order_by.nulls_first() ? -1 : 1;
+    }
+    const int result = Compare(lhs[i], rhs[i]);
+    if (result != 0) {
+      return order_by.is_descending() ? -result : result;
+    }
+  }
+  return 0;
+}
+
+Status PgsqlReadOperation::EvalTopN(const QLTableRow& table_row) {
+  const auto limit = request_.order_by_limit();
+  if (limit == 0) {
+    return Status::OK();
+  }
+
+  std::vector<QLValuePB> keys;
+  keys.reserve(request_.order_by_size());
+  QLExprResult key;
+  for (const auto& order_by : request_.order_by()) {
+    RETURN_NOT_OK(EvalExpr(order_by.expr(), table_row, key.Writer()));
+    keys.push_back(key.Value());
+  }
+
+  // Heap front is the row that goes last among the collected rows.
+  auto less = [this](const TopNRow& lhs, const TopNRow& rhs) {
+    return CompareOrderByKeys(lhs.keys, rhs.keys) < 0;
+  };
+  if (top_n_rows_.size() >= limit) {
+    if (CompareOrderByKeys(keys, top_n_rows_.front().keys) >= 0) {
+      return Status::OK();
+    }
+    std::pop_heap(top_n_rows_.begin(), top_n_rows_.end(), less);
+    top_n_rows_.pop_back();
+  }
+
+  top_n_row_buffer_.clear();
+  RETURN_NOT_OK(PopulateResultSet(table_row, &top_n_row_buffer_));
+  top_n_rows_.push_back(TopNRow{std::move(keys), top_n_row_buffer_.ToString()});
+  std::push_heap(top_n_rows_.begin(), top_n_rows_.end(), less);
+  return Status::OK();
+}
+
+Result<size_t> PgsqlReadOperation::PopulateTopN(faststring *result_buffer) {
+  auto less = [this](const TopNRow& lhs, const TopNRow& rhs) {
+    return CompareOrderByKeys(lhs.keys, rhs.keys) < 0;
+  };
+  std::sort_heap(top_n_rows_.begin(), top_n_rows_.end(), less);
+  const size_t num_rows = top_n_rows_.size();
+  for (const auto& row : top_n_rows_) {
+    result_buffer->append(row.row);
+  }
+  top_n_rows_.clear();
+  return num_rows;
+}
+
 Status PgsqlReadOperation::GetIntents(const Schema& schema, KeyValueWriteBatchPB* out) {
   if (request_.batch_arguments_size() > 0 && request_.has_ybctid_column_value()) {
     for (const auto& batch_argument : request_.batch_arguments()) {
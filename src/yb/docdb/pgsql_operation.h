@@ -14,6 +14,10 @@
 #ifndef YB_DOCDB_PGSQL_OPERATION_H
 #define YB_DOCDB_PGSQL_OPERATION_H
 
+#include <string>
+#include <unordered_map>
+#include <vector>
+
 #include "yb/common/pgsql_protocol.pb.h"
 
 #include "yb/docdb/doc_expr.h"
@@ -26,6 +30,12 @@ namespace yb {
 
 class IndexInfo;
 
+namespace pggate {
+
+class PgColumnarResultWriter;
+
+} // namespace pggate
+
 namespace docdb {
 
 YB_STRONGLY_TYPED_BOOL(IsUpsert);
@@ -189,11 +199,33 @@ class PgsqlReadOperation : public DocExprExecutor {
   CHECKED_STATUS PopulateResultSet(const QLTableRow& table_row,
                                    faststring *result_buffer);
 
+  // Appends targets of the row to the result in columnar format.
+  CHECKED_STATUS PopulateColumnarResultSet(const QLTableRow& table_row,
+                                           pggate::PgColumnarResultWriter *writer);
+
   CHECKED_STATUS EvalAggregate(const QLTableRow& table_row);
 
   CHECKED_STATUS PopulateAggregate(const QLTableRow& table_row,
                                    faststring *result_buffer);
 
+  // Accumulates the row into partial aggregate results of its group for request with GROUP BY.
+  CHECKED_STATUS EvalGroupedAggregate(const QLTableRow& table_row);
+
+  // Writes partial aggregate results of all accumulated groups, one row per group, and forgets
+  // them. Returns the number of written rows.
+  Result<size_t> PopulateGroupedAggregates(faststring *result_buffer);
+
+  // Compares values of the sort keys of two rows according to order_by of the request.
+  int CompareOrderByKeys(
+      const std::vector<QLValuePB>& lhs, const std::vector<QLValuePB>& rhs) const;
+
+  // Keeps the row if it is among the first order_by_limit rows of top-N request.
+  CHECKED_STATUS EvalTopN(const QLTableRow& table_row);
+
+  // Writes the kept rows of top-N request in sort order and forgets them. Returns the number of
+  // written rows.
+  Result<size_t> PopulateTopN(faststring *result_buffer);
+
   // Checks whether we have processed enough rows for a page and sets the appropriate paging
   // state in the response object.
   CHECKED_STATUS SetPagingStateIfNecessary(const YQLRowwiseIteratorIf* iter,
@@ -210,6 +242,24 @@ class PgsqlReadOperation : public DocExprExecutor {
   PgsqlResponsePB response_;
   YQLRowwiseIteratorIf::UniPtr table_iter_;
   YQLRowwiseIteratorIf::UniPtr index_iter_;
+
+  // Estimated memory used by a hash table entry, in addition to the key and target results.
+  static constexpr size_t kAggregateGroupOverhead = 64;
+
+  // Partial aggregate results of GROUP BY request, keyed by encoded grouping column values.
+  std::unordered_map<std::string, std::vector<QLExprResult>> aggr_groups_;
+  size_t aggr_groups_memory_ = 0;
+  faststring group_key_buffer_;
+
+  struct TopNRow {
+    std::vector<QLValuePB> keys;
+    // Row encoded in the result set format.
+    std::string row;
+  };
+
+  // Rows kept by top-N request, arranged as a heap with the last row in front.
+  std::vector<TopNRow> top_n_rows_;
+  faststring top_n_row_buffer_;
 };
 
 }  // namespace docdb
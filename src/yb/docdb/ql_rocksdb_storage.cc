@@ -13,6 +13,8 @@
 
 #include "yb/docdb/ql_rocksdb_storage.h"
 
+#include <algorithm>
+
 #include "yb/common/pgsql_protocol.pb.h"
 #include "yb/common/ql_protocol.pb.h"
 
@@ -21,6 +23,8 @@
 #include "yb/docdb/doc_ql_scanspec.h"
 #include "yb/docdb/primitive_value_util.h"
 
+#include "yb/rocksdb/db.h"
+
 #include "yb/util/result.h"
 
 namespace yb {
@@ -142,6 +146,25 @@ Status QLRocksDBStorage::GetIterator(uint64 stmt_id,
   return Status::OK();
 }
 
+Status QLRocksDBStorage::GetIterator(uint64 stmt_id,
+                                     const Schema& projection,
+                                     const Schema& schema,
+                                     const TransactionOperationContext& txn_op_context,
+                                     CoarseTimePoint deadline,
+                                     const ReadHybridTime& read_time,
+                                     const std::vector<Slice>& ybctids,
+                                     YQLRowwiseIteratorIf::UniPtr* iter) const {
+  for (const auto& ybctid : ybctids) {
+    DocKey doc_key(schema);
+    RETURN_NOT_OK(doc_key.DecodeFrom(ybctid));
+  }
+  auto doc_iter = std::make_unique<DocRowwiseIterator>(
+      projection, schema, txn_op_context, doc_db_, deadline, read_time);
+  RETURN_NOT_OK(doc_iter->InitForTuples(ybctids, stmt_id));
+  *iter = std::move(doc_iter);
+  return Status::OK();
+}
+
 Status QLRocksDBStorage::GetIterator(const PgsqlReadRequestPB& request,
                                      const Schema& projection,
                                      const Schema& schema,
@@ -202,5 +225,26 @@ Status QLRocksDBStorage::GetIterator(const PgsqlReadRequestPB& request,
   return Status::OK();
 }
 
+Result<std::vector<rocksdb::DataBlockBounds>> QLRocksDBStorage::SampleDataBlocks(
+    size_t max_blocks, uint64_t* num_blocks) const {
+  auto blocks = VERIFY_RESULT(doc_db_.regular->SampleDataBlocks(max_blocks, num_blocks));
+  const auto* key_bounds = doc_db_.key_bounds;
+  if (!key_bounds || !key_bounds->IsInitialized() || blocks.empty()) {
+    return blocks;
+  }
+
+  // After tablet split SST files are shared with the other tablet, so drop blocks that are out of
+  // tablet key bounds and scale the total number of blocks accordingly.
+  const auto num_sampled = blocks.size();
+  blocks.erase(std::remove_if(blocks.begin(), blocks.end(), [key_bounds](const auto& block) {
+    return (!key_bounds->upper.empty() &&
+            Slice(block.lower_bound).compare(key_bounds->upper.AsSlice()) >= 0) ||
+           (!key_bounds->lower.empty() && !block.upper_bound.empty() &&
+            Slice(block.upper_bound).compare(key_bounds->lower.AsSlice()) < 0);
+  }), blocks.end());
+  *num_blocks = *num_blocks * blocks.size() / num_sampled;
+  return blocks;
+}
+
 }  // namespace docdb
 }  // namespace yb
@@ -80,6 +80,18 @@ class QLRocksDBStorage : public YQLStorageIf {
                              const QLValuePB& ybctid,
                              YQLRowwiseIteratorIf::UniPtr* iter) const override;
 
+  CHECKED_STATUS GetIterator(uint64 stmt_id,
+                             const Schema& projection,
+                             const Schema& schema,
+                             const TransactionOperationContext& txn_op_context,
+                             CoarseTimePoint deadline,
+                             const ReadHybridTime& read_time,
+                             const std::vector<Slice>& ybctids,
+                             YQLRowwiseIteratorIf::UniPtr* iter) const override;
+
+  Result<std::vector<rocksdb::DataBlockBounds>> SampleDataBlocks(
+      size_t max_blocks, uint64_t* num_blocks) const override;
+
  private:
   const DocDB doc_db_;
 };
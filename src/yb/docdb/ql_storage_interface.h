@@ -17,13 +17,17 @@
 #include <limits>
 #include <string>
 #include <type_traits>
+#include <vector>
 
 #include "yb/common/common_fwd.h"
 
 #include "yb/docdb/docdb_fwd.h"
 #include "yb/docdb/ql_rowwise_iterator_interface.h"
 
+#include "yb/rocksdb/metadata.h"
+
 #include "yb/util/monotime.h"
+#include "yb/util/result.h"
 
 namespace yb {
 namespace docdb {
@@ -99,6 +103,22 @@ class YQLStorageIf {
                                      const ReadHybridTime& read_time,
                                      const QLValuePB& ybctid,
                                      std::unique_ptr<YQLRowwiseIteratorIf>* iter) const = 0;
+
+  // Create iterator for querying by a batch of ybctids. Rows are fetched with SeekTuple, in
+  // increasing order of ybctids.
+  virtual CHECKED_STATUS GetIterator(uint64 stmt_id,
+                                     const Schema& projection,
+                                     const Schema& schema,
+                                     const TransactionOperationContext& txn_op_context,
+                                     CoarseTimePoint deadline,
+                                     const ReadHybridTime& read_time,
+                                     const std::vector<Slice>& ybctids,
+                                     std::unique_ptr<YQLRowwiseIteratorIf>* iter) const = 0;
+
+  // Picks up to max_blocks random non-overlapping key ranges of the regular DB, split by data
+  // blocks of its largest SST file. num_blocks is set to the total number of ranges.
+  virtual Result<std::vector<rocksdb::DataBlockBounds>> SampleDataBlocks(
+      size_t max_blocks, uint64_t* num_blocks) const = 0;
 };
 
 }  // namespace docdb
@@ -114,6 +114,32 @@ TEST_F(SharedLockManagerTest, LockBatchMoveAssignment) {
   ASSERT_TRUE(lb_fail2.empty());
 }
 
+TEST_F(SharedLockManagerTest, LockBatchUnlockRelock) {
+  LockBatch lb = TestLockBatch();
+  ASSERT_OK(lb.status());
+
+  lb.Unlock();
+  ASSERT_TRUE(lb.empty());
+
+  {
+    // Locks were released, so other batch could acquire them.
+    LockBatch lb2 = TestLockBatch(CoarseMonoClock::now() + 10ms);
+    ASSERT_OK(lb2.status());
+    ASSERT_FALSE(lb2.empty());
+
+    ASSERT_NOK(lb.Relock(CoarseMonoClock::now() + 10ms));
+    ASSERT_TRUE(lb.empty());
+  }
+
+  lb = TestLockBatch();
+  lb.Unlock();
+  ASSERT_OK(lb.Relock(CoarseMonoClock::now() + 10ms));
+  ASSERT_EQ(2, lb.size());
+
+  LockBatch lb_fail = TestLockBatch(CoarseMonoClock::now() + 10ms);
+  ASSERT_FALSE(lb_fail.status().ok());
+}
+
 TEST_F(SharedLockManagerTest, LockBatchReset) {
   LockBatch lb = TestLockBatch();
   lb.Reset();
@@ -0,0 +1,118 @@
+// Copyright (c) YugaByte, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+// in compliance with the License.  You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied.  See the License for the specific language governing permissions and limitations
+// under the License.
+//
+
+#include <vector>
+
+#include "yb/docdb/wait_queue.h"
+
+#include "yb/util/test_macros.h"
+#include "yb/util/test_util.h"
+
+using namespace std::literals;
+
+DECLARE_uint64(wait_queue_max_wait_ms);
+DECLARE_uint64(wait_queue_refresh_interval_ms);
+
+namespace yb {
+namespace docdb {
+
+class WaitQueueTest : public YBTest {
+ protected:
+  // Waiter callbacks are executed synchronously, to make tests deterministic.
+  WaitQueue wait_queue_{
+      "Test: ", [](WaiterCallback callback, const Status& status) { callback(status); },
+      nullptr /* metric_entity */};
+
+  // Parks waiter blocked by specified transactions, returned vector receives callback statuses.
+  std::shared_ptr<std::vector<Status>> Wait(
+      const TransactionIdSet& blockers, CoarseTimePoint deadline = CoarseTimePoint::max()) {
+    auto result = std::make_shared<std::vector<Status>>();
+    wait_queue_.WaitOn(TransactionId::GenerateRandom(), blockers, deadline,
+                       [result](const Status& status) { result->push_back(status); });
+    return result;
+  }
+};
+
+TEST_F(WaitQueueTest, ResumeOnResolve) {
+  auto blocker1 = TransactionId::GenerateRandom();
+  auto blocker2 = TransactionId::GenerateRandom();
+
+  auto waiter1 = Wait({blocker1});
+  auto waiter2 = Wait({blocker1, blocker2});
+  auto waiter3 = Wait({blocker2});
+  ASSERT_EQ(3, wait_queue_.TEST_NumWaiters());
+
+  wait_queue_.SignalResolved(blocker1);
+  ASSERT_EQ(1, wait_queue_.TEST_NumWaiters());
+  ASSERT_EQ(1, waiter1->size());
+  ASSERT_OK(waiter1->front());
+  ASSERT_EQ(1, waiter2->size());
+  ASSERT_OK(waiter2->front());
+  ASSERT_TRUE(waiter3->empty());
+
+  wait_queue_.SignalResolved(blocker2);
+  ASSERT_EQ(0, wait_queue_.TEST_NumWaiters());
+  // Each waiter is resumed only once.
+  ASSERT_EQ(1, waiter2->size());
+  ASSERT_EQ(1, waiter3->size());
+  ASSERT_OK(waiter3->front());
+}
+
+TEST_F(WaitQueueTest, RecentlyResolved) {
+  auto blocker = TransactionId::GenerateRandom();
+  // Blocker was resolved before waiter started to wait for it, so waiter is resumed right away.
+  wait_queue_.SignalResolved(blocker);
+  auto waiter = Wait({blocker, TransactionId::GenerateRandom()});
+  ASSERT_EQ(0, wait_queue_.TEST_NumWaiters());
+  ASSERT_EQ(1, waiter->size());
+  ASSERT_OK(waiter->front());
+}
+
+TEST_F(WaitQueueTest, Poll) {
+  FLAGS_wait_queue_max_wait_ms = 60000;
+  FLAGS_wait_queue_refresh_interval_ms = 1000;
+
+  auto now = CoarseMonoClock::now();
+  auto expiring_waiter = Wait({TransactionId::GenerateRandom()}, now + 100ms);
+  auto refreshed_waiter = Wait({TransactionId::GenerateRandom()});
+
+  wait_queue_.Poll(now);
+  ASSERT_EQ(2, wait_queue_.TEST_NumWaiters());
+
+  wait_queue_.Poll(now + 500ms);
+  ASSERT_EQ(1, wait_queue_.TEST_NumWaiters());
+  ASSERT_EQ(1, expiring_waiter->size());
+  ASSERT_TRUE(expiring_waiter->front().IsTimedOut()) << expiring_waiter->front();
+  ASSERT_TRUE(refreshed_waiter->empty());
+
+  // Waiter is resumed after refresh interval to recheck its blockers.
+  wait_queue_.Poll(now + 5s);
+  ASSERT_EQ(0, wait_queue_.TEST_NumWaiters());
+  ASSERT_EQ(1, refreshed_waiter->size());
+  ASSERT_OK(refreshed_waiter->front());
+}
+
+TEST_F(WaitQueueTest, Shutdown) {
+  auto waiter = Wait({TransactionId::GenerateRandom(), TransactionId::GenerateRandom()});
+  wait_queue_.StartShutdown();
+  ASSERT_EQ(0, wait_queue_.TEST_NumWaiters());
+  ASSERT_EQ(1, waiter->size());
+  ASSERT_TRUE(waiter->front().IsAborted()) << waiter->front();
+
+  auto late_waiter = Wait({TransactionId::GenerateRandom()});
+  ASSERT_EQ(1, late_waiter->size());
+  ASSERT_TRUE(late_waiter->front().IsAborted()) << late_waiter->front();
+}
+
+} // namespace docdb
+} // namespace yb
@@ -0,0 +1,293 @@
+// Copyright (c) YugaByte, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+// in compliance with the License.  You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied.  See the License for the specific language governing permissions and limitations
+// under the License.
+//
+
+#include "yb/docdb/wait_queue.h"
+
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "yb/util/atomic.h"
+#include "yb/util/flag_tags.h"
+#include "yb/util/logging.h"
+#include "yb/util/lru_cache.h"
+#include "yb/util/metrics.h"
+#include "yb/util/status_format.h"
+#include "yb/util/thread_annotations.h"
+
+using namespace std::literals;
+
+DEFINE_bool(enable_wait_queues, false,
+            "If true, a transaction that conflicts with a transaction of higher priority waits "
+            "for it to commit or abort, instead of failing with a conflict error.");
+TAG_FLAG(enable_wait_queues, advanced);
+TAG_FLAG(enable_wait_queues, runtime);
+
+DEFINE_uint64(wait_queue_max_wait_ms, 2000,
+              "Max time a request could spend in the wait queue, before failing with the "
+              "original conflict error.");
+TAG_FLAG(wait_queue_max_wait_ms, advanced);
+TAG_FLAG(wait_queue_max_wait_ms, runtime);
+
+DEFINE_uint64(wait_queue_refresh_interval_ms, 1000,
+              "Requests in the wait queue recheck the status of their blockers at least this "
+              "often, in case the blocker was resolved without notifying the tablet.");
+TAG_FLAG(wait_queue_refresh_interval_ms, advanced);
+TAG_FLAG(wait_queue_refresh_interval_ms, runtime);
+
+METRIC_DEFINE_simple_gauge_uint64(
+    tablet, wait_queue_waiters, "Number of requests waiting for conflicting transactions",
+    yb::MetricUnit::kRequests);
+METRIC_DEFINE_coarse_histogram(
+    tablet, wait_queue_wait_time, "Wait Queue Wait Time", yb::MetricUnit::kMicroseconds,
+    "Time spent by requests in the wait queue, waiting for conflicting transactions.");
+
+namespace yb {
+namespace docdb {
+
+namespace {
+
+// Number of recently resolved transactions remembered by the wait queue, so request that
+// observed blocker as pending right before it was resolved does not wait for it.
+constexpr size_t kRecentlyResolvedCacheSize = 1024;
+
+struct Waiter {
+  TransactionId id;
+  TransactionIdSet blockers;
+  CoarseTimePoint start;
+  CoarseTimePoint refresh_time;
+  CoarseTimePoint deadline;
+  WaiterCallback callback;
+};
+
+using WaiterPtr = std::shared_ptr<Waiter>;
+
+} // namespace
+
+class WaitQueue::Impl {
+ public:
+  Impl(const std::string& log_prefix, WaitQueueExecutor executor,
+       const scoped_refptr<MetricEntity>& metric_entity)
+      : log_prefix_(log_prefix), executor_(std::move(executor)) {
+    if (metric_entity) {
+      metric_waiters_ = METRIC_wait_queue_waiters.Instantiate(metric_entity, 0);
+      metric_wait_time_ = METRIC_wait_queue_wait_time.Instantiate(metric_entity);
+    }
+  }
+
+  ~Impl() {
+    StartShutdown();
+  }
+
+  void WaitOn(const TransactionId& waiter_id, const TransactionIdSet& blockers,
+              CoarseTimePoint deadline, WaiterCallback callback) {
+    auto now = CoarseMonoClock::now();
+    auto waiter = std::make_shared<Waiter>(Waiter {
+      .id = waiter_id,
+      .blockers = blockers,
+      .start = now,
+      .refresh_time = now + 1ms * GetAtomicFlag(&FLAGS_wait_queue_refresh_interval_ms),
+      .deadline = std::min(deadline, now + 1ms * GetAtomicFlag(&FLAGS_wait_queue_max_wait_ms)),
+      .callback = std::move(callback),
+    });
+    Status status;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (shutting_down_) {
+        status = STATUS(Aborted, "Wait queue is shutting down");
+      } else if (!AnyRecentlyResolvedUnlocked(blockers)) {
+        VLOG_WITH_PREFIX(4) << waiter_id << " waits for " << AsString(blockers);
+        for (const auto& blocker : blockers) {
+          waiters_.emplace(blocker, waiter);
+        }
+        UpdateWaitersMetricUnlocked(1);
+        return;
+      }
+      // Otherwise blocker was resolved after the waiter observed it as pending, so retry right
+      // away.
+    }
+    Resume(waiter, status);
+  }
+
+  void SignalResolved(const TransactionId& id) {
+    std::vector<WaiterPtr> resumed;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      recently_resolved_.Insert(id);
+      auto range = waiters_.equal_range(id);
+      if (range.first == range.second) {
+        return;
+      }
+      for (auto it = range.first; it != range.second; ++it) {
+        resumed.push_back(it->second);
+      }
+      for (const auto& waiter : resumed) {
+        RemoveUnlocked(waiter);
+      }
+    }
+    VLOG_WITH_PREFIX(4) << id << " resolved, resuming " << resumed.size() << " waiters";
+    for (const auto& waiter : resumed) {
+      Resume(waiter, Status::OK());
+    }
+  }
+
+  void Poll(CoarseTimePoint now) {
+    std::vector<std::pair<WaiterPtr, Status>> resumed;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      // Waiter blocked by several transactions has several entries, so visit it only once.
+      std::unordered_set<Waiter*> visited;
+      for (const auto& entry : waiters_) {
+        const auto& waiter = entry.second;
+        if (!visited.insert(waiter.get()).second) {
+          continue;
+        }
+        if (waiter->deadline <= now) {
+          resumed.emplace_back(waiter, STATUS_FORMAT(
+              TimedOut, "Wait for $0 timed out", AsString(waiter->blockers)));
+        } else if (waiter->refresh_time <= now) {
+          resumed.emplace_back(waiter, Status::OK());
+        }
+      }
+      for (const auto& p : resumed) {
+        RemoveUnlocked(p.first);
+      }
+    }
+    for (const auto& p : resumed) {
+      Resume(p.first, p.second);
+    }
+  }
+
+  void StartShutdown() {
+    std::vector<WaiterPtr> resumed;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (shutting_down_) {
+        return;
+      }
+      shutting_down_ = true;
+      std::unordered_set<Waiter*> visited;
+      for (const auto& entry : waiters_) {
+        if (visited.insert(entry.second.get()).second) {
+          resumed.push_back(entry.second);
+        }
+      }
+      waiters_.clear();
+      UpdateWaitersMetricUnlocked(-static_cast<int64_t>(resumed.size()));
+    }
+    for (const auto& waiter : resumed) {
+      Resume(waiter, STATUS(Aborted, "Wait queue is shutting down"));
+    }
+  }
+
+  size_t NumWaiters() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return num_waiters_;
+  }
+
+ private:
+  bool AnyRecentlyResolvedUnlocked(const TransactionIdSet& blockers) REQUIRES(mutex_) {
+    for (const auto& blocker : blockers) {
+      // LRUCache does not provide lookup, so erase and insert entry back to check it.
+      if (recently_resolved_.Erase(blocker)) {
+        recently_resolved_.Insert(blocker);
+        return true;
+      }
+    }
+    return false;
+  }
+
+  void RemoveUnlocked(const WaiterPtr& waiter) REQUIRES(mutex_) {
+    for (const auto& blocker : waiter->blockers) {
+      auto range = waiters_.equal_range(blocker);
+      for (auto it = range.first; it != range.second; ++it) {
+        if (it->second == waiter) {
+          waiters_.erase(it);
+          break;
+        }
+      }
+    }
+    UpdateWaitersMetricUnlocked(-1);
+  }
+
+  void UpdateWaitersMetricUnlocked(int64_t delta) REQUIRES(mutex_) {
+    num_waiters_ += delta;
+    if (metric_waiters_) {
+      metric_waiters_->set_value(num_waiters_);
+    }
+  }
+
+  void Resume(const WaiterPtr& waiter, const Status& status) {
+    if (metric_wait_time_) {
+      metric_wait_time_->Increment(ToMicroseconds(CoarseMonoClock::now() - waiter->start));
+    }
+    executor_(std::move(waiter->callback), status);
+  }
+
+  const std::string& LogPrefix() const {
+    return log_prefix_;
+  }
+
+  const std::string log_prefix_;
+  const WaitQueueExecutor executor_;
+
+  mutable std::mutex mutex_;
+  bool shutting_down_ GUARDED_BY(mutex_) = false;
+  // Waiters keyed by the id of the blocking transaction. Waiter that is blocked by several
+  // transactions is stored under each of them, and resumed when any of them is resolved.
+  std::unordered_multimap<TransactionId, WaiterPtr, TransactionIdHash> waiters_
+      GUARDED_BY(mutex_);
+  size_t num_waiters_ GUARDED_BY(mutex_) = 0;
+  // Guarded by mutex_.
+  LRUCache<TransactionId> recently_resolved_{kRecentlyResolvedCacheSize};
+
+  scoped_refptr<AtomicGauge<uint64_t>> metric_waiters_;
+  scoped_refptr<Histogram> metric_wait_time_;
+};
+
+WaitQueue::WaitQueue(const std::string& log_prefix, WaitQueueExecutor executor,
+                     const scoped_refptr<MetricEntity>& metric_entity)
+    : impl_(new Impl(log_prefix, std::move(executor), metric_entity)) {
+}
+
+WaitQueue::~WaitQueue() {
+}
+
+void WaitQueue::WaitOn(const TransactionId& waiter, const TransactionIdSet& blockers,
+                       CoarseTimePoint deadline, WaiterCallback callback) {
+  impl_->WaitOn(waiter, blockers, deadline, std::move(callback));
+}
+
+void WaitQueue::SignalResolved(const TransactionId& id) {
+  impl_->SignalResolved(id);
+}
+
+void WaitQueue::Poll(CoarseTimePoint now) {
+  impl_->Poll(now);
+}
+
+void WaitQueue::StartShutdown() {
+  impl_->StartShutdown();
+}
+
+size_t WaitQueue::TEST_NumWaiters() const {
+  return impl_->NumWaiters();
+}
+
+bool WaitQueuesEnabled() {
+  return GetAtomicFlag(&FLAGS_enable_wait_queues);
+}
+
+} // namespace docdb
+} // namespace yb
@@ -0,0 +1,87 @@
+// Copyright (c) YugaByte, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+// in compliance with the License.  You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied.  See the License for the specific language governing permissions and limitations
+// under the License.
+//
+
+#ifndef YB_DOCDB_WAIT_QUEUE_H
+#define YB_DOCDB_WAIT_QUEUE_H
+
+#include <functional>
+#include <memory>
+
+#include "yb/common/transaction.h"
+
+#include "yb/gutil/ref_counted.h"
+
+#include "yb/util/monotime.h"
+#include "yb/util/status.h"
+
+namespace yb {
+
+class MetricEntity;
+
+namespace docdb {
+
+// Invoked exactly once for each waiter.
+// OK - one of the blockers was resolved, or the waiter should recheck the status of its blockers.
+// TimedOut - the waiter reached its deadline.
+// Aborted - the wait queue is shutting down.
+using WaiterCallback = std::function<void(const Status&)>;
+
+// Used to invoke waiter callbacks asynchronously, since blockers are usually resolved while the
+// transaction participant holds its mutex.
+using WaitQueueExecutor = std::function<void(WaiterCallback callback, const Status& status)>;
+
+// Per tablet queue of write requests that conflict with transactions of higher priority.
+// Instead of failing with a conflict error, such a request releases its locks and parks in this
+// queue, keyed by the ids of the blocking transactions. It is resumed to rerun conflict resolution
+// when the transaction participant signals that any of the blockers was committed or aborted.
+//
+// Since a transaction only waits for transactions of higher priority, while conflicting
+// transactions of lower priority are still aborted, wait-for edges always point to a transaction
+// with strictly higher priority. So waits could not form a cycle, even across tablets, and no
+// separate deadlock detection is required.
+class WaitQueue {
+ public:
+  WaitQueue(const std::string& log_prefix, WaitQueueExecutor executor,
+            const scoped_refptr<MetricEntity>& metric_entity);
+  ~WaitQueue();
+
+  // Parks waiter until any of blockers is resolved. Waiter is also periodically resumed, to
+  // recheck the status of blockers, in case blocker was resolved without notifying this tablet.
+  void WaitOn(const TransactionId& waiter, const TransactionIdSet& blockers,
+              CoarseTimePoint deadline, WaiterCallback callback);
+
+  // Notifies the queue that the transaction with specified id was committed or aborted, so
+  // transactions blocked by it could proceed.
+  void SignalResolved(const TransactionId& id);
+
+  // Resumes waiters that should recheck their blockers and fails waiters that reached deadline.
+  void Poll(CoarseTimePoint now);
+
+  // Fails all current waiters and rejects new ones.
+  void StartShutdown();
+
+  size_t TEST_NumWaiters() const;
+
+ private:
+  class Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+// Returns true if transactions that conflict with transactions of higher priority should wait
+// for them instead of failing.
+bool WaitQueuesEnabled();
+
+} // namespace docdb
+} // namespace yb
+
+#endif // YB_DOCDB_WAIT_QUEUE_H
@@ -552,6 +552,7 @@ class CompactionTestWithFileExpiration : public CompactionTest {
   bool CheckEachDbHasExactlyNumFiles(size_t num_files);
   bool CheckEachDbHasAtLeastNumFiles(size_t num_files);
   bool CheckAtLeastFileExpirationsPerDb(size_t num_expirations);
+  Result<double> MeasureWriteAmplification(MonoDelta compaction_time_window);
   int table_ttl_to_use() override {
     return kTableTTLSec;
   }
@@ -935,6 +936,58 @@ TEST_F(CompactionTestWithFileExpiration, LargeFileDoesNotPreventExpiration) {
   ASSERT_EQ(CountUnfilteredSSTFiles(), files_compacted_without_expiration);
 }
 
+// Runs TTL workload on a new table and returns its write amplification, i.e. ratio of bytes
+// written by flushes and compactions to bytes written by flushes. The table is dropped afterwards.
+Result<double> CompactionTestWithFileExpiration::MeasureWriteAmplification(
+    MonoDelta compaction_time_window) {
+  constexpr int kWorkloadTableTTLSec = 3;
+  constexpr auto kWorkloadDuration = 15s;
+
+  SetupWorkload(IsolationLevel::NON_TRANSACTIONAL);
+  auto alterer = client_->NewTableAlterer(workload_->table_name());
+  TableProperties table_properties;
+  table_properties.SetDefaultTimeToLive(kWorkloadTableTTLSec * MonoTime::kMillisecondsPerSecond);
+  if (compaction_time_window.Initialized()) {
+    table_properties.SetCompactionTimeWindow(compaction_time_window.ToMilliseconds());
+  }
+  alterer->SetTableProperties(table_properties);
+  RETURN_NOT_OK(alterer->Alter());
+
+  workload_->Start();
+  SleepFor(kWorkloadDuration);
+  workload_->StopAndJoin();
+  LogSizeAndFilesInDbs(true);
+
+  uint64_t flush_bytes = 0;
+  uint64_t compaction_bytes = 0;
+  for (auto* db : GetAllRocksDbs(cluster_.get(), false)) {
+    auto stats = db->GetOptions().statistics;
+    flush_bytes += stats->getTickerCount(rocksdb::FLUSH_WRITE_BYTES);
+    compaction_bytes += stats->getTickerCount(rocksdb::COMPACT_WRITE_BYTES);
+  }
+  SCHECK(flush_bytes > 0, IllegalState, "Nothing was flushed");
+  const auto write_amplification =
+      static_cast<double>(flush_bytes + compaction_bytes) / flush_bytes;
+  LOG(INFO) << "Compaction time window: " << compaction_time_window
+            << ", flushed bytes: " << flush_bytes << ", compacted bytes: " << compaction_bytes
+            << ", write amplification: " << write_amplification;
+
+  RETURN_NOT_OK(client_->DeleteTable(workload_->table_name()));
+  return write_amplification;
+}
+
+TEST_F(CompactionTestWithFileExpiration, TimeWindowCompactionReducesWriteAmplification) {
+  ANNOTATE_UNPROTECTED_WRITE(FLAGS_rocksdb_level0_file_num_compaction_trigger) = 3;
+
+  const auto universal_write_amp = ASSERT_RESULT(MeasureWriteAmplification(MonoDelta()));
+  const auto time_window_write_amp = ASSERT_RESULT(
+      MeasureWriteAmplification(MonoDelta::FromSeconds(1)));
+
+  // Expired windows are dropped as a whole and fresh data is never merged into old files, so
+  // less data is rewritten by compactions.
+  ASSERT_LT(time_window_write_amp, universal_write_amp);
+}
+
 class FileExpirationWithRF3 : public CompactionTestWithFileExpiration {
  public:
   void SetUp() override {
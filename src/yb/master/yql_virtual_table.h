@@ -113,6 +113,22 @@ class YQLVirtualTable : public docdb::YQLStorageIf {
     return Status::OK();
   }
 
+  CHECKED_STATUS GetIterator(uint64 stmt_id,
+                             const Schema& projection,
+                             const Schema& schema,
+                             const TransactionOperationContext& txn_op_context,
+                             CoarseTimePoint deadline,
+                             const ReadHybridTime& read_time,
+                             const std::vector<Slice>& ybctids,
+                             docdb::YQLRowwiseIteratorIf::UniPtr* iter) const override {
+    return STATUS(NotSupported, "Postgresql virtual tables are not yet implemented");
+  }
+
+  Result<std::vector<rocksdb::DataBlockBounds>> SampleDataBlocks(
+      size_t max_blocks, uint64_t* num_blocks) const override {
+    return STATUS(NotSupported, "Virtual tables do not have data blocks");
+  }
+
  protected:
   // Finds the given column name in the schema and updates the specified column in the given row
   // with the provided value.
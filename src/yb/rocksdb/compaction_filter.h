@@ -24,6 +24,7 @@
 #ifndef YB_ROCKSDB_COMPACTION_FILTER_H
 #define YB_ROCKSDB_COMPACTION_FILTER_H
 
+#include <functional>
 #include <memory>
 #include <string>
 #include <vector>
@@ -192,6 +193,14 @@ class CompactionFileFilterFactory {
   virtual std::unique_ptr<CompactionFileFilter> CreateCompactionFileFilter(
       const std::vector<FileMetaData*>& input_files) = 0;
 
+  // Returns a function mapping a file to the id of the time window it belongs to, or an empty
+  // function when files are not bucketed by time. Universal compaction never compacts files from
+  // different time windows together, so old windows are not rewritten again and again with fresh
+  // data and could be dropped as a whole by the file filter once expired.
+  virtual std::function<uint64_t(const FileMetaData&)> GetTimeWindowFunction() {
+    return nullptr;
+  }
+
   // Returns a name that identifies this compaction filter factory.
   virtual const char* Name() const = 0;
 };
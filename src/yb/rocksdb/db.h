@@ -914,6 +914,12 @@ class DB {
   // Returns approximate middle key (see Version::GetMiddleKey).
   virtual yb::Result<std::string> GetMiddleKey() = 0;
 
+  // Picks up to max_blocks random key ranges (see Version::SampleDataBlocks).
+  virtual yb::Result<std::vector<DataBlockBounds>> SampleDataBlocks(
+      size_t max_blocks, uint64_t* num_blocks) {
+    return STATUS(NotSupported, "SampleDataBlocks() not supported");
+  }
+
   // Used in testing to make the old memtable immutable and start writing to a new one.
   virtual void TEST_SwitchMemtable() {}
 
@@ -23,6 +23,7 @@
 
 #include "yb/rocksdb/db/builder.h"
 
+#include <inttypes.h>
 #include <stdint.h>
 
 #include <algorithm>
@@ -119,7 +120,8 @@ Status BuildTable(const std::string& dbname,
                   InternalStats* internal_stats,
                   BoundaryValuesExtractor* boundary_values_extractor,
                   const Env::IOPriority io_priority,
-                  TableProperties* table_properties) {
+                  TableProperties* table_properties,
+                  const FlushRecordFilter& record_filter) {
   // Reports the IOStats for flush for every following bytes.
   const size_t kReportFlushIOStatsEvery = 1048576;
   Status s;
@@ -157,10 +159,21 @@ Status BuildTable(const std::string& dbname,
                               &merge, kMaxSequenceNumber, &snapshots,
                               earliest_write_conflict_snapshot,
                               true /* internal key corruption is not ok */);
+    uint64_t num_filtered = 0;
     c_iter.SeekToFirst();
     for (; c_iter.Valid(); c_iter.Next()) {
       const Slice& key = c_iter.key();
       const Slice& value = c_iter.value();
+      if (record_filter && c_iter.ikey().type == kTypeValue) {
+        auto keep = record_filter(c_iter.ikey().user_key, value);
+        if (!keep.ok()) {
+          RLOG(InfoLogLevel::WARNING_LEVEL, ioptions.info_log,
+               "Flush record filter failed: %s", keep.status().ToString().c_str());
+        } else if (!*keep) {
+          ++num_filtered;
+          continue;
+        }
+      }
       builder->Add(key, value);
       auto boundaries = MakeFileBoundaryValues(boundary_values_extractor, key, value);
       if (!boundaries) {
@@ -171,6 +184,11 @@ Status BuildTable(const std::string& dbname,
       meta->UpdateBoundaries(std::move(boundary_values.key), boundary_values);
     }
 
+    if (num_filtered) {
+      RLOG(InfoLogLevel::INFO_LEVEL, ioptions.info_log,
+           "Flush record filter removed %" PRIu64 " records", num_filtered);
+    }
+
     // Finish and check for builder errors
     bool empty = builder->NumEntries() == 0;
     s = c_iter.status();
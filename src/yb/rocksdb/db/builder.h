@@ -75,6 +75,7 @@ TableBuilder* NewTableBuilder(const ImmutableCFOptions& options,
 // *meta will be filled with metadata about the generated table.
 // If no data is present in *iter, meta->total_file_size will be set to
 // zero, and no Table file will be produced.
+// Value records rejected by record_filter, when specified, are not written to the file.
 extern Status BuildTable(
     const std::string& dbname,
     Env* env,
@@ -94,7 +95,8 @@ extern Status BuildTable(
     InternalStats* internal_stats,
     BoundaryValuesExtractor* boundary_values_extractor,
     const Env::IOPriority io_priority = Env::IO_HIGH,
-    TableProperties* table_properties = nullptr);
+    TableProperties* table_properties = nullptr,
+    const FlushRecordFilter& record_filter = FlushRecordFilter());
 
 }  // namespace rocksdb
 
@@ -1269,7 +1269,22 @@ std::vector<std::vector<UniversalCompactionPicker::SortedRun>>
   std::vector<std::vector<SortedRun>> ret(1);
   MarkL0FilesForDeletion(&vstorage, &ioptions);
 
+  std::function<uint64_t(const FileMetaData&)> time_window_function;
+  if (ioptions.compaction_file_filter_factory) {
+    time_window_function = ioptions.compaction_file_filter_factory->GetTimeWindowFunction();
+  }
+  uint64_t last_time_window = 0;
+
   for (FileMetaData* f : vstorage.LevelFiles(0)) {
+    // Start new sequence at the time window boundary, so files from different time windows are
+    // never compacted together.
+    if (time_window_function) {
+      const auto time_window = time_window_function(*f);
+      if (time_window != last_time_window && !ret.back().empty()) {
+        ret.emplace_back();
+      }
+      last_time_window = time_window;
+    }
     // Any files that can be directly removed during compaction can be included, even if they
     // exceed the "max file size for compaction."
     if (f->fd.GetTotalFileSize() <= max_file_size || f->delete_after_compaction) {
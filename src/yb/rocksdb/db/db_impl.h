@@ -483,6 +483,9 @@ class DBImpl : public DB {
 
   Result<std::string> GetMiddleKey() override;
 
+  Result<std::vector<DataBlockBounds>> SampleDataBlocks(
+      size_t max_blocks, uint64_t* num_blocks) override;
+
   // Used in testing to make the old memtable immutable and start writing to a new one.
   void TEST_SwitchMemtable() override;
 
@@ -964,6 +967,9 @@ class DBImpl : public DB {
   // The options to access storage files
   const EnvOptions env_options_;
 
+  // The options to write SST files by flush and compaction.
+  const EnvOptions env_options_for_compaction_;
+
 #ifndef ROCKSDB_LITE
   WalManager wal_manager_;
 #endif  // ROCKSDB_LITE
@@ -20,9 +20,15 @@
 // Copyright (c) 2011 The LevelDB Authors. All rights reserved.
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file. See the AUTHORS file for names of contributors.
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
 #include "yb/rocksdb/db/db_test_util.h"
 #include "yb/rocksdb/port/stack_trace.h"
 
+DECLARE_int32(rocksdb_compaction_readahead_blocks);
+
 namespace rocksdb {
 
 class DBTest2 : public DBTestBase {
@@ -71,6 +77,109 @@ TEST_F(DBTest2, IteratorPropertyVersionNumber) {
   delete iter2;
   delete iter3;
 }
+
+TEST_F(DBTest2, SampleDataBlocks) {
+  Options options = CurrentOptions();
+  BlockBasedTableOptions table_options;
+  table_options.block_size = 1024;
+  options.table_factory.reset(NewBlockBasedTableFactory(table_options));
+  DestroyAndReopen(options);
+
+  constexpr int kNumKeys = 1000;
+  Random rnd(301);
+  for (int i = 0; i < kNumKeys; ++i) {
+    ASSERT_OK(Put(Key(i), RandomString(&rnd, 100)));
+  }
+  ASSERT_OK(Flush());
+  // Smaller SST file that overlaps the first one and has keys after its last key.
+  for (int i = kNumKeys / 2; i < kNumKeys * 3 / 2; i += 10) {
+    ASSERT_OK(Put(Key(i), RandomString(&rnd, 100)));
+  }
+  ASSERT_OK(Flush());
+
+  // When all ranges are picked, every key of both SST files belongs to exactly one of them.
+  uint64_t num_blocks = 0;
+  auto blocks = ASSERT_RESULT(db_->SampleDataBlocks(kNumKeys, &num_blocks));
+  ASSERT_GT(num_blocks, 10);
+  ASSERT_EQ(num_blocks, blocks.size());
+  for (int i = 0; i < kNumKeys * 3 / 2; ++i) {
+    const auto key = Key(i);
+    int num_matches = 0;
+    for (const auto& block : blocks) {
+      if ((block.lower_bound.empty() || key > block.lower_bound) &&
+          (block.upper_bound.empty() || key <= block.upper_bound)) {
+        ++num_matches;
+      }
+    }
+    ASSERT_EQ(num_matches, 1) << key;
+  }
+
+  blocks = ASSERT_RESULT(db_->SampleDataBlocks(5, &num_blocks));
+  ASSERT_EQ(blocks.size(), 5);
+  ASSERT_GT(num_blocks, 10);
+  for (const auto& block : blocks) {
+    ASSERT_TRUE(block.upper_bound.empty() || block.lower_bound < block.upper_bound);
+  }
+}
+
+// Measures latency of point reads while compaction is running, with and without batched readahead
+// of compaction input.
+TEST_F(DBTest2, ReadLatencyDuringCompaction) {
+  constexpr int kNumFiles = 4;
+  constexpr int kKeysPerFile = 5000;
+  constexpr int kNumKeys = kNumFiles * kKeysPerFile;
+
+  for (int readahead_blocks : {0, 8}) {
+    FLAGS_rocksdb_compaction_readahead_blocks = readahead_blocks;
+    Options options = CurrentOptions();
+    options.statistics = rocksdb::CreateDBStatisticsForTests();
+    options.disable_auto_compactions = true;
+    BlockBasedTableOptions table_options;
+    table_options.block_size = 4096;
+    options.table_factory.reset(NewBlockBasedTableFactory(table_options));
+    DestroyAndReopen(options);
+
+    Random rnd(301);
+    for (int file = 0; file != kNumFiles; ++file) {
+      for (int i = file; i < kNumKeys; i += kNumFiles) {
+        ASSERT_OK(Put(Key(i), RandomString(&rnd, 200)));
+      }
+      ASSERT_OK(Flush());
+    }
+
+    std::atomic<bool> compaction_done{false};
+    std::thread compaction_thread([this, &compaction_done] {
+      ASSERT_OK(db_->CompactRange(CompactRangeOptions(), nullptr, nullptr));
+      compaction_done.store(true, std::memory_order_release);
+    });
+
+    std::vector<int64_t> latencies_us;
+    while (!compaction_done.load(std::memory_order_acquire)) {
+      const auto start = std::chrono::steady_clock::now();
+      const auto value = Get(Key(rnd.Uniform(kNumKeys)));
+      latencies_us.push_back(std::chrono::duration_cast<std::chrono::microseconds>(
+          std::chrono::steady_clock::now() - start).count());
+      ASSERT_NE(value, "NOT_FOUND");
+    }
+    compaction_thread.join();
+
+    if (!latencies_us.empty()) {
+      const size_t p99_index = latencies_us.size() * 99 / 100;
+      std::nth_element(latencies_us.begin(), latencies_us.begin() + p99_index, latencies_us.end());
+      LOG(INFO) << "Readahead blocks: " << readahead_blocks << ", reads: " << latencies_us.size()
+                << ", p99 read latency: " << latencies_us[p99_index] << "us";
+    }
+
+    const auto blocks_read_by_batch = TestGetTickerCount(options, NUMBER_BLOCKS_READ_BY_BATCH);
+    if (readahead_blocks > 1) {
+      ASSERT_GT(blocks_read_by_batch, 0);
+    } else {
+      ASSERT_EQ(blocks_read_by_batch, 0);
+    }
+  }
+  FLAGS_rocksdb_compaction_readahead_blocks = 0;
+}
+
 }  // namespace rocksdb
 
 int main(int argc, char** argv) {
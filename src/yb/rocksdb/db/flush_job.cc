@@ -285,6 +285,10 @@ Result<FileNumbersHolder> FlushJob::WriteLevel0Table(
 
       TEST_SYNC_POINT_CALLBACK("FlushJob::WriteLevel0Table:output_compression",
                                &output_compression_);
+      FlushRecordFilter record_filter;
+      if (db_options_.flush_record_filter_factory) {
+        record_filter = (*db_options_.flush_record_filter_factory)();
+      }
       s = BuildTable(dbname_,
                      db_options_.env,
                      *cfd_->ioptions(),
@@ -303,7 +307,8 @@ Result<FileNumbersHolder> FlushJob::WriteLevel0Table(
                      cfd_->internal_stats(),
                      db_options_.boundary_extractor.get(),
                      Env::IO_HIGH,
-                     &table_properties_);
+                     &table_properties_,
+                     record_filter);
       info.table_properties = table_properties_;
       LogFlush(db_options_.info_log);
     }
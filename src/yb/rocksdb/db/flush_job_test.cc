@@ -241,6 +241,52 @@ TEST_F(FlushJobTest, Snapshots) {
   job_context.Clean();
 }
 
+TEST_F(FlushJobTest, RecordFilter) {
+  JobContext job_context(0);
+  auto cfd = versions_->GetColumnFamilySet()->GetDefault();
+  auto new_mem = cfd->ConstructNewMemtable(*cfd->GetLatestMutableCFOptions(),
+                                           kMaxSequenceNumber);
+  new_mem->Ref();
+  auto inserted_keys = mock::MakeMockFile();
+  for (int i = 1; i < 1000; ++i) {
+    std::string key(ToString(i));
+    std::string value("value" + key);
+    new_mem->Add(SequenceNumber(i), kTypeValue, key, value);
+    // Filter drops values of odd keys.
+    if (i % 2 == 0) {
+      InternalKey internal_key(key, SequenceNumber(i), kTypeValue);
+      inserted_keys.emplace(internal_key.Encode().ToBuffer(), value);
+    }
+  }
+
+  autovector<MemTable*> to_delete;
+  cfd->imm()->Add(new_mem, &to_delete);
+  for (auto& m : to_delete) {
+    delete m;
+  }
+
+  db_options_.flush_record_filter_factory =
+      std::make_shared<std::function<FlushRecordFilter()>>([] {
+    return [](const Slice& user_key, const Slice& value) -> yb::Result<bool> {
+      return std::stoi(user_key.ToBuffer()) % 2 == 0;
+    };
+  });
+
+  EventLogger event_logger(db_options_.info_log.get());
+  FileNumbersProvider file_numbers_provider(versions_.get());
+  FlushJob flush_job(
+      dbname_, versions_->GetColumnFamilySet()->GetDefault(), db_options_,
+      *cfd->GetLatestMutableCFOptions(), env_options_, versions_.get(), &mutex_, &shutting_down_,
+      &disable_flush_on_shutdown_, {}, kMaxSequenceNumber, MemTableFilter(), &file_numbers_provider,
+      &job_context, nullptr, nullptr, nullptr, kNoCompression, nullptr, &event_logger);
+  {
+    InstrumentedMutexLock l(&mutex_);
+    ASSERT_OK(yb::ResultToStatus(flush_job.Run()));
+  }
+  mock_table_factory_->AssertSingleFile(inserted_keys);
+  job_context.Clean();
+}
+
 }  // namespace rocksdb
 
 int main(int argc, char** argv) {
@@ -44,6 +44,7 @@
 #include "yb/gutil/casts.h"
 
 #include "yb/util/format.h"
+#include "yb/util/random_util.h"
 #include "yb/util/status_format.h"
 
 #include "yb/rocksdb/db/filename.h"
@@ -75,6 +76,12 @@
 #include "yb/rocksdb/util/stop_watch.h"
 #include "yb/rocksdb/util/sync_point.h"
 
+#include "yb/util/flag_tags.h"
+
+DEFINE_int32(rocksdb_compaction_readahead_blocks, 0,
+             "Number of data blocks read by a single batched read during compaction. Values below "
+             "2 disable batching, so every data block is read separately.");
+
 namespace rocksdb {
 
 namespace {
@@ -2087,6 +2094,61 @@ Result<std::string> Version::GetMiddleKey() {
   return trwh.table_reader->GetMiddleKey();
 }
 
+Result<std::vector<DataBlockBounds>> Version::SampleDataBlocks(
+    size_t max_blocks, uint64_t* num_blocks) {
+  // Data blocks of different SST files overlap, so picking among blocks of all files would count
+  // rows present in several files more than once. Instead data blocks of the largest SST file split
+  // the whole key space into non-overlapping ranges, and the ranges are picked.
+  const FileMetaData* largest_sst_meta = nullptr;
+  int largest_sst_level = 0;
+  for (int level = 0; level < storage_info_.num_non_empty_levels(); ++level) {
+    for (const auto* file : storage_info_.LevelFiles(level)) {
+      if (!largest_sst_meta ||
+          file->fd.GetTotalFileSize() > largest_sst_meta->fd.GetTotalFileSize()) {
+        largest_sst_meta = file;
+        largest_sst_level = level;
+      }
+    }
+  }
+  *num_blocks = 0;
+  if (!largest_sst_meta) {
+    return std::vector<DataBlockBounds>();
+  }
+
+  const auto trwh = VERIFY_RESULT(table_cache_->GetTableReader(
+      vset_->env_options_, cfd_->internal_comparator(), largest_sst_meta->fd, kDefaultQueryId,
+      /* no_io =*/ false, cfd_->internal_stats()->GetFileReadHist(largest_sst_level),
+      IsFilterSkipped(largest_sst_level)));
+
+  // Reservoir sampling over the key ranges. Index key of the previous data block is the lower
+  // bound of the current range.
+  std::vector<DataBlockBounds> blocks;
+  blocks.reserve(max_blocks);
+  uint64_t seen_blocks = 0;
+  std::string prev_key;
+  auto add_range = [&blocks, &seen_blocks, &prev_key, max_blocks](const Slice& upper_bound) {
+    size_t idx = blocks.size();
+    if (idx < max_blocks) {
+      blocks.emplace_back();
+    } else {
+      idx = yb::RandomUniformInt<uint64_t>(0, seen_blocks);
+    }
+    if (idx < max_blocks) {
+      blocks[idx].lower_bound = prev_key;
+      blocks[idx].upper_bound = upper_bound.ToBuffer();
+    }
+    prev_key.assign(upper_bound.cdata(), upper_bound.size());
+    ++seen_blocks;
+  };
+  RETURN_NOT_OK(trwh.table_reader->IterateDataBlockKeys([&add_range](const Slice& key) {
+    add_range(ExtractUserKey(key));
+  }));
+  // Keys of other SST files that are greater than the last key of the largest one.
+  add_range(Slice());
+  *num_blocks = seen_blocks;
+  return blocks;
+}
+
 // this is used to batch writes to the manifest file
 struct VersionSet::ManifestWriter {
   Status status;
@@ -2113,7 +2175,8 @@ VersionSet::VersionSet(const std::string& dbname, const DBOptions* db_options,
       dbname_(dbname),
       db_options_(db_options),
       env_options_(storage_options),
-      env_options_compactions_(env_options_) {}
+      env_options_compactions_(
+          env_->OptimizeForCompactionTableRead(env_options_, *db_options_)) {}
 
 VersionSet::~VersionSet() {
   // we need to delete column_family_set_ because its destructor depends on
@@ -3552,6 +3615,9 @@ InternalIterator* VersionSet::MakeInputIterator(Compaction* c) {
   read_options.verify_checksums =
     c->mutable_cf_options()->verify_checksums_in_compaction;
   read_options.fill_cache = false;
+  if (FLAGS_rocksdb_compaction_readahead_blocks > 1) {
+    read_options.readahead_blocks = FLAGS_rocksdb_compaction_readahead_blocks;
+  }
   if (c->ShouldFormSubcompactions()) {
     read_options.total_order_seek = true;
   }
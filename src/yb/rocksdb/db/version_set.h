@@ -57,6 +57,7 @@
 #include "yb/rocksdb/db/file_indexer.h"
 #include "yb/rocksdb/db/write_controller.h"
 #include "yb/rocksdb/env.h"
+#include "yb/rocksdb/metadata.h"
 #include "yb/rocksdb/util/instrumented_mutex.h"
 
 namespace rocksdb {
@@ -521,6 +522,12 @@ class Version {
   // Returns Status(Incomplete) if there are no SST files for this version.
   Result<std::string> GetMiddleKey();
 
+  // Splits the key space into non-overlapping ranges by the data blocks of the largest SST file of
+  // this version, and picks up to max_blocks random ranges, every range having the same chance to
+  // be picked. Only the index of that SST file is read (see TableReader::IterateDataBlockKeys).
+  // Sets num_blocks to the total number of ranges.
+  Result<std::vector<DataBlockBounds>> SampleDataBlocks(size_t max_blocks, uint64_t* num_blocks);
+
   ColumnFamilyData* cfd() const { return cfd_; }
 
   // Return the next Version in the linked list. Used for debug only
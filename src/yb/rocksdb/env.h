@@ -97,6 +97,13 @@ struct EnvOptions : public yb::FileSystemOptions {
   // If true, then use mmap to write data
   bool use_mmap_writes = true;
 
+  // If true, then files are opened with O_DIRECT for reading, bypassing the OS page cache.
+  bool use_direct_reads = false;
+
+  // If true, then files are opened with O_DIRECT for writing, bypassing the OS page cache.
+  // Data is written by WritableFileWriter in aligned chunks using PositionedAppend.
+  bool use_direct_writes = false;
+
   // If false, fallocate() calls are bypassed
   bool allow_fallocate = true;
 
@@ -444,6 +451,16 @@ class Env {
   virtual EnvOptions OptimizeForManifestWrite(const EnvOptions& env_options)
       const;
 
+  // OptimizeForCompactionTableWrite will create a new EnvOptions object that is a copy of the
+  // EnvOptions in the parameters, but is optimized for writing SST files by flush and compaction.
+  virtual EnvOptions OptimizeForCompactionTableWrite(const EnvOptions& env_options,
+                                                     const DBOptions& db_options) const;
+
+  // OptimizeForCompactionTableRead will create a new EnvOptions object that is a copy of the
+  // EnvOptions in the parameters, but is optimized for reading compaction inputs.
+  virtual EnvOptions OptimizeForCompactionTableRead(const EnvOptions& env_options,
+                                                    const DBOptions& db_options) const;
+
   virtual bool IsPlainText() const {
     return true;
   }
@@ -294,6 +294,14 @@ struct LiveFileMetaData : SstFileMetaData {
   std::string ToString() const;
 };
 
+// Key range of a data block of SST file. User keys of the range are greater than lower_bound and
+// not greater than upper_bound. Lower bound is empty for the first range, and upper bound is empty
+// for the last range, which contains keys after the last data block of SST file.
+struct DataBlockBounds {
+  std::string lower_bound;
+  std::string upper_bound;
+};
+
 }  // namespace rocksdb
 
 #endif  // YB_ROCKSDB_METADATA_H
@@ -828,6 +828,11 @@ struct ColumnFamilyOptions {
 
 typedef std::function<yb::Result<bool>(const MemTable&)> MemTableFilter;
 
+// Invoked for each value record written by memtable flush. Returns false if the record should be
+// omitted from the flushed file.
+typedef std::function<yb::Result<bool>(const Slice& user_key, const Slice& value)>
+    FlushRecordFilter;
+
 using IteratorReplacer =
     std::function<InternalIterator*(InternalIterator*, Arena*, const Slice&)>;
 
@@ -1107,6 +1112,17 @@ struct DBOptions {
   // Default: false
   bool allow_mmap_writes;
 
+  // Use O_DIRECT for reading SST files, so user reads bypass the OS page cache and rely on
+  // the block cache only. Not supported together with allow_mmap_reads.
+  // Default: false
+  bool use_direct_reads;
+
+  // Use O_DIRECT for reading compaction inputs and writing flush and compaction outputs, so
+  // background jobs do not evict data used by foreground reads from the OS page cache.
+  // Not supported together with allow_mmap_writes.
+  // Default: false
+  bool use_direct_io_for_flush_and_compaction;
+
   // If false, fallocate() calls are bypassed
   bool allow_fallocate;
 
@@ -1340,6 +1356,9 @@ struct DBOptions {
   // Invoked after memtable switched.
   std::shared_ptr<std::function<MemTableFilter()>> mem_table_flush_filter_factory;
 
+  // Invoked before writing flushed memtables to a new file.
+  std::shared_ptr<std::function<FlushRecordFilter()>> flush_record_filter_factory;
+
   // A prefix for log messages, usually containing the tablet id.
   std::string log_prefix;
 
@@ -1517,6 +1536,12 @@ struct ReadOptions {
   // Query id designated for the read.
   QueryId query_id = kDefaultQueryId;
 
+  // When greater than 1, data blocks that are not found in block cache are read together with
+  // following blocks, up to readahead_blocks blocks in a single batched read. Intended for
+  // sequential scans without block cache, such as compaction.
+  // Default: 0
+  size_t readahead_blocks = 0;
+
   // Filter for pruning SST files. RocksDB user can provide its own implementation to exclude SST
   // files from being added to MergeIterator. By default doesn't filter files.
   std::shared_ptr<TableAwareReadFileFilter> table_aware_file_filter;
@@ -29,6 +29,7 @@
 namespace rocksdb {
 
 class Comparator;
+class UserFrontiers;
 
 // Table Properties that are specific to tables created by SstFileWriter.
 struct ExternalSstFilePropertyNames {
@@ -65,6 +66,9 @@ struct ExternalSstFileInfo {
   bool is_split_sst;               // is SST split into metadata and data file(s)
   uint64_t num_entries;            // number of entries in file
   int32_t version;                 // file version
+  // Frontiers recorded for the file when it is added to DB, could be null. Flushed frontier of DB
+  // is not updated, since memtable could contain earlier records.
+  const UserFrontiers* frontiers = nullptr;
 };
 
 // SstFileWriter is used to create sst files that can be added to database later
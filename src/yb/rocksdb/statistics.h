@@ -216,6 +216,9 @@ enum Tickers : uint32_t {
   COMPACTION_FILES_FILTERED,
   COMPACTION_FILES_NOT_FILTERED,
 
+  // Number of data blocks read by batched readahead, see ReadOptions::readahead_blocks.
+  NUMBER_BLOCKS_READ_BY_BATCH,
+
   // End of ticker enum.
   TICKER_ENUM_MAX,
 };
@@ -319,6 +322,8 @@ const std::vector<std::pair<Tickers, std::string>> TickersNameMap = {
 
     {COMPACTION_FILES_FILTERED, "rocksdb_compaction_files_filtered"},
     {COMPACTION_FILES_NOT_FILTERED, "rocksdb_compaction_files_not_filtered"},
+
+    {NUMBER_BLOCKS_READ_BY_BATCH, "rocksdb_number_blocks_read_by_batch"},
 };
 
 /**
@@ -35,7 +35,9 @@
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
+#include "yb/rocksdb/filter_policy.h"
 #include "yb/rocksdb/options.h"
 #include "yb/rocksdb/status.h"
 #include "yb/rocksdb/types.h"
@@ -77,6 +79,15 @@ YB_DEFINE_ENUM(IndexType,
   (kMultiLevelBinarySearch)
 );
 
+YB_DEFINE_ENUM(DataBlockIndexType,
+  // Restart points of data block are located using binary search.
+  ((kBinarySearch, 0))
+
+  // Data block additionally contains hash map from hash index key to restart interval (see
+  // DataBlockHashIndex), binary search is used as a fallback.
+  ((kBinarySearchAndHash, 1))
+);
+
 // For advanced user only
 struct BlockBasedTableOptions {
   // @flush_block_policy_factory creates the instances of flush block policy.
@@ -148,6 +159,13 @@ struct BlockBasedTableOptions {
   // Same as block_restart_interval but used for the index block.
   int index_block_restart_interval = 1;
 
+  // Store block handles of data index entries in compact form: handle of a block which directly
+  // follows the previous block of the same index restart interval is stored as block size only (see
+  // EncodeIndexBlockHandle). Together with index_block_restart_interval > 1, which enables shared
+  // prefix compression of index keys, noticeably reduces data index size and so memory required to
+  // keep index blocks cached, at the cost of a short linear scan inside restart interval on seek.
+  bool delta_encode_index_block_handles = false;
+
   // Index block size for sharded index. Applied to data index when kMultiLevelBinarySearch is used.
   size_t index_block_size = 4_KB;
 
@@ -165,6 +183,22 @@ struct BlockBasedTableOptions {
   KeyValueEncodingFormat data_block_key_value_encoding_format =
       KeyValueEncodingFormat::kKeyDeltaEncodingSharedPrefix;
 
+  // Specifies index type to be used inside data blocks. kBinarySearchAndHash only takes effect when
+  // data_block_hash_index_key_transformer is set.
+  DataBlockIndexType data_block_index_type = DataBlockIndexType::kBinarySearch;
+
+  // For kBinarySearchAndHash: desired ratio of the number of distinct hash index keys in data
+  // block to the number of hash buckets.
+  double data_block_hash_table_util_ratio = 0.75;
+
+  // Extracts hash index key from user key for data block hash index. Also used on read path, data
+  // block hash index is ignored by readers which don't have it set.
+  // Requires: hash index key is a prefix of user key, user keys with the same hash index key are
+  // adjacent in the keys order and hash index keys of different user keys are not prefixes of each
+  // other. Empty hash index key means that the user key is not indexed.
+  // Not owned, should outlive table factory.
+  const FilterPolicy::KeyTransformer* data_block_hash_index_key_transformer = nullptr;
+
   // If non-nullptr, use the specified filter policy for new SST files to reduce disk reads.
   // Many applications will benefit from passing the result of
   // NewBloomFilterPolicy() here.
@@ -225,6 +259,10 @@ struct BlockBasedTablePropertyNames {
   static const char kPrefixFiltering[];
   // value is a uint8_t.
   static const char kDataBlockKeyValueEncodingFormat[];
+  // value is a uint8_t.
+  static const char kDataBlockIndexType[];
+  // value is "1" for true and "0" for false.
+  static const char kIndexBlockHandlesDeltaEncoded[];
 };
 
 // Create default block based table factory.
@@ -428,6 +466,13 @@ class TableFactory {
   // DocDbAwareFilterPolicy and HashedComponentsExtractor.
   virtual std::shared_ptr<TableAwareReadFileFilter> NewTableAwareReadFileFilter(
       const ReadOptions &read_options, const Slice &user_key) const { return nullptr; }
+
+  // Returns SST file filter for pruning out files which don't contain any of user_keys, used for
+  // reading a batch of keys with a single iterator. See the single key version above for details.
+  virtual std::shared_ptr<TableAwareReadFileFilter> NewTableAwareReadFileFilter(
+      const ReadOptions &read_options, const std::vector<Slice> &user_keys) const {
+    return nullptr;
+  }
 };
 
 #ifndef ROCKSDB_LITE
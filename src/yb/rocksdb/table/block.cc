@@ -175,6 +175,9 @@ void BlockIter::Seek(const Slice& target) {
   if (data_ == nullptr) {  // Not init yet
     return;
   }
+  if (data_block_hash_index_ && DataBlockHashSeek(target)) {
+    return;
+  }
   uint32_t index = 0;
   bool ok = false;
   if (prefix_index_) {
@@ -352,6 +355,10 @@ bool BlockIter::ParseNextKey() {
     FATAL_INVALID_ENUM_VALUE(KeyValueEncodingFormat, key_value_encoding_format_);
   }
 
+  if (index_block_handles_delta_encoded_ && !DecodeIndexValue()) {
+    return false;
+  }
+
   // Restore the invariant that restart_index_ is the index of restart block in which current_
   // falls.
   while (restart_index_ + 1 < num_restarts_ && GetRestartPoint(restart_index_ + 1) < current_) {
@@ -360,6 +367,19 @@ bool BlockIter::ParseNextKey() {
   return true;
 }
 
+bool BlockIter::DecodeIndexValue() {
+  Slice input = value_;
+  auto status = DecodeIndexBlockHandle(&input, &decoded_handle_);
+  if (!status.ok()) {
+    CorruptionError(status.message().ToBuffer());
+    return false;
+  }
+  char* end = EncodeVarint64(decoded_value_buffer_, decoded_handle_.offset());
+  end = EncodeVarint64(end, decoded_handle_.size());
+  decoded_value_ = Slice(decoded_value_buffer_, end);
+  return true;
+}
+
 // Binary search in restart array to find the first restart point
 // with a key >= target (TODO: this comment is inaccurate)
 bool BlockIter::BinarySeek(const Slice& target, uint32_t left, uint32_t right,
@@ -477,6 +497,35 @@ bool BlockIter::HashSeek(const Slice& target, uint32_t* index) {
   return BinarySeek(target, left, right, index);
 }
 
+bool BlockIter::DataBlockHashSeek(const Slice& target) {
+  if (target.size() < kLastInternalComponentSize) {
+    return false;
+  }
+  const auto hash_index_key =
+      data_block_hash_index_key_transformer_->Transform(ExtractUserKey(target));
+  if (hash_index_key.empty()) {
+    return false;
+  }
+  const auto restart_index = data_block_hash_index_->Lookup(hash_index_key);
+  if (restart_index >= num_restarts_) {
+    // Either kDataBlockHashIndexNoEntry or kDataBlockHashIndexCollision.
+    return false;
+  }
+
+  SeekToRestartPoint(restart_index);
+  while (ParseNextKey()) {
+    if (Compare(key_.GetKey(), target) >= 0) {
+      // Bucket could point to the restart interval of another hash index key. Since entries with
+      // the same hash index key are adjacent, we could only trust the result if we stopped at the
+      // entry with the target hash index key.
+      return key_.GetKey().starts_with(hash_index_key);
+    }
+  }
+  // Either stopped on corruption or there are no entries >= target starting from this restart
+  // interval, binary search will give the final answer in the latter case.
+  return !status_.ok();
+}
+
 bool BlockIter::PrefixSeek(const Slice& target, uint32_t* index) {
   assert(prefix_index_);
   uint32_t* block_ids = nullptr;
@@ -492,7 +541,7 @@ bool BlockIter::PrefixSeek(const Slice& target, uint32_t* index) {
 
 uint32_t Block::NumRestarts() const {
   assert(size_ >= kMinBlockSize);
-  return DecodeFixed32(data_ + size_ - sizeof(uint32_t));
+  return num_restarts_;
 }
 
 Block::Block(BlockContents&& contents)
@@ -502,9 +551,17 @@ Block::Block(BlockContents&& contents)
   if (size_ < sizeof(uint32_t)) {
     size_ = 0;  // Error marker
   } else {
-    restart_offset_ =
-        static_cast<uint32_t>(size_) - (1 + NumRestarts()) * sizeof(uint32_t);
-    if (restart_offset_ > size_ - sizeof(uint32_t)) {
+    DataBlockIndexType index_type;
+    UnpackDataBlockFooter(
+        DecodeFixed32(data_ + size_ - sizeof(uint32_t)), &index_type, &num_restarts_);
+    uint32_t restarts_end = static_cast<uint32_t>(size_) - sizeof(uint32_t);
+    if (index_type == DataBlockIndexType::kBinarySearchAndHash &&
+        !data_block_hash_index_.Initialize(data_, restarts_end, &restarts_end)) {
+      size_ = 0;
+      return;
+    }
+    restart_offset_ = restarts_end - num_restarts_ * sizeof(uint32_t);
+    if (restart_offset_ > restarts_end) {
       // The size is too small for NumRestarts() and therefore
       // restart_offset_ wrapped around.
       size_ = 0;
@@ -514,7 +571,9 @@ Block::Block(BlockContents&& contents)
 
 InternalIterator* Block::NewIterator(
     const Comparator* cmp, const KeyValueEncodingFormat key_value_encoding_format, BlockIter* iter,
-    bool total_order_seek) {
+    bool total_order_seek,
+    const FilterPolicy::KeyTransformer* data_block_hash_index_key_transformer,
+    bool index_block_handles_delta_encoded) {
   if (size_ < kMinBlockSize) {
     if (iter != nullptr) {
       iter->SetStatus(BadBlockContentsError());
@@ -544,6 +603,12 @@ InternalIterator* Block::NewIterator(
       iter = new BlockIter(cmp, data_, key_value_encoding_format, restart_offset_, num_restarts,
                            hash_index_ptr, prefix_index_ptr);
     }
+    if (data_block_hash_index_key_transformer && data_block_hash_index_.Valid()) {
+      iter->SetDataBlockHashIndex(&data_block_hash_index_, data_block_hash_index_key_transformer);
+    }
+    if (index_block_handles_delta_encoded) {
+      iter->SetIndexBlockHandlesDeltaEncoded();
+    }
   }
 
   return iter;
@@ -565,6 +630,9 @@ size_t Block::ApproximateMemoryUsage() const {
   if (prefix_index_) {
     usage += prefix_index_->ApproximateMemoryUsage();
   }
+  if (data_block_hash_index_.Valid()) {
+    usage += data_block_hash_index_.ApproximateMemoryUsage();
+  }
   return usage;
 }
 
@@ -30,11 +30,13 @@
 #include <malloc.h>
 #endif
 
+#include "yb/rocksdb/filter_policy.h"
 #include "yb/rocksdb/iterator.h"
 #include "yb/rocksdb/options.h"
 #include "yb/rocksdb/db/dbformat.h"
 #include "yb/rocksdb/table/block_prefix_index.h"
 #include "yb/rocksdb/table/block_hash_index.h"
+#include "yb/rocksdb/table/data_block_hash_index.h"
 #include "yb/rocksdb/table/format.h"
 #include "yb/rocksdb/table/internal_iterator.h"
 
@@ -83,15 +85,25 @@ class Block {
   // This option only applies for index block. For data block, hash_index_
   // and prefix_index_ are null, so this option does not matter.
   // key_value_encoding_format specifies what kind of algorithm to use for decoding entries.
-  InternalIterator* NewIterator(const Comparator* comparator,
-                                KeyValueEncodingFormat key_value_encoding_format,
-                                BlockIter* iter = nullptr,
-                                bool total_order_seek = true);
+  //
+  // If data_block_hash_index_key_transformer is not null and the block contains data block hash
+  // index, iterator will use it to locate restart interval on Seek (see DataBlockHashIndex).
+  //
+  // If index_block_handles_delta_encoded is true, block is expected to be an index block with
+  // block handles encoded by EncodeIndexBlockHandle and iterator returns them in the regular
+  // BlockHandle encoding.
+  InternalIterator* NewIterator(
+      const Comparator* comparator, KeyValueEncodingFormat key_value_encoding_format,
+      BlockIter* iter = nullptr, bool total_order_seek = true,
+      const FilterPolicy::KeyTransformer* data_block_hash_index_key_transformer = nullptr,
+      bool index_block_handles_delta_encoded = false);
 
   inline InternalIterator* NewIndexIterator(
-      const Comparator* comparator, BlockIter* iter = nullptr, bool total_order_seek = true) {
+      const Comparator* comparator, BlockIter* iter = nullptr, bool total_order_seek = true,
+      bool index_block_handles_delta_encoded = false) {
     return NewIterator(
-        comparator, kIndexBlockKeyValueEncodingFormat, iter, total_order_seek);
+        comparator, kIndexBlockKeyValueEncodingFormat, iter, total_order_seek,
+        /* data_block_hash_index_key_transformer = */ nullptr, index_block_handles_delta_encoded);
   }
 
   void SetBlockHashIndex(BlockHashIndex* hash_index);
@@ -109,6 +121,8 @@ class Block {
   const char* data_;            // contents_.data.data()
   size_t size_;                 // contents_.data.size()
   uint32_t restart_offset_;     // Offset in data_ of restart array
+  uint32_t num_restarts_ = 0;
+  DataBlockHashIndex data_block_hash_index_;
   std::unique_ptr<BlockHashIndex> hash_index_;
   std::unique_ptr<BlockPrefixIndex> prefix_index_;
 
@@ -149,6 +163,17 @@ class BlockIter : public InternalIterator {
     status_ = s;
   }
 
+  void SetDataBlockHashIndex(
+      const DataBlockHashIndex* data_block_hash_index,
+      const FilterPolicy::KeyTransformer* data_block_hash_index_key_transformer) {
+    data_block_hash_index_ = data_block_hash_index;
+    data_block_hash_index_key_transformer_ = data_block_hash_index_key_transformer;
+  }
+
+  void SetIndexBlockHandlesDeltaEncoded() {
+    index_block_handles_delta_encoded_ = true;
+  }
+
   virtual bool Valid() const override { return current_ < restarts_; }
   virtual Status status() const override { return status_; }
   virtual Slice key() const override {
@@ -157,7 +182,7 @@ class BlockIter : public InternalIterator {
   }
   virtual Slice value() const override {
     assert(Valid());
-    return value_;
+    return index_block_handles_delta_encoded_ ? decoded_value_ : value_;
   }
 
   virtual void Next() override;
@@ -197,6 +222,16 @@ class BlockIter : public InternalIterator {
   Status status_;
   BlockHashIndex* hash_index_;
   BlockPrefixIndex* prefix_index_;
+  const DataBlockHashIndex* data_block_hash_index_ = nullptr;
+  const FilterPolicy::KeyTransformer* data_block_hash_index_key_transformer_ = nullptr;
+
+  // When set, value_ points to the raw block handle encoded by EncodeIndexBlockHandle and
+  // decoded_value_ points to the same handle in the regular encoding stored in
+  // decoded_value_buffer_.
+  bool index_block_handles_delta_encoded_ = false;
+  BlockHandle decoded_handle_;
+  char decoded_value_buffer_[BlockHandle::kMaxEncodedLength];
+  Slice decoded_value_;
 
   inline int Compare(const Slice& a, const Slice& b) const {
     return comparator_->Compare(a, b);
@@ -221,6 +256,7 @@ class BlockIter : public InternalIterator {
     // ParseNextKey() starts at the end of value_, so set value_ accordingly
     uint32_t offset = GetRestartPoint(index);
     value_ = Slice(data_ + offset, 0UL);
+    decoded_handle_ = BlockHandle();
   }
 
   void SetError(const Status& error);
@@ -228,6 +264,9 @@ class BlockIter : public InternalIterator {
 
   bool ParseNextKey();
 
+  // Decodes block handle from value_ into decoded_value_.
+  bool DecodeIndexValue();
+
   bool BinarySeek(const Slice& target, uint32_t left, uint32_t right,
                   uint32_t* index);
 
@@ -241,6 +280,10 @@ class BlockIter : public InternalIterator {
 
   bool PrefixSeek(const Slice& target, uint32_t* index);
 
+  // Tries to position the iterator using data block hash index. Returns false if the hash index
+  // can't be used for the target and regular binary search should be done instead.
+  bool DataBlockHashSeek(const Slice& target);
+
 };
 
 }  // namespace rocksdb
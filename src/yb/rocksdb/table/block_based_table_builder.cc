@@ -202,12 +202,16 @@ class BlockBasedTableBuilder::BlockBasedTablePropertiesCollector
  public:
   explicit BlockBasedTablePropertiesCollector(
       BlockBasedTableBuilder::Rep* rep, IndexType index_type, bool whole_key_filtering,
-      bool prefix_filtering, const KeyValueEncodingFormat key_value_encoding_format)
+      bool prefix_filtering, const KeyValueEncodingFormat key_value_encoding_format,
+      const DataBlockIndexType data_block_index_type,
+      bool index_block_handles_delta_encoded)
       : rep_(rep),
         index_type_(index_type),
         whole_key_filtering_(whole_key_filtering),
         prefix_filtering_(prefix_filtering),
-        key_value_encoding_format_(key_value_encoding_format) {}
+        key_value_encoding_format_(key_value_encoding_format),
+        data_block_index_type_(data_block_index_type),
+        index_block_handles_delta_encoded_(index_block_handles_delta_encoded) {}
 
   virtual Status InternalAdd(const Slice& key, const Slice& value,
                              uint64_t file_size) override {
@@ -234,6 +238,8 @@ class BlockBasedTableBuilder::BlockBasedTablePropertiesCollector
   bool whole_key_filtering_;
   bool prefix_filtering_;
   KeyValueEncodingFormat key_value_encoding_format_;
+  DataBlockIndexType data_block_index_type_;
+  bool index_block_handles_delta_encoded_;
 };
 
 // Originally following data was stored in BlockBasedTableBuilder::Rep and related to a single SST
@@ -340,6 +346,16 @@ Status BlockBasedTableBuilder::BlockBasedTablePropertiesCollector::Finish(
     PutFixed8(&val, static_cast<uint8_t>(key_value_encoding_format_));
     properties->emplace(BlockBasedTablePropertyNames::kDataBlockKeyValueEncodingFormat, val);
   }
+  if (data_block_index_type_ != DataBlockIndexType::kBinarySearch) {
+    val.clear();
+    PutFixed8(&val, static_cast<uint8_t>(data_block_index_type_));
+    properties->emplace(BlockBasedTablePropertyNames::kDataBlockIndexType, val);
+  }
+  if (index_block_handles_delta_encoded_) {
+    properties->emplace(
+        BlockBasedTablePropertyNames::kIndexBlockHandlesDeltaEncoded,
+        ToBlockBasedTablePropertyValue(index_block_handles_delta_encoded_));
+  }
   return Status::OK();
 }
 
@@ -362,7 +378,9 @@ BlockBasedTableBuilder::Rep::Rep(
           _ioptions, table_options, filter_type)),
       data_block_builder(
           table_options.block_restart_interval,
-          table_options.data_block_key_value_encoding_format, table_options.use_delta_encoding),
+          table_options.data_block_key_value_encoding_format, table_options.use_delta_encoding,
+          block_based_table::GetDataBlockHashIndexKeyTransformer(table_options),
+          table_options.data_block_hash_table_util_ratio),
       internal_prefix_transform(_ioptions.prefix_extractor),
       filter_key_transformer(table_opt.filter_policy ?
           table_opt.filter_policy->GetKeyTransformer() : nullptr),
@@ -371,11 +389,10 @@ BlockBasedTableBuilder::Rep::Rep(
               table_options.index_type, internal_comparator.get(), &internal_prefix_transform,
               table_options)),
       filter_index_builder(
-          // Prefix_extractor is not used by binary search index which we use for bloom filter
-          // blocks indexing.
-          IndexBuilder::CreateIndexBuilder(
-              IndexType::kBinarySearch, BytewiseComparator(),
-              nullptr /* prefix_extractor */, table_options)),
+          // Binary search index is used for bloom filter blocks indexing. Block handles are not
+          // delta encoded there, since filter blocks are interleaved with index blocks.
+          new ShortenedIndexBuilder(
+              BytewiseComparator(), table_options.index_block_restart_interval)),
       compression_type(_compression_type),
       compression_opts(_compression_opts),
       flush_block_policy(
@@ -400,7 +417,11 @@ BlockBasedTableBuilder::Rep::Rep(
   }
   table_properties_collectors.emplace_back(new BlockBasedTablePropertiesCollector(
       this, table_options.index_type, table_options.whole_key_filtering,
-      _ioptions.prefix_extractor != nullptr, table_options.data_block_key_value_encoding_format));
+      _ioptions.prefix_extractor != nullptr, table_options.data_block_key_value_encoding_format,
+      block_based_table::GetDataBlockHashIndexKeyTransformer(table_options)
+          ? DataBlockIndexType::kBinarySearchAndHash : DataBlockIndexType::kBinarySearch,
+      table_options.delta_encode_index_block_handles &&
+          table_options.index_type != IndexType::kHashSearch));
 }
 
 BlockBasedTableBuilder::BlockBasedTableBuilder(
@@ -178,6 +178,15 @@ std::string BlockBasedTableFactory::GetPrintableTableOptions() const {
   snprintf(buffer, kBufferSize, "  index_block_restart_interval: %d\n",
            table_options_.index_block_restart_interval);
   ret.append(buffer);
+  snprintf(buffer, kBufferSize, "  delta_encode_index_block_handles: %d\n",
+           table_options_.delta_encode_index_block_handles);
+  ret.append(buffer);
+  snprintf(buffer, kBufferSize, "  data_block_index_type: %d\n",
+           yb::to_underlying(table_options_.data_block_index_type));
+  ret.append(buffer);
+  snprintf(buffer, kBufferSize, "  data_block_hash_table_util_ratio: %lf\n",
+           table_options_.data_block_hash_table_util_ratio);
+  ret.append(buffer);
   snprintf(buffer, kBufferSize, "  filter_policy: %s\n",
            table_options_.filter_policy == nullptr ?
              "nullptr" : table_options_.filter_policy->Name());
@@ -202,6 +211,11 @@ std::shared_ptr<TableAwareReadFileFilter> BlockBasedTableFactory::NewTableAwareR
   return std::make_shared<BloomFilterAwareFileFilter>(read_options, user_key);
 }
 
+std::shared_ptr<TableAwareReadFileFilter> BlockBasedTableFactory::NewTableAwareReadFileFilter(
+    const ReadOptions &read_options, const std::vector<Slice> &user_keys) const {
+  return std::make_shared<BloomFilterAwareFileFilter>(read_options, user_keys);
+}
+
 TableFactory* NewBlockBasedTableFactory(
     const BlockBasedTableOptions& _table_options) {
   return new BlockBasedTableFactory(_table_options);
@@ -217,6 +231,10 @@ const char BlockBasedTablePropertyNames::kPrefixFiltering[] =
     "rocksdb.block.based.table.prefix.filtering";
 const char BlockBasedTablePropertyNames::kDataBlockKeyValueEncodingFormat[] =
     "rocksdb.block.based.table.data.block.key.value.encoding.format";
+const char BlockBasedTablePropertyNames::kDataBlockIndexType[] =
+    "rocksdb.block.based.table.data.block.index.type";
+const char BlockBasedTablePropertyNames::kIndexBlockHandlesDeltaEncoded[] =
+    "rocksdb.block.based.table.index.block.handles.delta.encoded";
 const char kHashIndexPrefixesBlock[] = "rocksdb.hashindex.prefixes";
 const char kHashIndexPrefixesMetadataBlock[] =
     "rocksdb.hashindex.metadata";
@@ -14,6 +14,7 @@
 #ifndef YB_ROCKSDB_TABLE_BLOCK_BASED_TABLE_INTERNAL_H
 #define YB_ROCKSDB_TABLE_BLOCK_BASED_TABLE_INTERNAL_H
 
+#include "yb/rocksdb/table.h"
 #include "yb/rocksdb/table/block.h"
 #include "yb/rocksdb/table/format.h"
 
@@ -83,6 +84,14 @@ inline void GenerateCachePrefix(
   }
 }
 
+// Returns key transformer to be used for data block hash index or nullptr if data block hash index
+// is not enabled by table options.
+inline const FilterPolicy::KeyTransformer* GetDataBlockHashIndexKeyTransformer(
+    const BlockBasedTableOptions& table_options) {
+  return table_options.data_block_index_type == DataBlockIndexType::kBinarySearchAndHash
+      ? table_options.data_block_hash_index_key_transformer : nullptr;
+}
+
 } // namespace block_based_table
 
 } // namespace rocksdb
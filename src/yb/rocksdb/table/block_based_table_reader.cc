@@ -23,8 +23,10 @@
 
 #include "yb/rocksdb/table/block_based_table_reader.h"
 
+#include <deque>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "yb/gutil/macros.h"
 
@@ -234,6 +236,10 @@ struct BlockBasedTable::Rep {
   bool prefix_filtering = false;
   KeyValueEncodingFormat data_block_key_value_encoding_format =
       KeyValueEncodingFormat::kKeyDeltaEncodingSharedPrefix;
+  // Set if data blocks of this table have data block hash index and table options allow to use it.
+  const FilterPolicy::KeyTransformer* data_block_hash_index_key_transformer = nullptr;
+  // Whether block handles in data index blocks are encoded by EncodeIndexBlockHandle.
+  bool index_block_handles_delta_encoded = false;
   // TODO(kailiu) It is very ugly to use internal key in table, since table
   // module should not be relying on db module. However to make things easier
   // and compatible with existing code, we introduce a wrapper that allows
@@ -244,6 +250,101 @@ struct BlockBasedTable::Rep {
   yb::MemTrackerPtr mem_tracker;
 };
 
+// Reads data blocks following the requested one in a single batch, so sequential scan of the table
+// that bypasses block cache (i.e. compaction) issues fewer and larger reads.
+// Uses its own index iterator to find handles of the following blocks.
+class BlockBasedTable::DataBlockReadahead {
+ public:
+  DataBlockReadahead(BlockBasedTable* table, const ReadOptions& read_options)
+      : table_(table),
+        read_options_(read_options),
+        index_iter_(table->NewIndexIterator(read_options)) {}
+
+  // Returns block identified by handle, reading it together with following blocks if it was not
+  // read ahead yet.
+  Status Take(const BlockHandle& handle, std::unique_ptr<Block>* result) {
+    while (!blocks_.empty() && blocks_.front().first < handle.offset()) {
+      blocks_.pop_front();
+    }
+    if (blocks_.empty() || blocks_.front().first != handle.offset()) {
+      blocks_.clear();
+      RETURN_NOT_OK(ReadAhead(handle));
+    }
+    if (blocks_.empty()) {
+      // Block is not in the index sequence, could happen only for non sequential access.
+      return block_based_table::ReadBlockFromFile(
+          table_->GetBlockReader(BlockType::kData)->reader.get(), table_->rep_->footer,
+          read_options_, handle, result, table_->rep_->ioptions.env, table_->rep_->mem_tracker);
+    }
+    *result = std::move(blocks_.front().second);
+    blocks_.pop_front();
+    return Status::OK();
+  }
+
+ private:
+  Status ReadAhead(const BlockHandle& handle) {
+    auto positioned = PositionIndexIterator(handle);
+    if (!positioned.ok() || !*positioned) {
+      return positioned.status();
+    }
+    std::vector<BlockHandle> handles;
+    handles.reserve(read_options_.readahead_blocks);
+    while (handles.size() < read_options_.readahead_blocks && index_iter_->Valid()) {
+      handles.emplace_back();
+      Slice input = index_iter_->value();
+      RETURN_NOT_OK(handles.back().DecodeFrom(&input));
+      index_iter_->Next();
+    }
+    RETURN_NOT_OK(index_iter_->status());
+
+    auto* rep = table_->rep_;
+    std::vector<BlockContents> contents(handles.size());
+    {
+      StopWatch sw(rep->ioptions.env, rep->ioptions.statistics, READ_BLOCK_GET_MICROS);
+      RETURN_NOT_OK(ReadBlockContentsBatch(
+          table_->GetBlockReader(BlockType::kData)->reader.get(), rep->footer, read_options_,
+          handles.data(), handles.size(), contents.data(), rep->ioptions.env, rep->mem_tracker,
+          /* do_uncompress = */ true));
+    }
+    RecordTick(rep->ioptions.statistics, NUMBER_BLOCKS_READ_BY_BATCH, handles.size());
+    for (size_t i = 0; i != handles.size(); ++i) {
+      blocks_.emplace_back(handles[i].offset(), std::make_unique<Block>(std::move(contents[i])));
+    }
+    return Status::OK();
+  }
+
+  // Positions index iterator to the entry for specified handle. Returns false if there is no such
+  // entry.
+  yb::Result<bool> PositionIndexIterator(const BlockHandle& handle) {
+    if (IndexIteratorAt(handle)) {
+      return true;
+    }
+    // Iterator is out of sync, that is not expected for sequential scan, so just use linear search.
+    for (index_iter_->SeekToFirst(); index_iter_->Valid(); index_iter_->Next()) {
+      if (IndexIteratorAt(handle)) {
+        return true;
+      }
+    }
+    RETURN_NOT_OK(index_iter_->status());
+    return false;
+  }
+
+  bool IndexIteratorAt(const BlockHandle& handle) {
+    if (!index_iter_->Valid()) {
+      return false;
+    }
+    BlockHandle current;
+    Slice input = index_iter_->value();
+    return current.DecodeFrom(&input).ok() && current.offset() == handle.offset();
+  }
+
+  BlockBasedTable* const table_;
+  const ReadOptions read_options_;
+  std::unique_ptr<InternalIterator> index_iter_;
+  // Blocks that were read ahead, ordered by offset.
+  std::deque<std::pair<uint64_t, std::unique_ptr<Block>>> blocks_;
+};
+
 // BlockEntryIteratorState doesn't actually store any iterator state and is only used as an adapter
 // to BlockBasedTable. It is used by TwoLevelIterator and MultiLevelIterator to call BlockBasedTable
 // functions in order to check if prefix may match or to create a secondary iterator.
@@ -256,10 +357,15 @@ class BlockBasedTable::BlockEntryIteratorState : public TwoLevelIteratorState {
         table_(table),
         read_options_(read_options),
         skip_filters_(skip_filters),
-        block_type_(block_type) {}
+        block_type_(block_type) {
+    if (block_type_ == BlockType::kData && read_options_.readahead_blocks > 1) {
+      readahead_ = std::make_unique<DataBlockReadahead>(table_, read_options_);
+    }
+  }
 
   InternalIterator* NewSecondaryIterator(const Slice& index_value) override {
-    return table_->NewDataBlockIterator(read_options_, index_value, block_type_);
+    return table_->NewDataBlockIterator(
+        read_options_, index_value, block_type_, /* input_iter = */ nullptr, readahead_.get());
   }
 
   bool PrefixMayMatch(const Slice& internal_key) override {
@@ -277,6 +383,7 @@ class BlockBasedTable::BlockEntryIteratorState : public TwoLevelIteratorState {
   const ReadOptions read_options_;
   const bool skip_filters_;
   const BlockType block_type_;
+  std::unique_ptr<DataBlockReadahead> readahead_;
 };
 
 
@@ -336,26 +443,38 @@ BlockBasedTable::FileReaderWithCachePrefix* BlockBasedTable::GetBlockReader(Bloc
 
 BloomFilterAwareFileFilter::BloomFilterAwareFileFilter(
     const ReadOptions& read_options, const Slice& user_key)
-    : read_options_(read_options), user_key_(user_key.ToBuffer()) {}
+    : read_options_(read_options), user_keys_{user_key.ToBuffer()} {}
+
+BloomFilterAwareFileFilter::BloomFilterAwareFileFilter(
+    const ReadOptions& read_options, const std::vector<Slice>& user_keys)
+    : read_options_(read_options) {
+  user_keys_.reserve(user_keys.size());
+  for (const auto& user_key : user_keys) {
+    user_keys_.push_back(user_key.ToBuffer());
+  }
+}
 
 bool BloomFilterAwareFileFilter::Filter(TableReader* reader) const {
   auto table = down_cast<BlockBasedTable*>(reader);
   if (table->rep_->filter_type == FilterType::kFixedSizeFilter) {
-    const auto filter_key = table->GetFilterKeyFromUserKey(user_key_);
-    if (filter_key.empty()) {
-      return true;
+    for (const auto& user_key : user_keys_) {
+      const auto filter_key = table->GetFilterKeyFromUserKey(user_key);
+      if (filter_key.empty()) {
+        return true;
+      }
+      auto filter_entry = table->GetFilter(read_options_.query_id,
+          read_options_.read_tier == kBlockCacheTier /* no_io */, &filter_key);
+      FilterBlockReader* filter = filter_entry.value;
+      // If bloom filter was not useful for any of the keys, then take this file into account.
+      const bool use_file = table->NonBlockBasedFilterKeyMayMatch(filter, filter_key);
+      filter_entry.Release(table->rep_->table_options.block_cache.get());
+      if (use_file) {
+        return true;
+      }
     }
-    auto filter_entry = table->GetFilter(read_options_.query_id,
-        read_options_.read_tier == kBlockCacheTier /* no_io */, &filter_key);
-    FilterBlockReader* filter = filter_entry.value;
-    // If bloom filter was not useful, then take this file into account.
-    const bool use_file = table->NonBlockBasedFilterKeyMayMatch(filter, filter_key);
-    if (!use_file) {
-      // Record that the bloom filter was useful.
-      RecordTick(table->rep_->ioptions.statistics, BLOOM_FILTER_USEFUL);
-    }
-    filter_entry.Release(table->rep_->table_options.block_cache.get());
-    return use_file;
+    // Record that the bloom filter was useful.
+    RecordTick(table->rep_->ioptions.statistics, BLOOM_FILTER_USEFUL);
+    return false;
   } else {
     // For non fixed-size filters - take file into account. We are only using fixed-size bloom
     // filters for DocDB, so not need to support others.
@@ -567,6 +686,15 @@ Status BlockBasedTable::ReadPropertiesBlock(InternalIterator* meta_iter) {
       rep_->data_block_key_value_encoding_format =
           static_cast<KeyValueEncodingFormat>(DecodeFixed8(it->second.c_str()));
     }
+    it = props.find(BlockBasedTablePropertyNames::kDataBlockIndexType);
+    if (it != props.end() &&
+        static_cast<DataBlockIndexType>(DecodeFixed8(it->second.c_str())) ==
+            DataBlockIndexType::kBinarySearchAndHash) {
+      rep_->data_block_hash_index_key_transformer =
+          rep_->table_options.data_block_hash_index_key_transformer;
+    }
+    it = props.find(BlockBasedTablePropertyNames::kIndexBlockHandlesDeltaEncoded);
+    rep_->index_block_handles_delta_encoded = it != props.end() && it->second == kPropTrue;
   }
 
   return Status::OK();
@@ -1166,7 +1294,8 @@ InternalIterator* BlockBasedTable::NewIndexIterator(
 // If input_iter is null, new a iterator
 // If input_iter is not null, update this iter and return it
 InternalIterator* BlockBasedTable::NewDataBlockIterator(const ReadOptions& ro,
-    const Slice& index_value, BlockType block_type, BlockIter* input_iter) {
+    const Slice& index_value, BlockType block_type, BlockIter* input_iter,
+    DataBlockReadahead* readahead) {
   PERF_TIMER_GUARD(new_table_block_iter_nanos);
 
   const bool no_io = (ro.read_tier == kBlockCacheTier);
@@ -1242,9 +1371,13 @@ InternalIterator* BlockBasedTable::NewDataBlockIterator(const ReadOptions& ro,
       }
     }
     std::unique_ptr<Block> block_value;
-    s = block_based_table::ReadBlockFromFile(
-        reader->reader.get(), rep_->footer, ro, handle, &block_value, rep_->ioptions.env,
-        rep_->mem_tracker);
+    if (readahead) {
+      s = readahead->Take(handle, &block_value);
+    } else {
+      s = block_based_table::ReadBlockFromFile(
+          reader->reader.get(), rep_->footer, ro, handle, &block_value, rep_->ioptions.env,
+          rep_->mem_tracker);
+    }
     if (s.ok()) {
       block.value = block_value.release();
     }
@@ -1253,7 +1386,10 @@ InternalIterator* BlockBasedTable::NewDataBlockIterator(const ReadOptions& ro,
   InternalIterator* iter;
   if (s.ok() && block.value != nullptr) {
     iter = block.value->NewIterator(
-        rep_->comparator.get(), GetKeyValueEncodingFormat(block_type), input_iter);
+        rep_->comparator.get(), GetKeyValueEncodingFormat(block_type), input_iter,
+        /* total_order_seek = */ true,
+        block_type == BlockType::kData ? rep_->data_block_hash_index_key_transformer : nullptr,
+        block_type == BlockType::kIndex && rep_->index_block_handles_delta_encoded);
     if (block.cache_handle != nullptr) {
       iter->RegisterCleanup(&ReleaseCachedEntry, block_cache,
           block.cache_handle);
@@ -1600,7 +1736,8 @@ Status BlockBasedTable::CreateDataBlockIndexReader(
   switch (index_type_on_file) {
     case IndexType::kBinarySearch: {
       return BinarySearchIndexReader::Create(
-          file, footer, footer.index_handle(), env, comparator, index_reader, rep_->mem_tracker);
+          file, footer, footer.index_handle(), env, comparator, index_reader, rep_->mem_tracker,
+          rep_->index_block_handles_delta_encoded);
     }
     case IndexType::kHashSearch: {
       std::unique_ptr<Block> meta_guard;
@@ -1639,7 +1776,8 @@ Status BlockBasedTable::CreateDataBlockIndexReader(
       }
       int num_levels = DecodeFixed32(pos->second.c_str());
       auto result = MultiLevelIndexReader::Create(
-          file, footer, num_levels, footer.index_handle(), env, comparator, rep_->mem_tracker);
+          file, footer, num_levels, footer.index_handle(), env, comparator, rep_->mem_tracker,
+          rep_->index_block_handles_delta_encoded);
       RETURN_NOT_OK(result);
       *index_reader = std::move(*result);
       return Status::OK();
@@ -1935,4 +2073,14 @@ yb::Result<std::string> BlockBasedTable::GetMiddleKey() {
   return iter->key().ToBuffer();
 }
 
+Status BlockBasedTable::IterateDataBlockKeys(
+    const std::function<void(const Slice&)>& callback) {
+  // Only the index is read, data blocks are not loaded.
+  std::unique_ptr<InternalIterator> iter(NewIndexIterator(ReadOptions::kDefault));
+  for (iter->SeekToFirst(); iter->Valid(); iter->Next()) {
+    callback(iter->key());
+  }
+  return iter->status();
+}
+
 }  // namespace rocksdb
@@ -29,6 +29,7 @@
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "yb/rocksdb/immutable_options.h"
 #include "yb/rocksdb/options.h"
@@ -84,16 +85,18 @@ YB_DEFINE_ENUM(BlockType, (kData)(kIndex));
 // the key and it should be used together with DocDbAwareFilterPolicy which only takes into account
 // hashed components of key for filtering.
 // BloomFilterAwareFileFilter ignores an SST file completely if there are no keys with the same
-// hashed components as the key specified in constructor.
+// hashed components as any of the keys specified in constructor.
 class BloomFilterAwareFileFilter : public TableAwareReadFileFilter {
  public:
   BloomFilterAwareFileFilter(const ReadOptions& read_options, const Slice& user_key);
 
+  BloomFilterAwareFileFilter(const ReadOptions& read_options, const std::vector<Slice>& user_keys);
+
   bool Filter(TableReader* reader) const override;
 
  private:
   const ReadOptions read_options_;
-  const std::string user_key_;
+  std::vector<std::string> user_keys_;
 };
 
 // A Table is a sorted map from strings to strings.  Tables are
@@ -179,15 +182,20 @@ class BlockBasedTable : public TableReader {
   // convert SST file to a human readable form
   CHECKED_STATUS DumpTable(WritableFile* out_file) override;
 
+  class DataBlockReadahead;
+
   // input_iter: if it is not null, update this one and return it as Iterator
+  // readahead: if it is not null, blocks missing in block cache are read through it.
   InternalIterator* NewDataBlockIterator(
       const ReadOptions& ro, const Slice& index_value, BlockType block_type,
-      BlockIter* input_iter = nullptr);
+      BlockIter* input_iter = nullptr, DataBlockReadahead* readahead = nullptr);
 
   const ImmutableCFOptions& ioptions();
 
   yb::Result<std::string> GetMiddleKey() override;
 
+  Status IterateDataBlockKeys(const std::function<void(const Slice&)>& callback) override;
+
   ~BlockBasedTable();
 
   bool TEST_filter_block_preloaded() const;
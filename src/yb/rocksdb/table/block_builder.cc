@@ -42,8 +42,10 @@
 //
 // The trailer of the block has the form:
 //     restarts: uint32[num_restarts]
+//     [data block hash map]
 //     num_restarts: uint32
 // restarts[i] contains the offset within the block of the ith restart point.
+// Data block hash map is optional, see data_block_hash_index.h for its format.
 
 #include "yb/rocksdb/table/block_builder.h"
 
@@ -62,15 +64,19 @@ namespace rocksdb {
 
 BlockBuilder::BlockBuilder(
     int block_restart_interval, const KeyValueEncodingFormat key_value_encoding_format,
-    const bool use_delta_encoding)
+    const bool use_delta_encoding,
+    const FilterPolicy::KeyTransformer* hash_index_key_transformer,
+    const double hash_table_util_ratio)
     : block_restart_interval_(block_restart_interval),
       use_delta_encoding_(use_delta_encoding),
       key_value_encoding_format_(key_value_encoding_format),
       restarts_(),
       counter_(0),
-      finished_(false) {
+      finished_(false),
+      hash_index_key_transformer_(hash_index_key_transformer) {
   assert(block_restart_interval_ >= 1);
   restarts_.push_back(0);       // First restart point is at offset 0
+  hash_index_builder_.Initialize(hash_index_key_transformer_ ? hash_table_util_ratio : 0);
 }
 
 void BlockBuilder::Reset() {
@@ -80,6 +86,7 @@ void BlockBuilder::Reset() {
   counter_ = 0;
   finished_ = false;
   last_key_.clear();
+  hash_index_builder_.Reset();
 }
 
 size_t BlockBuilder::CurrentSizeEstimate() const {
@@ -87,6 +94,7 @@ size_t BlockBuilder::CurrentSizeEstimate() const {
   if (!finished_) {
     // Restarts haven't been flushed to buffer yet.
     size += restarts_.size() * sizeof(uint32_t) +    // Restart array.
+            hash_index_builder_.EstimateSize() +     // Data block hash map.
             sizeof(uint32_t);                        // Restart array length.
   }
   return size;
@@ -335,11 +343,30 @@ Slice BlockBuilder::Finish() {
   for (size_t i = 0; i < restarts_.size(); i++) {
     PutFixed32(&buffer_, restarts_[i]);
   }
-  PutFixed32(&buffer_, static_cast<uint32_t>(restarts_.size()));
+  auto index_type = DataBlockIndexType::kBinarySearch;
+  if (hash_index_builder_.Valid()) {
+    hash_index_builder_.Finish(&buffer_);
+    index_type = DataBlockIndexType::kBinarySearchAndHash;
+  }
+  PutFixed32(&buffer_, PackDataBlockFooter(index_type, static_cast<uint32_t>(restarts_.size())));
   finished_ = true;
   return Slice(buffer_);
 }
 
+// Only the first entry with the specific hash index key is added to the hash index, so lookup
+// points to the restart interval where entries with this hash index key start.
+void BlockBuilder::AddToHashIndex(const Slice& prev_key, const Slice& key) {
+  DCHECK_GE(key.size(), kLastInternalComponentSize);
+  const auto hash_index_key = hash_index_key_transformer_->Transform(ExtractUserKey(key));
+  if (hash_index_key.empty()) {
+    return;
+  }
+  if (!buffer_.empty() && prev_key.starts_with(hash_index_key)) {
+    return;
+  }
+  hash_index_builder_.Add(DataBlockHashIndexHash(hash_index_key), restarts_.size() - 1);
+}
+
 void BlockBuilder::Add(const Slice& key, const Slice& value) {
   const Slice prev_key_piece(last_key_);
   assert(!finished_);
@@ -374,6 +401,10 @@ void BlockBuilder::Add(const Slice& key, const Slice& value) {
     }
   }
 
+  if (hash_index_builder_.Valid()) {
+    AddToHashIndex(prev_key_piece, key);
+  }
+
   DVLOG_WITH_FUNC(4) << "key: " << Slice(key).ToDebugHexString() << " size: " << key.size()
                     << " offset: " << buffer_.size() << " counter: " << counter_;
 
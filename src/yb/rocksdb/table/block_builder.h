@@ -27,7 +27,9 @@
 #include <stdint.h>
 #include <vector>
 
+#include "yb/rocksdb/filter_policy.h"
 #include "yb/rocksdb/types.h"
+#include "yb/rocksdb/table/data_block_hash_index.h"
 
 #include "yb/util/slice.h"
 
@@ -38,9 +40,14 @@ class BlockBuilder {
   BlockBuilder(const BlockBuilder&) = delete;
   void operator=(const BlockBuilder&) = delete;
 
+  // If hash_index_key_transformer is not null, block is built with data block hash index over
+  // hash index keys extracted from user keys (see DataBlockHashIndex). Keys are expected to be
+  // internal keys in this case.
   explicit BlockBuilder(int block_restart_interval,
                         KeyValueEncodingFormat key_value_encoding_format,
-                        bool use_delta_encoding = true);
+                        bool use_delta_encoding = true,
+                        const FilterPolicy::KeyTransformer* hash_index_key_transformer = nullptr,
+                        double hash_table_util_ratio = 0.75);
 
   // Reset the contents as if the BlockBuilder was just constructed.
   void Reset();
@@ -68,6 +75,11 @@ class BlockBuilder {
     return buffer_.empty();
   }
 
+  // Returns true iff the next added entry will start a new restart interval.
+  bool IsNextEntryRestart() const {
+    return buffer_.empty() || counter_ >= block_restart_interval_;
+  }
+
  private:
   const int block_restart_interval_;
   const bool use_delta_encoding_;
@@ -78,6 +90,11 @@ class BlockBuilder {
   int                   counter_;   // Number of entries emitted since restart
   bool                  finished_;  // Has Finish() been called?
   std::string           last_key_;
+
+  const FilterPolicy::KeyTransformer* const hash_index_key_transformer_;
+  DataBlockHashIndexBuilder hash_index_builder_;
+
+  void AddToHashIndex(const Slice& prev_key, const Slice& key);
 };
 
 }  // namespace rocksdb
@@ -0,0 +1,108 @@
+//
+// Copyright (c) YugaByte, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+// in compliance with the License.  You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied.  See the License for the specific language governing permissions and limitations
+// under the License.
+//
+//
+
+#include "yb/rocksdb/table/data_block_hash_index.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "yb/rocksdb/util/coding.h"
+#include "yb/rocksdb/util/hash.h"
+
+namespace rocksdb {
+
+namespace {
+
+// Upper bound for number of buckets, so the hash map is never larger than a typical data block.
+constexpr size_t kMaxNumBuckets = std::numeric_limits<uint16_t>::max();
+
+} // namespace
+
+uint32_t DataBlockHashIndexHash(const Slice& hash_index_key) {
+  return GetSliceHash(hash_index_key);
+}
+
+void DataBlockHashIndexBuilder::Initialize(double util_ratio) {
+  enabled_ = util_ratio > 0;
+  buckets_per_key_ = enabled_ ? 1 / util_ratio : 0;
+  Reset();
+}
+
+void DataBlockHashIndexBuilder::Add(uint32_t key_hash, size_t restart_index) {
+  if (!valid_) {
+    return;
+  }
+  if (restart_index > kDataBlockHashIndexMaxRestartSupported) {
+    // Too many restart intervals in this block to address them with one byte bucket, the block
+    // will be written without hash map.
+    valid_ = false;
+    hash_and_restart_pairs_.clear();
+    return;
+  }
+  hash_and_restart_pairs_.emplace_back(key_hash, static_cast<uint8_t>(restart_index));
+  estimated_num_buckets_ += buckets_per_key_;
+}
+
+size_t DataBlockHashIndexBuilder::NumBuckets() const {
+  // Odd number of buckets gives better distribution for modulo hashing.
+  return std::min(static_cast<size_t>(estimated_num_buckets_), kMaxNumBuckets - 1) | 1;
+}
+
+void DataBlockHashIndexBuilder::Finish(std::string* buffer) {
+  DCHECK(valid_);
+  const auto num_buckets = NumBuckets();
+  std::vector<uint8_t> buckets(num_buckets, kDataBlockHashIndexNoEntry);
+  for (const auto& entry : hash_and_restart_pairs_) {
+    auto& bucket = buckets[entry.first % num_buckets];
+    if (bucket == kDataBlockHashIndexNoEntry) {
+      bucket = entry.second;
+    } else if (bucket != entry.second) {
+      bucket = kDataBlockHashIndexCollision;
+    }
+  }
+  buffer->append(reinterpret_cast<const char*>(buckets.data()), buckets.size());
+  PutFixed32(buffer, static_cast<uint32_t>(num_buckets));
+}
+
+size_t DataBlockHashIndexBuilder::EstimateSize() const {
+  return valid_ ? NumBuckets() + sizeof(uint32_t) : 0;
+}
+
+void DataBlockHashIndexBuilder::Reset() {
+  valid_ = enabled_;
+  estimated_num_buckets_ = 0;
+  hash_and_restart_pairs_.clear();
+}
+
+bool DataBlockHashIndex::Initialize(const char* data, uint32_t end_offset, uint32_t* map_offset) {
+  if (end_offset < sizeof(uint32_t)) {
+    return false;
+  }
+  const auto num_buckets = DecodeFixed32(data + end_offset - sizeof(uint32_t));
+  if (num_buckets == 0 || num_buckets > end_offset - sizeof(uint32_t)) {
+    return false;
+  }
+  *map_offset = end_offset - sizeof(uint32_t) - num_buckets;
+  buckets_ = reinterpret_cast<const uint8_t*>(data + *map_offset);
+  num_buckets_ = num_buckets;
+  return true;
+}
+
+uint8_t DataBlockHashIndex::Lookup(const Slice& hash_index_key) const {
+  DCHECK(Valid());
+  return buckets_[DataBlockHashIndexHash(hash_index_key) % num_buckets_];
+}
+
+}  // namespace rocksdb
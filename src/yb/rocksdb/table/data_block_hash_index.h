@@ -0,0 +1,122 @@
+//
+// Copyright (c) YugaByte, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+// in compliance with the License.  You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied.  See the License for the specific language governing permissions and limitations
+// under the License.
+//
+//
+
+#ifndef YB_ROCKSDB_TABLE_DATA_BLOCK_HASH_INDEX_H
+#define YB_ROCKSDB_TABLE_DATA_BLOCK_HASH_INDEX_H
+
+#include <stdint.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "yb/rocksdb/table.h"
+
+#include "yb/util/logging.h"
+#include "yb/util/slice.h"
+
+namespace rocksdb {
+
+// Data block hash index maps hash of the hash index key of a data block entry (see
+// BlockBasedTableOptions::data_block_hash_index_key_transformer) to the restart interval containing
+// the first entry with this hash index key. For DocDB this allows a point seek to jump directly to
+// the restart interval holding the required DocKey instead of doing binary search over restart
+// points.
+//
+// When present, hash map is stored after restart array of the data block (see block_builder.cc
+// for the rest of the block format):
+//     buckets: uint8[num_buckets]
+//     num_buckets: uint32
+//     num_restarts: uint32 with kDataBlockHashIndexFooterFlag set
+//
+// Each bucket contains either restart interval index, kDataBlockHashIndexNoEntry or
+// kDataBlockHashIndexCollision (several different restart intervals are hashed into this bucket).
+// Since bucket is one byte - hash index is not built for blocks with more than
+// kDataBlockHashIndexMaxRestartSupported restart intervals.
+
+constexpr uint8_t kDataBlockHashIndexNoEntry = 255;
+constexpr uint8_t kDataBlockHashIndexCollision = 254;
+constexpr uint8_t kDataBlockHashIndexMaxRestartSupported = 253;
+
+// Most significant bit of num_restarts in block footer is used to mark presence of the hash map.
+constexpr uint32_t kDataBlockHashIndexFooterFlag = 1u << 31;
+
+inline uint32_t PackDataBlockFooter(DataBlockIndexType index_type, uint32_t num_restarts) {
+  DCHECK_EQ(num_restarts & kDataBlockHashIndexFooterFlag, 0);
+  return index_type == DataBlockIndexType::kBinarySearchAndHash
+      ? num_restarts | kDataBlockHashIndexFooterFlag : num_restarts;
+}
+
+inline void UnpackDataBlockFooter(
+    uint32_t footer, DataBlockIndexType* index_type, uint32_t* num_restarts) {
+  *index_type = (footer & kDataBlockHashIndexFooterFlag) ? DataBlockIndexType::kBinarySearchAndHash
+                                                         : DataBlockIndexType::kBinarySearch;
+  *num_restarts = footer & ~kDataBlockHashIndexFooterFlag;
+}
+
+class DataBlockHashIndexBuilder {
+ public:
+  // util_ratio is the desired ratio of the number of distinct hash index keys to the number of
+  // buckets. Non-positive util_ratio disables the builder.
+  void Initialize(double util_ratio);
+
+  // Returns whether hash map could be built for the keys added since the last Reset().
+  bool Valid() const { return valid_; }
+
+  void Add(uint32_t key_hash, size_t restart_index);
+
+  // Appends hash map to the buffer. REQUIRES: Valid().
+  void Finish(std::string* buffer);
+
+  // Returns estimated size of the hash map in case Finish() is invoked now.
+  size_t EstimateSize() const;
+
+  void Reset();
+
+ private:
+  size_t NumBuckets() const;
+
+  double buckets_per_key_ = 0;
+  double estimated_num_buckets_ = 0;
+  bool enabled_ = false;
+  bool valid_ = false;
+  std::vector<std::pair<uint32_t, uint8_t>> hash_and_restart_pairs_;
+};
+
+// Provides lookups over hash map stored inside the data block. Doesn't own the data.
+class DataBlockHashIndex {
+ public:
+  // Parses hash map which ends at data + end_offset. On success sets *map_offset to the offset of
+  // the hash map start inside the data block and returns true.
+  bool Initialize(const char* data, uint32_t end_offset, uint32_t* map_offset);
+
+  bool Valid() const { return buckets_ != nullptr; }
+
+  // Returns restart interval index for the hash index key or one of kDataBlockHashIndexNoEntry /
+  // kDataBlockHashIndexCollision.
+  uint8_t Lookup(const Slice& hash_index_key) const;
+
+  size_t ApproximateMemoryUsage() const { return sizeof(*this); }
+
+ private:
+  const uint8_t* buckets_ = nullptr;
+  uint32_t num_buckets_ = 0;
+};
+
+uint32_t DataBlockHashIndexHash(const Slice& hash_index_key);
+
+}  // namespace rocksdb
+
+#endif // YB_ROCKSDB_TABLE_DATA_BLOCK_HASH_INDEX_H
@@ -0,0 +1,187 @@
+//
+// Copyright (c) YugaByte, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+// in compliance with the License.  You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied.  See the License for the specific language governing permissions and limitations
+// under the License.
+//
+//
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "yb/rocksdb/db/dbformat.h"
+#include "yb/rocksdb/table/block.h"
+#include "yb/rocksdb/table/block_builder.h"
+#include "yb/rocksdb/table/data_block_hash_index.h"
+#include "yb/rocksdb/util/testutil.h"
+
+#include "yb/util/random_util.h"
+#include "yb/util/test_macros.h"
+
+namespace rocksdb {
+
+namespace {
+
+constexpr size_t kHashIndexKeySize = 8;
+
+// Uses fixed size prefix of the user key as hash index key, fixed size prefixes are never prefixes
+// of each other.
+class FixedPrefixTransformer : public FilterPolicy::KeyTransformer {
+ public:
+  Slice Transform(Slice key) const override {
+    return key.size() >= kHashIndexKeySize ? Slice(key.data(), kHashIndexKeySize) : Slice();
+  }
+};
+
+std::string MakeUserKey(int prefix, int suffix) {
+  char buf[32];
+  snprintf(buf, sizeof(buf), "%08d%04d", prefix, suffix);
+  return buf;
+}
+
+std::string MakeInternalKey(const std::string& user_key, SequenceNumber seq = 1000) {
+  return InternalKey(user_key, seq, kTypeValue).Encode().ToString();
+}
+
+} // namespace
+
+class DataBlockHashIndexTest : public RocksDBTest {
+ protected:
+  void BuildBlocks(
+      const std::vector<std::string>& keys, int restart_interval, std::string* hashed_block,
+      std::string* plain_block) {
+    BlockBuilder hashed_builder(
+        restart_interval, KeyValueEncodingFormat::kKeyDeltaEncodingSharedPrefix,
+        /* use_delta_encoding = */ true, &transformer_);
+    BlockBuilder plain_builder(
+        restart_interval, KeyValueEncodingFormat::kKeyDeltaEncodingSharedPrefix);
+    for (const auto& key : keys) {
+      hashed_builder.Add(key, key);
+      plain_builder.Add(key, key);
+    }
+    *hashed_block = hashed_builder.Finish().ToBuffer();
+    *plain_block = plain_builder.Finish().ToBuffer();
+  }
+
+  std::unique_ptr<Block> MakeBlock(const std::string& raw_block) {
+    BlockContents contents;
+    contents.data = raw_block;
+    contents.cachable = false;
+    return std::make_unique<Block>(std::move(contents));
+  }
+
+  void CheckSeeks(
+      Block* hashed_block, Block* plain_block, const std::vector<std::string>& targets) {
+    std::unique_ptr<InternalIterator> hashed_iter(hashed_block->NewIterator(
+        &comparator_, KeyValueEncodingFormat::kKeyDeltaEncodingSharedPrefix, nullptr,
+        /* total_order_seek = */ true, &transformer_));
+    std::unique_ptr<InternalIterator> plain_iter(plain_block->NewIterator(
+        &comparator_, KeyValueEncodingFormat::kKeyDeltaEncodingSharedPrefix));
+    for (const auto& target : targets) {
+      hashed_iter->Seek(target);
+      plain_iter->Seek(target);
+      ASSERT_OK(hashed_iter->status());
+      ASSERT_EQ(plain_iter->Valid(), hashed_iter->Valid()) << Slice(target).ToDebugHexString();
+      if (plain_iter->Valid()) {
+        ASSERT_EQ(plain_iter->key().ToBuffer(), hashed_iter->key().ToBuffer())
+            << Slice(target).ToDebugHexString();
+        ASSERT_EQ(plain_iter->value().ToBuffer(), hashed_iter->value().ToBuffer());
+      }
+    }
+  }
+
+  FixedPrefixTransformer transformer_;
+  InternalKeyComparator comparator_{BytewiseComparator()};
+};
+
+TEST_F(DataBlockHashIndexTest, Seek) {
+  constexpr int kNumPrefixes = 200;
+  constexpr int kMaxKeysPerPrefix = 5;
+
+  std::vector<std::string> keys;
+  std::vector<std::string> targets;
+  for (int prefix = 0; prefix < kNumPrefixes; ++prefix) {
+    // Leave gaps, so we also seek for prefixes not present in the block.
+    if (prefix % 3 == 0) {
+      targets.push_back(MakeInternalKey(MakeUserKey(prefix, 0), kMaxSequenceNumber));
+      continue;
+    }
+    const auto num_keys = yb::RandomUniformInt(1, kMaxKeysPerPrefix);
+    for (int suffix = 1; suffix <= num_keys; ++suffix) {
+      keys.push_back(MakeInternalKey(MakeUserKey(prefix, suffix * 2)));
+      for (int delta = -1; delta <= 1; ++delta) {
+        targets.push_back(
+            MakeInternalKey(MakeUserKey(prefix, suffix * 2 + delta), kMaxSequenceNumber));
+      }
+    }
+    targets.push_back(MakeInternalKey(MakeUserKey(prefix, 0), kMaxSequenceNumber));
+    targets.push_back(MakeInternalKey(MakeUserKey(prefix, 9999), kMaxSequenceNumber));
+  }
+  // Keys which are not indexed.
+  targets.push_back(MakeInternalKey("0", kMaxSequenceNumber));
+  targets.push_back(MakeInternalKey("9", kMaxSequenceNumber));
+
+  for (int restart_interval : {1, 4, 16}) {
+    std::string hashed_raw_block, plain_raw_block;
+    BuildBlocks(keys, restart_interval, &hashed_raw_block, &plain_raw_block);
+    auto hashed_block = MakeBlock(hashed_raw_block);
+    auto plain_block = MakeBlock(plain_raw_block);
+    ASSERT_EQ(plain_block->NumRestarts(), hashed_block->NumRestarts());
+
+    DataBlockIndexType index_type;
+    uint32_t num_restarts;
+    UnpackDataBlockFooter(
+        DecodeFixed32(hashed_raw_block.data() + hashed_raw_block.size() - sizeof(uint32_t)),
+        &index_type, &num_restarts);
+    ASSERT_EQ(num_restarts, plain_block->NumRestarts());
+    ASSERT_EQ(
+        index_type,
+        num_restarts <= kDataBlockHashIndexMaxRestartSupported + 1u
+            ? DataBlockIndexType::kBinarySearchAndHash : DataBlockIndexType::kBinarySearch);
+
+    ASSERT_NO_FATALS(CheckSeeks(hashed_block.get(), plain_block.get(), targets));
+
+    // Full scan should not be affected by the hash map stored after restart array.
+    std::unique_ptr<InternalIterator> iter(hashed_block->NewIterator(
+        &comparator_, KeyValueEncodingFormat::kKeyDeltaEncodingSharedPrefix));
+    size_t idx = 0;
+    for (iter->SeekToFirst(); iter->Valid(); iter->Next(), ++idx) {
+      ASSERT_LT(idx, keys.size());
+      ASSERT_EQ(keys[idx], iter->key().ToBuffer());
+    }
+    ASSERT_OK(iter->status());
+    ASSERT_EQ(keys.size(), idx);
+  }
+}
+
+TEST_F(DataBlockHashIndexTest, SameHashIndexKeyAcrossRestarts) {
+  // All entries share the same hash index key, so only the first restart interval is indexed.
+  std::vector<std::string> keys;
+  std::vector<std::string> targets;
+  for (int suffix = 0; suffix < 100; ++suffix) {
+    keys.push_back(MakeInternalKey(MakeUserKey(7, suffix * 2)));
+    targets.push_back(MakeInternalKey(MakeUserKey(7, suffix * 2 + 1), kMaxSequenceNumber));
+  }
+  std::string hashed_raw_block, plain_raw_block;
+  BuildBlocks(keys, /* restart_interval = */ 4, &hashed_raw_block, &plain_raw_block);
+  auto hashed_block = MakeBlock(hashed_raw_block);
+  auto plain_block = MakeBlock(plain_raw_block);
+  ASSERT_NO_FATALS(CheckSeeks(hashed_block.get(), plain_block.get(), targets));
+}
+
+}  // namespace rocksdb
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  google::ParseCommandLineFlags(&argc, &argv, true);
+  return RUN_ALL_TESTS();
+}
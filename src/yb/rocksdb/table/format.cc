@@ -26,6 +26,7 @@
 #include <inttypes.h>
 
 #include <string>
+#include <vector>
 
 #include "yb/rocksdb/env.h"
 #include "yb/rocksdb/util/coding.h"
@@ -35,6 +36,7 @@
 #include "yb/rocksdb/util/perf_context_imp.h"
 #include "yb/rocksdb/util/xxhash.h"
 
+#include "yb/util/cast.h"
 #include "yb/util/debug-util.h"
 #include "yb/util/env.h"
 #include "yb/util/mem_tracker.h"
@@ -103,6 +105,37 @@ std::string BlockHandle::ToDebugString() const {
 
 const BlockHandle BlockHandle::kNullBlockHandle(0, 0);
 
+void EncodeIndexBlockHandle(
+    const BlockHandle& handle, const BlockHandle* prev_handle, std::string* dst) {
+  DCHECK(handle.IsSet());
+  if (prev_handle &&
+      handle.offset() == prev_handle->offset() + prev_handle->size() + kBlockTrailerSize) {
+    PutVarint64(dst, handle.size() << 1 | 1);
+    return;
+  }
+  PutVarint64(dst, handle.size() << 1);
+  PutVarint64(dst, handle.offset());
+}
+
+Status DecodeIndexBlockHandle(Slice* input, BlockHandle* handle) {
+  uint64_t size_and_flag;
+  if (!GetVarint64(input, &size_and_flag)) {
+    return STATUS(Corruption, "bad index block handle");
+  }
+  uint64_t offset;
+  if (size_and_flag & 1) {
+    if (!handle->IsSet()) {
+      return STATUS(Corruption, "delta encoded index block handle at restart point");
+    }
+    offset = handle->offset() + handle->size() + kBlockTrailerSize;
+  } else if (!GetVarint64(input, &offset)) {
+    return STATUS(Corruption, "bad index block handle offset");
+  }
+  handle->set_offset(offset);
+  handle->set_size(size_and_flag >> 1);
+  return Status::OK();
+}
+
 namespace {
 inline bool IsLegacyFooterFormat(uint64_t magic_number) {
   return magic_number == kLegacyBlockBasedTableMagicNumber ||
@@ -352,6 +385,36 @@ Status VerifyBlockChecksum(
   return Status::OK();
 }
 
+struct BlockChecksumValidator : public yb::ReadValidator {
+  BlockChecksumValidator(
+      RandomAccessFileReader* file_, const Footer& footer_, const ReadOptions& options_,
+      const BlockHandle& handle_, size_t expected_read_size_)
+      : file(file_),
+        footer(footer_),
+        options(options_),
+        handle(handle_),
+        expected_read_size(expected_read_size_) {}
+
+  CHECKED_STATUS Validate(const Slice& read_result) const override {
+    if (read_result.size() != expected_read_size) {
+      return STATUS_FORMAT(
+          Corruption, "Truncated block read in file: $0, block handle: $1, expected size: $2",
+          file->file()->filename(), handle.ToDebugString(), expected_read_size);
+    }
+
+    if (options.verify_checksums) {
+      return VerifyBlockChecksum(file, footer, handle, read_result.cdata(), handle.size());
+    }
+    return Status::OK();
+  };
+
+  RandomAccessFileReader* file;
+  const Footer& footer;
+  const ReadOptions& options;
+  const BlockHandle& handle;
+  const size_t expected_read_size;
+};
+
 // Read a block and check its CRC. When this function returns, *contents will contain the result of
 // reading.
 Status ReadBlock(
@@ -362,36 +425,7 @@ Status ReadBlock(
   Status s;
   {
     PERF_TIMER_GUARD(block_read_time);
-    struct BlockChecksumValidator : public yb::ReadValidator {
-      BlockChecksumValidator(
-          RandomAccessFileReader* file_, const Footer& footer_, const ReadOptions& options_,
-          const BlockHandle& handle_, size_t expected_read_size_)
-          : file(file_),
-            footer(footer_),
-            options(options_),
-            handle(handle_),
-            expected_read_size(expected_read_size_) {}
-
-      CHECKED_STATUS Validate(const Slice& read_result) const override {
-        if (read_result.size() != expected_read_size) {
-          return STATUS_FORMAT(
-              Corruption, "Truncated block read in file: $0, block handle: $1, expected size: $2",
-              file->file()->filename(), handle.ToDebugString(), expected_read_size);
-        }
-
-        if (options.verify_checksums) {
-          return VerifyBlockChecksum(file, footer, handle, read_result.cdata(), handle.size());
-        }
-        return Status::OK();
-      };
-
-      RandomAccessFileReader* file;
-      const Footer& footer;
-      const ReadOptions& options;
-      const BlockHandle& handle;
-      const size_t expected_read_size;
-    } validator(file, footer, options, handle, expected_read_size);
-
+    BlockChecksumValidator validator(file, footer, options, handle, expected_read_size);
     s = file->ReadAndValidate(handle.offset(), expected_read_size, contents, buf, validator);
   }
 
@@ -493,6 +527,54 @@ Status ReadBlockContents(RandomAccessFileReader* file, const Footer& footer,
   return status;
 }
 
+Status ReadBlockContentsBatch(RandomAccessFileReader* file, const Footer& footer,
+                              const ReadOptions& options, const BlockHandle* handles,
+                              size_t num_handles, BlockContents* contents, Env* env,
+                              const yb::MemTrackerPtr& mem_tracker, bool decompression_requested) {
+  std::vector<std::unique_ptr<char[]>> bufs(num_handles);
+  std::vector<RandomAccessFile::ReadRequest> requests(num_handles);
+  for (size_t i = 0; i != num_handles; ++i) {
+    const size_t read_size = static_cast<size_t>(handles[i].size()) + kBlockTrailerSize;
+    bufs[i].reset(new char[read_size]);
+    requests[i].offset = handles[i].offset();
+    requests[i].size = read_size;
+    requests[i].scratch = pointer_cast<uint8_t*>(bufs[i].get());
+  }
+  {
+    PERF_TIMER_GUARD(block_read_time);
+    RETURN_NOT_OK(file->MultiRead(requests.data(), num_handles));
+  }
+
+  for (size_t i = 0; i != num_handles; ++i) {
+    const auto& handle = handles[i];
+    const auto& slice = requests[i].result;
+    PERF_COUNTER_ADD(block_read_count, 1);
+    PERF_COUNTER_ADD(block_read_byte, requests[i].size);
+    BlockChecksumValidator validator(file, footer, options, handle, requests[i].size);
+    auto status = validator.Validate(slice);
+    if (!status.ok()) {
+      // Regular read could retry read of corrupted block, see RandomAccessFile::ReadAndValidate.
+      LOG(WARNING) << "Batched read of block failed: " << status << ", reading it again";
+      RETURN_NOT_OK(ReadBlockContents(
+          file, footer, options, handle, &contents[i], env, mem_tracker, decompression_requested));
+      continue;
+    }
+
+    PERF_TIMER_GUARD(block_decompress_time);
+    const size_t n = static_cast<size_t>(handle.size());
+    const auto compression_type = static_cast<rocksdb::CompressionType>(slice.data()[n]);
+    if (decompression_requested && compression_type != kNoCompression) {
+      RETURN_NOT_OK(UncompressBlockContents(
+          slice.cdata(), n, &contents[i], footer.version(), mem_tracker));
+    } else if (slice.cdata() != bufs[i].get()) {
+      contents[i] = BlockContents(Slice(slice.data(), n), false, compression_type);
+    } else {
+      contents[i] = BlockContents(std::move(bufs[i]), n, true, compression_type, mem_tracker);
+    }
+  }
+  return Status::OK();
+}
+
 //
 // The 'data' points to the raw block contents that was read in from file.
 // This method allocates a new heap buffer and the raw block
@@ -100,6 +100,23 @@ class BlockHandle {
   static const BlockHandle kNullBlockHandle;
 };
 
+// Compact encoding of block handles inside index blocks, used when
+// BlockBasedTableOptions::delta_encode_index_block_handles is set:
+//     varint64(size << 1) varint64(offset)  - full handle.
+//     varint64(size << 1 | 1)               - block follows right after the previous block
+//                                             (including its trailer).
+// Index entries at restart points are always encoded fully, so any restart point could be used as
+// a starting point for decoding.
+//
+// Encodes handle to dst, prev_handle is the handle of the previous entry of the same restart
+// interval or nullptr if this entry starts a new restart interval.
+void EncodeIndexBlockHandle(
+    const BlockHandle& handle, const BlockHandle* prev_handle, std::string* dst);
+
+// Decodes handle encoded with EncodeIndexBlockHandle. *handle should contain the previous decoded
+// handle of the same restart interval (or not be set for restart points) and is updated in place.
+Status DecodeIndexBlockHandle(Slice* input, BlockHandle* handle);
+
 inline uint32_t GetCompressFormatForVersion(CompressionType compression_type,
                                             uint32_t version) {
   // snappy is not versioned
@@ -258,6 +275,17 @@ extern Status ReadBlockContents(RandomAccessFileReader* file,
                                 const std::shared_ptr<yb::MemTracker>& mem_tracker,
                                 bool do_uncompress);
 
+// Reads blocks identified by handles from file using a single batched read, see
+// RandomAccessFile::MultiRead. Fills contents for each of num_handles blocks.
+extern Status ReadBlockContentsBatch(RandomAccessFileReader* file,
+                                     const Footer& footer,
+                                     const ReadOptions& options,
+                                     const BlockHandle* handles,
+                                     size_t num_handles,
+                                     BlockContents* contents, Env* env,
+                                     const std::shared_ptr<yb::MemTracker>& mem_tracker,
+                                     bool do_uncompress);
+
 // The 'data' points to the raw block contents read in from file.
 // This method allocates a new heap buffer and the raw block
 // contents are uncompresed into this buffer. This buffer is
@@ -37,7 +37,8 @@ IndexBuilder* IndexBuilder::CreateIndexBuilder(
   switch (type) {
     case IndexType::kBinarySearch: {
       return new ShortenedIndexBuilder(comparator,
-                                       table_opt.index_block_restart_interval);
+                                       table_opt.index_block_restart_interval,
+                                       table_opt.delta_encode_index_block_handles);
     }
     case IndexType::kHashSearch: {
       return new HashIndexBuilder(comparator, prefix_extractor,
@@ -59,17 +60,7 @@ IndexBuilder* IndexBuilder::CreateIndexBuilder(
 void ShortenedIndexBuilder::AddIndexEntry(
     std::string* last_key_in_current_block,
     const Slice* first_key_in_next_block,
-    const BlockHandle& block_handle) {
-  std::string handle_encoding;
-  block_handle.AppendEncodedTo(&handle_encoding);
-  AddIndexEntry(
-      last_key_in_current_block, first_key_in_next_block, handle_encoding, ShortenKeys::kTrue);
-}
-
-void ShortenedIndexBuilder::AddIndexEntry(
-    std::string* last_key_in_current_block,
-    const Slice* first_key_in_next_block,
-    const std::string& block_handle_encoded,
+    const BlockHandle& block_handle,
     const ShortenKeys shorten_keys) {
   if (shorten_keys) {
     if (UNLIKELY(first_key_in_next_block == nullptr)) {
@@ -79,7 +70,17 @@ void ShortenedIndexBuilder::AddIndexEntry(
     }
   }
 
-  index_block_builder_.Add(*last_key_in_current_block, block_handle_encoded);
+  block_handle_encoding_.clear();
+  if (delta_encode_block_handles_) {
+    EncodeIndexBlockHandle(
+        block_handle, index_block_builder_.IsNextEntryRestart() ? nullptr : &last_block_handle_,
+        &block_handle_encoding_);
+    last_block_handle_ = block_handle;
+  } else {
+    block_handle.AppendEncodedTo(&block_handle_encoding_);
+  }
+
+  index_block_builder_.Add(*last_key_in_current_block, block_handle_encoding_);
 }
 
 Status ShortenedIndexBuilder::Finish(IndexBlocks* index_blocks) {
@@ -146,8 +147,9 @@ MultiLevelIndexBuilder::MultiLevelIndexBuilder(
 void MultiLevelIndexBuilder::EnsureCurrentLevelIndexBuilderCreated() {
   if (!current_level_index_block_builder_) {
     DCHECK(!flush_policy_);
-    current_level_index_block_builder_.reset(
-        new ShortenedIndexBuilder(comparator_, table_opt_.index_block_restart_interval));
+    current_level_index_block_builder_.reset(new ShortenedIndexBuilder(
+        comparator_, table_opt_.index_block_restart_interval,
+        table_opt_.delta_encode_index_block_handles));
     flush_policy_ = FlushBlockBySizePolicyFactory::NewFlushBlockPolicy(
         table_opt_.index_block_size, table_opt_.block_size_deviation,
         table_opt_.min_keys_per_index_block,
@@ -162,13 +164,12 @@ void MultiLevelIndexBuilder::AddIndexEntry(
       << "Expected to first flush already complete index block";
   EnsureCurrentLevelIndexBuilderCreated();
 
-  block_handle_encoding_.clear();
-  block_handle.AppendEncodedTo(&block_handle_encoding_);
-
   current_level_index_block_builder_->AddIndexEntry(
-      last_key_in_current_block, first_key_in_next_block, block_handle_encoding_, shorten_keys);
+      last_key_in_current_block, first_key_in_next_block, block_handle, shorten_keys);
 
-  if (flush_policy_->Update(*last_key_in_current_block, block_handle_encoding_)
+  if (flush_policy_->Update(
+          *last_key_in_current_block,
+          current_level_index_block_builder_->last_block_handle_encoding())
       || first_key_in_next_block == nullptr) {
     current_level_block_.is_ready = true;
     yb::CopyToBuffer(*last_key_in_current_block, &current_level_block_.last_key);
@@ -116,24 +116,33 @@ YB_STRONGLY_TYPED_BOOL(ShortenKeys);
 //  2. Shorten the key length for index block. Other than honestly using the
 //     last key in the data block as the index key, we instead find a shortest
 //     substitute key that serves the same function.
+//  3. Optionally store block handles in compact form (see EncodeIndexBlockHandle).
 class ShortenedIndexBuilder : public IndexBuilder {
  public:
   explicit ShortenedIndexBuilder(const Comparator* comparator,
-                                 int index_block_restart_interval)
+                                 int index_block_restart_interval,
+                                 bool delta_encode_block_handles = false)
       : IndexBuilder(comparator),
-        index_block_builder_(index_block_restart_interval, kIndexBlockKeyValueEncodingFormat) {}
+        index_block_builder_(index_block_restart_interval, kIndexBlockKeyValueEncodingFormat),
+        delta_encode_block_handles_(delta_encode_block_handles) {}
 
   void AddIndexEntry(
       std::string* last_key_in_current_block,
       const Slice* first_key_in_next_block,
-      const BlockHandle& block_handle) override;
+      const BlockHandle& block_handle) override {
+    AddIndexEntry(
+        last_key_in_current_block, first_key_in_next_block, block_handle, ShortenKeys::kTrue);
+  }
 
   void AddIndexEntry(
       std::string* last_key_in_current_block,
       const Slice* first_key_in_next_block,
-      const std::string& block_handle_encoded,
+      const BlockHandle& block_handle,
       ShortenKeys shorten_keys);
 
+  // Returns block handle encoding stored with the last added index entry.
+  const std::string& last_block_handle_encoding() const { return block_handle_encoding_; }
+
   CHECKED_STATUS Finish(IndexBlocks* index_blocks) override;
 
   size_t EstimatedSize() const override {
@@ -148,6 +157,9 @@ class ShortenedIndexBuilder : public IndexBuilder {
 
  private:
   BlockBuilder index_block_builder_;
+  const bool delta_encode_block_handles_;
+  BlockHandle last_block_handle_;
+  std::string block_handle_encoding_;
 };
 
 // HashIndexBuilder contains a binary-searchable primary index and the
@@ -305,8 +317,6 @@ class MultiLevelIndexBuilder : public IndexBuilder {
     // FlushNextBlock().
     bool just_flushed = false;
   } next_level_;
-  // Buffer for block handle encoding.
-  std::string block_handle_encoding_;
 };
 
 } // namespace rocksdb
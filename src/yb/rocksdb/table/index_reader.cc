@@ -28,13 +28,15 @@ Status BinarySearchIndexReader::Create(
     const BlockHandle& index_handle, Env* env,
     const ComparatorPtr& comparator,
     std::unique_ptr<IndexReader>* index_reader,
-    const std::shared_ptr<yb::MemTracker>& mem_tracker) {
+    const std::shared_ptr<yb::MemTracker>& mem_tracker,
+    bool index_block_handles_delta_encoded) {
   std::unique_ptr<Block> index_block;
   auto s = block_based_table::ReadBlockFromFile(
       file, footer, ReadOptions::kDefault, index_handle, &index_block, env, mem_tracker);
 
   if (s.ok()) {
-    index_reader->reset(new BinarySearchIndexReader(comparator, std::move(index_block)));
+    index_reader->reset(new BinarySearchIndexReader(
+        comparator, std::move(index_block), index_block_handles_delta_encoded));
   }
 
   return s;
@@ -289,19 +291,21 @@ class MultiLevelIterator : public InternalIterator {
 Result<std::unique_ptr<MultiLevelIndexReader>> MultiLevelIndexReader::Create(
     RandomAccessFileReader* file, const Footer& footer, const int num_levels,
     const BlockHandle& top_level_index_handle, Env* env, const ComparatorPtr& comparator,
-    const std::shared_ptr<yb::MemTracker>& mem_tracker) {
+    const std::shared_ptr<yb::MemTracker>& mem_tracker,
+    bool index_block_handles_delta_encoded) {
   std::unique_ptr<Block> index_block;
   RETURN_NOT_OK(block_based_table::ReadBlockFromFile(
       file, footer, ReadOptions::kDefault, top_level_index_handle, &index_block, env,
       mem_tracker));
 
-  return std::make_unique<MultiLevelIndexReader>(comparator, num_levels, std::move(index_block));
+  return std::make_unique<MultiLevelIndexReader>(
+      comparator, num_levels, std::move(index_block), index_block_handles_delta_encoded);
 }
 
 InternalIterator* MultiLevelIndexReader::NewIterator(
     BlockIter* iter, TwoLevelIteratorState* index_iterator_state, bool) {
   InternalIterator* top_level_iter = top_level_index_block_->NewIndexIterator(
-      comparator_.get(), iter, true /* total_order_seek */);
+      comparator_.get(), iter, true /* total_order_seek */, index_block_handles_delta_encoded_);
   return new MultiLevelIterator(
       index_iterator_state, top_level_iter, num_levels_, top_level_iter != iter);
 }
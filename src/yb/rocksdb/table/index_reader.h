@@ -84,16 +84,20 @@ class BinarySearchIndexReader : public IndexReader {
   // `BinarySearchIndexReader`.
   // On success, index_reader will be populated; otherwise it will remain
   // unmodified.
+  // index_block_handles_delta_encoded specifies whether index block was built with
+  // BlockBasedTableOptions::delta_encode_index_block_handles.
   static CHECKED_STATUS Create(
       RandomAccessFileReader* file, const Footer& footer, const BlockHandle& index_handle, Env* env,
       const ComparatorPtr& comparator, std::unique_ptr<IndexReader>* index_reader,
-      const std::shared_ptr<yb::MemTracker>& mem_tracker);
+      const std::shared_ptr<yb::MemTracker>& mem_tracker,
+      bool index_block_handles_delta_encoded = false);
 
   InternalIterator* NewIterator(
       BlockIter* iter = nullptr,
       // Rest of parameters are ignored by BinarySearchIndexReader.
       TwoLevelIteratorState* state = nullptr, bool total_order_seek = true) override {
-    auto new_iter = index_block_->NewIndexIterator(comparator_.get(), iter, true);
+    auto new_iter = index_block_->NewIndexIterator(
+        comparator_.get(), iter, true, index_block_handles_delta_encoded_);
     return iter ? nullptr : new_iter;
   }
 
@@ -116,14 +120,17 @@ class BinarySearchIndexReader : public IndexReader {
 
  private:
   BinarySearchIndexReader(const ComparatorPtr& comparator,
-                          std::unique_ptr<Block>&& index_block)
-      : IndexReader(comparator), index_block_(std::move(index_block)) {
+                          std::unique_ptr<Block>&& index_block,
+                          bool index_block_handles_delta_encoded)
+      : IndexReader(comparator), index_block_(std::move(index_block)),
+        index_block_handles_delta_encoded_(index_block_handles_delta_encoded) {
     DCHECK(index_block_);
   }
 
   ~BinarySearchIndexReader() {}
 
   const std::unique_ptr<Block> index_block_;
+  const bool index_block_handles_delta_encoded_;
 };
 
 // Index that leverages an internal hash table to quicken the lookup for a given
@@ -183,14 +190,16 @@ class MultiLevelIndexReader : public IndexReader {
   static Result<std::unique_ptr<MultiLevelIndexReader>> Create(
       RandomAccessFileReader* file, const Footer& footer, int num_levels,
       const BlockHandle& top_level_index_handle, Env* env, const ComparatorPtr& comparator,
-      const std::shared_ptr<yb::MemTracker>& mem_tracker);
+      const std::shared_ptr<yb::MemTracker>& mem_tracker,
+      bool index_block_handles_delta_encoded = false);
 
   MultiLevelIndexReader(
       const ComparatorPtr& comparator, int num_levels,
-      std::unique_ptr<Block> top_level_index_block)
+      std::unique_ptr<Block> top_level_index_block, bool index_block_handles_delta_encoded)
       : IndexReader(comparator),
         num_levels_(num_levels),
-        top_level_index_block_(std::move(top_level_index_block)) {
+        top_level_index_block_(std::move(top_level_index_block)),
+        index_block_handles_delta_encoded_(index_block_handles_delta_encoded) {
     DCHECK_ONLY_NOTNULL(top_level_index_block_.get());
   }
 
@@ -214,6 +223,7 @@ class MultiLevelIndexReader : public IndexReader {
 
   const int num_levels_;
   const std::unique_ptr<Block> top_level_index_block_;
+  const bool index_block_handles_delta_encoded_;
 };
 
 } // namespace rocksdb
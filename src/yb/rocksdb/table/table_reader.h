@@ -24,6 +24,7 @@
 #ifndef YB_ROCKSDB_TABLE_TABLE_READER_H
 #define YB_ROCKSDB_TABLE_TABLE_READER_H
 
+#include <functional>
 #include <memory>
 
 #include "yb/rocksdb/status.h"
@@ -124,6 +125,13 @@ class TableReader {
   virtual yb::Result<std::string> GetMiddleKey() {
     return STATUS(NotSupported, "GetMiddleKey() not supported");
   }
+
+  // Calls callback with the index key of every data block of SST file, in increasing order. Index
+  // key is not less than the keys of its data block and is less than the keys of the next data
+  // block, but might not match any key actually written to SST file.
+  virtual Status IterateDataBlockKeys(const std::function<void(const Slice&)>& callback) {
+    return STATUS(NotSupported, "IterateDataBlockKeys() not supported");
+  }
 };
 
 }  // namespace rocksdb
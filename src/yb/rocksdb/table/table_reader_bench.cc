@@ -43,9 +43,14 @@ int main() {
 #include "yb/rocksdb/util/testharness.h"
 #include "yb/rocksdb/util/testutil.h"
 
+#include "yb/util/format.h"
+#include "yb/util/size_literals.h"
+
 using GFLAGS::ParseCommandLineFlags;
 using GFLAGS::SetUsageMessage;
 
+using namespace yb::size_literals;
+
 namespace rocksdb {
 
 namespace {
@@ -159,6 +164,17 @@ void TableReaderBenchmark(const Options& opts, const EnvOptions& env_options,
     }
   }
 
+  std::string index_size_info;
+  if (table_reader) {
+    // Index blocks are kept in memory for fast lookups, so their size per amount of data is what
+    // index compression options are tuned for.
+    auto props = table_reader->GetTableProperties();
+    index_size_info = yb::Format(
+        "Data size: $0   Data index size: $1   Data index bytes per MB of data: $2\n",
+        props->data_size, props->data_index_size,
+        props->data_size ? props->data_index_size * 1_MB / props->data_size : 0);
+  }
+
   Random rnd(301);
   std::string result;
   HistogramImpl hist;
@@ -248,9 +264,10 @@ void TableReaderBenchmark(const Options& opts, const EnvOptions& env_options,
       "num_key2: %5d  %10s\n"
       "==================================================="
       "===================================================="
-      "\nHistogram (unit: %s): \n%s",
+      "\n%sHistogram (unit: %s): \n%s",
       opts.table_factory->Name(), num_keys1, num_keys2,
       for_iterator ? "iterator" : (if_query_empty_keys ? "empty" : "non_empty"),
+      index_size_info.c_str(),
       measured_by_nanosecond ? "nanosecond" : "microsecond",
       hist.ToString().c_str());
   if (!through_db) {
@@ -277,6 +294,11 @@ DEFINE_bool(through_db, false, "If enable, a DB instance will be created and "
 DEFINE_bool(mmap_read, true, "Whether use mmap read");
 DEFINE_string(table_factory, "block_based",
               "Table factory to use: `block_based` (default) or `plain_table`.");
+DEFINE_int32(index_block_restart_interval, 1,
+             "Restart interval for index blocks of block based table, values above 1 enable "
+             "shared prefix compression of index keys.");
+DEFINE_bool(delta_encode_index_block_handles, false,
+            "Whether to delta encode block handles in index blocks of block based table.");
 DEFINE_string(time_unit, "microsecond",
               "The time unit used for measuring performance. User can specify "
               "`microsecond` (default) or `nanosecond`");
@@ -310,7 +332,10 @@ int main(int argc, char** argv) {
     options.prefix_extractor.reset(rocksdb::NewFixedPrefixTransform(
         FLAGS_prefix_len));
   } else if (FLAGS_table_factory == "block_based") {
-    tf.reset(new rocksdb::BlockBasedTableFactory());
+    rocksdb::BlockBasedTableOptions table_options;
+    table_options.index_block_restart_interval = FLAGS_index_block_restart_interval;
+    table_options.delta_encode_index_block_handles = FLAGS_delta_encode_index_block_handles;
+    tf.reset(new rocksdb::BlockBasedTableFactory(table_options));
   } else {
     fprintf(stderr, "Invalid table type %s\n", FLAGS_table_factory.c_str());
   }
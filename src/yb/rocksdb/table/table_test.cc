@@ -2498,6 +2498,65 @@ TEST_P(IndexBlockRestartIntervalTest, IndexBlockRestartInterval) {
   }
 }
 
+TEST_P(IndexBlockRestartIntervalTest, DeltaEncodedIndexBlockHandles) {
+  const int kKeysInTable = 5000;
+  const int kKeySize = 100;
+  const int kValSize = 500;
+
+  for (auto index_type : {IndexType::kBinarySearch, IndexType::kMultiLevelBinarySearch}) {
+    uint64_t plain_index_size = 0;
+    for (bool delta_encode : {false, true}) {
+      Options options;
+      BlockBasedTableOptions table_options;
+      table_options.block_size = 64;  // small block size to get big index block
+      table_options.index_type = index_type;
+      table_options.index_block_restart_interval = GetParam();
+      table_options.delta_encode_index_block_handles = delta_encode;
+      options.table_factory.reset(new BlockBasedTableFactory(table_options));
+
+      TableConstructor c(BytewiseComparator());
+      // Same keys for both tables, so index sizes are comparable.
+      Random rnd(301);
+      for (int i = 0; i < kKeysInTable; i++) {
+        InternalKey k(RandomString(&rnd, kKeySize), 0, kTypeValue);
+        c.Add(k.Encode().ToString(), RandomString(&rnd, kValSize));
+      }
+
+      std::vector<std::string> keys;
+      stl_wrappers::KVMap kvmap;
+      auto comparator = std::make_shared<InternalKeyComparator>(BytewiseComparator());
+      const ImmutableCFOptions ioptions(options);
+      c.Finish(options, ioptions, table_options, comparator, &keys, &kvmap);
+      auto reader = c.GetTableReader();
+
+      const auto index_size = reader->GetTableProperties()->data_index_size;
+      if (delta_encode) {
+        ASSERT_LT(index_size, plain_index_size);
+      } else {
+        plain_index_size = index_size;
+      }
+
+      std::unique_ptr<InternalIterator> db_iter(reader->NewIterator(ReadOptions()));
+      for (auto& kv : kvmap) {
+        db_iter->Seek(kv.first);
+        ASSERT_OK(db_iter->status());
+        ASSERT_TRUE(db_iter->Valid());
+        ASSERT_EQ(db_iter->key(), kv.first);
+        ASSERT_EQ(db_iter->value(), kv.second);
+      }
+
+      auto kv_iter = kvmap.rbegin();
+      for (db_iter->SeekToLast(); db_iter->Valid(); db_iter->Prev()) {
+        ASSERT_EQ(db_iter->key(), kv_iter->first);
+        ASSERT_EQ(db_iter->value(), kv_iter->second);
+        kv_iter++;
+      }
+      ASSERT_OK(db_iter->status());
+      ASSERT_EQ(kv_iter, kvmap.rend());
+    }
+  }
+}
+
 class PrefixTest : public RocksDBTest {};
 
 namespace {
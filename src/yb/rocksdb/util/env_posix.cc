@@ -131,6 +131,23 @@ void SetFD_CLOEXEC(int fd, const EnvOptions* options) {
   }
 }
 
+// Opens file with O_DIRECT added to flags if *direct is true. Falls back to the regular open when
+// direct I/O is not supported by the platform or the file system, resetting *direct in this case.
+int OpenMaybeDirect(const std::string& fname, int flags, mode_t mode, bool* direct) {
+#ifdef O_DIRECT
+  if (*direct) {
+    int fd = open(fname.c_str(), flags | O_DIRECT, mode);
+    if (fd >= 0 || errno != EINVAL) {
+      return fd;
+    }
+    YB_LOG_EVERY_N_SECS(WARNING, 60)
+        << "Direct I/O is not supported for " << fname << ", falling back to buffered I/O";
+  }
+#endif
+  *direct = false;
+  return open(fname.c_str(), flags, mode);
+}
+
 class PosixFileLock : public FileLock {
  public:
   int fd_;
@@ -598,13 +615,16 @@ class PosixRocksDBFileFactory : public RocksDBFileFactory {
     result->reset();
     Status s;
     int fd;
+    bool use_direct_reads = options.use_direct_reads && !options.use_mmap_reads;
     {
       IOSTATS_TIMER_GUARD(open_nanos);
-      fd = open(fname.c_str(), O_RDONLY);
+      fd = OpenMaybeDirect(fname, O_RDONLY, 0, &use_direct_reads);
     }
     SetFD_CLOEXEC(fd, &options);
     if (fd < 0) {
       s = STATUS_IO_ERROR(fname, errno);
+    } else if (use_direct_reads) {
+      *result = std::make_unique<PosixDirectIORandomAccessFile>(fname, fd, options);
     } else if (options.use_mmap_reads && sizeof(void*) >= 8) {
       // Use of mmap for random reads has been removed because it
       // kills performance when storage is fast.
@@ -632,12 +652,16 @@ class PosixRocksDBFileFactory : public RocksDBFileFactory {
     result->reset();
     Status s;
     int fd = -1;
+    bool use_direct_writes = options.use_direct_writes && !options.use_mmap_writes;
     do {
       IOSTATS_TIMER_GUARD(open_nanos);
-      fd = open(fname.c_str(), O_CREAT | O_RDWR | O_TRUNC, 0644);
+      fd = OpenMaybeDirect(fname, O_CREAT | O_RDWR | O_TRUNC, 0644, &use_direct_writes);
     } while (fd < 0 && errno == EINTR);
     if (fd < 0) {
       s = STATUS_IO_ERROR(fname, errno);
+    } else if (use_direct_writes) {
+      SetFD_CLOEXEC(fd, &options);
+      *result = std::make_unique<PosixWritableFile>(fname, fd, options);
     } else {
       SetFD_CLOEXEC(fd, &options);
       if (options.use_mmap_writes) {
@@ -656,6 +680,7 @@ class PosixRocksDBFileFactory : public RocksDBFileFactory {
         // disable mmap writes
         EnvOptions no_mmap_writes_options = options;
         no_mmap_writes_options.use_mmap_writes = false;
+        no_mmap_writes_options.use_direct_writes = false;
         *result = std::make_unique<PosixWritableFile>(fname, fd, no_mmap_writes_options);
       }
     }
@@ -699,6 +724,7 @@ class PosixRocksDBFileFactory : public RocksDBFileFactory {
         // disable mmap writes
         EnvOptions no_mmap_writes_options = options;
         no_mmap_writes_options.use_mmap_writes = false;
+        no_mmap_writes_options.use_direct_writes = false;
 
         *result = std::make_unique<PosixWritableFile>(fname, fd, no_mmap_writes_options);
       }
@@ -26,8 +26,10 @@
 #endif
 #include <sys/types.h>
 
+#include <algorithm>
 #include <atomic>
 #include <list>
+#include <vector>
 
 #ifdef __linux__
 #include <fcntl.h>
@@ -44,14 +46,20 @@
 #include "yb/rocksdb/env.h"
 #include "yb/rocksdb/port/port.h"
 #include "yb/rocksdb/util/coding.h"
+#include "yb/rocksdb/util/file_reader_writer.h"
 #include "yb/rocksdb/util/log_buffer.h"
 #include "yb/rocksdb/util/mutexlock.h"
 #include "yb/rocksdb/util/testharness.h"
 #include "yb/rocksdb/util/testutil.h"
 
+#include "yb/util/cast.h"
+#include "yb/util/random_util.h"
+#include "yb/util/size_literals.h"
 #include "yb/util/string_util.h"
 #include "yb/util/test_util.h"
 
+using namespace yb::size_literals;
+
 namespace rocksdb {
 
 namespace {
@@ -1086,6 +1094,91 @@ TEST_F(EnvPosixTest, WritableFileWrapper) {
   EXPECT_EQ(14, step);
 }
 
+TEST_F(EnvPosixTest, DirectIO) {
+  const std::string fname = test::TmpDir() + "/direct_io_testfile";
+  EnvOptions options;
+  options.use_mmap_writes = false;
+  options.use_direct_writes = true;
+  options.use_direct_reads = true;
+
+  // Write chunks of arbitrary sizes, so writer has to pad the last page and truncate file on close.
+  std::string data;
+  {
+    unique_ptr<WritableFile> file;
+    ASSERT_OK(env_->NewWritableFile(fname, &file, options));
+    WritableFileWriter writer(std::move(file), options);
+    for (int i = 0; i != 100; ++i) {
+      auto chunk = yb::RandomString(yb::RandomUniformInt<size_t>(1, 10000));
+      ASSERT_OK(writer.Append(chunk));
+      data += chunk;
+    }
+    ASSERT_OK(writer.Close());
+  }
+
+  uint64_t file_size;
+  ASSERT_OK(env_->GetFileSize(fname, &file_size));
+  ASSERT_EQ(data.size(), file_size);
+
+  unique_ptr<RandomAccessFile> file;
+  ASSERT_OK(env_->NewRandomAccessFile(fname, &file, options));
+  std::string scratch(20000, 0);
+  for (int i = 0; i != 1000; ++i) {
+    const auto offset = yb::RandomUniformInt<size_t>(0, data.size());
+    const auto size = yb::RandomUniformInt<size_t>(0, scratch.size());
+    Slice result;
+    ASSERT_OK(file->Read(offset, size, &result, pointer_cast<uint8_t*>(&scratch[0])));
+    ASSERT_EQ(data.substr(offset, size), result.ToBuffer());
+  }
+
+  ASSERT_OK(env_->DeleteFile(fname));
+}
+
+TEST_F(EnvPosixTest, MultiRead) {
+  const std::string fname = test::TmpDir() + "/multi_read_testfile";
+  const EnvOptions options;
+  const std::string data = yb::RandomString(1_MB);
+  {
+    unique_ptr<WritableFile> file;
+    ASSERT_OK(env_->NewWritableFile(fname, &file, options));
+    ASSERT_OK(file->Append(data));
+    ASSERT_OK(file->Close());
+  }
+
+  unique_ptr<RandomAccessFile> file;
+  ASSERT_OK(env_->NewRandomAccessFile(fname, &file, options));
+
+  // Mix of adjacent, overlapping, distant and past the end of file ranges, in random order.
+  std::vector<std::pair<uint64_t, size_t>> ranges = {
+      {0, 100}, {100, 200}, {50, 1000}, {10000, 4096}, {500000, 10}, {1_MB - 10, 100},
+      {2_MB, 100}, {20000, 0}, {12000, 3000}};
+  for (int i = 0; i != 100; ++i) {
+    ranges.emplace_back(
+        yb::RandomUniformInt<uint64_t>(0, data.size()), yb::RandomUniformInt<size_t>(0, 64_KB));
+  }
+  std::shuffle(ranges.begin(), ranges.end(), yb::ThreadLocalRandom());
+
+  std::vector<std::string> scratches;
+  std::vector<RandomAccessFile::ReadRequest> requests;
+  scratches.reserve(ranges.size());
+  for (const auto& range : ranges) {
+    scratches.emplace_back(range.second, 0);
+    RandomAccessFile::ReadRequest request;
+    request.offset = range.first;
+    request.size = range.second;
+    request.scratch = pointer_cast<uint8_t*>(&scratches.back()[0]);
+    requests.push_back(request);
+  }
+  ASSERT_OK(file->MultiRead(requests.data(), requests.size()));
+
+  for (const auto& request : requests) {
+    const auto expected = request.offset < data.size()
+        ? data.substr(request.offset, request.size) : std::string();
+    ASSERT_EQ(expected, request.result.ToBuffer()) << request.offset << ", " << request.size;
+  }
+
+  ASSERT_OK(env_->DeleteFile(fname));
+}
+
 }  // namespace rocksdb
 
 int main(int argc, char** argv) {
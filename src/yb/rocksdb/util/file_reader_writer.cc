@@ -86,6 +86,25 @@ Status RandomAccessFileReader::ReadAndValidate(
   return s;
 }
 
+Status RandomAccessFileReader::MultiRead(
+    RandomAccessFile::ReadRequest* requests, size_t num_requests) const {
+  uint64_t elapsed = 0;
+  Status s;
+  {
+    StopWatch sw(env_, stats_, hist_type_,
+                 (stats_ != nullptr) ? &elapsed : nullptr);
+    IOSTATS_TIMER_GUARD(read_nanos);
+    s = file_->MultiRead(requests, num_requests);
+    for (auto* request = requests; request != requests + num_requests; ++request) {
+      IOSTATS_ADD_IF_POSITIVE(bytes_read, request->result.size());
+    }
+  }
+  if (stats_ != nullptr && file_read_hist_ != nullptr) {
+    file_read_hist_->Add(elapsed);
+  }
+  return s;
+}
+
 WritableFileWriter::~WritableFileWriter() {
   WARN_NOT_OK(Close(), "Failed to close file");
 }
@@ -118,6 +118,9 @@ class RandomAccessFileReader {
   CHECKED_STATUS ReadAndValidate(
       uint64_t offset, size_t n, Slice* result, char* scratch, const yb::ReadValidator& validator);
 
+  // Reads a batch of ranges, see RandomAccessFile::MultiRead.
+  CHECKED_STATUS MultiRead(RandomAccessFile::ReadRequest* requests, size_t num_requests) const;
+
   RandomAccessFile* file() { return file_.get(); }
 };
 
@@ -36,16 +36,21 @@
 #include <sys/mman.h>
 #include <sys/stat.h>
 #include <sys/types.h>
+
+#include <algorithm>
+
 #ifdef __linux__
 #include <sys/statfs.h>
 #include <sys/syscall.h>
 #endif
 #include "yb/rocksdb/port/port.h"
+#include "yb/rocksdb/util/aligned_buffer.h"
 #include "yb/rocksdb/util/coding.h"
 #include "yb/rocksdb/util/posix_logger.h"
 #include "yb/rocksdb/util/sync_point.h"
 
 #include "yb/util/file_system_posix.h"
+#include "yb/util/logging.h"
 #include "yb/util/malloc.h"
 #include "yb/util/result.h"
 #include "yb/util/slice.h"
@@ -369,6 +374,51 @@ Status PosixMmapFile::Allocate(uint64_t offset, uint64_t len) {
 }
 #endif
 
+namespace {
+
+// Max size of the aligned buffer that is kept by a thread for direct I/O reads.
+constexpr size_t kMaxThreadDirectIOBufferSize = 1024 * 1024;
+
+} // namespace
+
+/*
+ * PosixDirectIORandomAccessFile
+ *
+ * pread() based random access file opened with O_DIRECT.
+ */
+PosixDirectIORandomAccessFile::PosixDirectIORandomAccessFile(
+    const std::string& fname, int fd, const EnvOptions& options)
+    : yb::PosixRandomAccessFile(fname, fd, options) {
+}
+
+Status PosixDirectIORandomAccessFile::Read(
+    uint64_t offset, size_t n, Slice* result, uint8_t* scratch) const {
+  const uint64_t aligned_offset = TruncateToPageBoundary(kDirectIOAlignment, offset);
+  const size_t offset_advance = offset - aligned_offset;
+  const size_t aligned_size = Roundup(offset_advance + n, kDirectIOAlignment);
+
+  // Buffer is reused by reads of the same thread, so block reads do not allocate memory. Rare large
+  // reads use a temporary buffer, so threads do not keep it allocated.
+  static thread_local AlignedBuffer thread_buffer;
+  AlignedBuffer temp_buffer;
+  AlignedBuffer* buffer =
+      aligned_size <= kMaxThreadDirectIOBufferSize ? &thread_buffer : &temp_buffer;
+  if (buffer->Capacity() < aligned_size) {
+    buffer->Alignment(kDirectIOAlignment);
+    buffer->AllocateNewBuffer(aligned_size);
+  }
+  Slice aligned_result;
+  RETURN_NOT_OK(yb::PosixRandomAccessFile::Read(
+      aligned_offset, aligned_size, &aligned_result,
+      pointer_cast<uint8_t*>(buffer->Destination())));
+
+  const size_t size = aligned_result.size() > offset_advance
+      ? std::min(aligned_result.size() - offset_advance, n) : 0;
+  memcpy(scratch, aligned_result.data() + offset_advance, size);
+  *result = Slice(scratch, size);
+  return Status::OK();
+}
+
 /*
  * PosixWritableFile
  *
@@ -376,7 +426,7 @@ Status PosixMmapFile::Allocate(uint64_t offset, uint64_t len) {
  */
 PosixWritableFile::PosixWritableFile(const std::string& fname, int fd,
                                      const EnvOptions& options)
-    : filename_(fname), fd_(fd), filesize_(0) {
+    : filename_(fname), fd_(fd), filesize_(0), use_direct_writes_(options.use_direct_writes) {
 #ifdef ROCKSDB_FALLOCATE_PRESENT
   allow_fallocate_ = options.allow_fallocate;
   fallocate_with_keep_size_ = options.fallocate_with_keep_size;
@@ -391,6 +441,7 @@ PosixWritableFile::~PosixWritableFile() {
 }
 
 Status PosixWritableFile::Append(const Slice& data) {
+  DCHECK(!use_direct_writes_) << "Unaligned append to file opened for direct I/O: " << filename_;
   const char* src = data.cdata();
   size_t left = data.size();
   while (left != 0) {
@@ -408,7 +459,39 @@ Status PosixWritableFile::Append(const Slice& data) {
   return Status::OK();
 }
 
+Status PosixWritableFile::PositionedAppend(const Slice& data, uint64_t offset) {
+  if (!use_direct_writes_) {
+    return WritableFile::PositionedAppend(data, offset);
+  }
+  DCHECK_EQ(offset % kDirectIOAlignment, 0);
+  DCHECK_EQ(data.size() % kDirectIOAlignment, 0);
+  const char* src = data.cdata();
+  size_t left = data.size();
+  while (left != 0) {
+    ssize_t done = pwrite(fd_, src, left, static_cast<off_t>(offset));
+    if (done < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return STATUS_IO_ERROR(filename_, errno);
+    }
+    left -= done;
+    src += done;
+    offset += done;
+  }
+  filesize_ = std::max(filesize_, offset);
+  return Status::OK();
+}
+
 Status PosixWritableFile::Truncate(uint64_t size) {
+  if (!use_direct_writes_) {
+    return Status::OK();
+  }
+  // Last page was written padded with zeros, trim the file to the actual data size.
+  if (ftruncate(fd_, static_cast<off_t>(size)) != 0) {
+    return STATUS_IO_ERROR(filename_, errno);
+  }
+  filesize_ = size;
   return Status::OK();
 }
 
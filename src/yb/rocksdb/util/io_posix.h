@@ -27,6 +27,8 @@
 #include <unistd.h>
 #include "yb/rocksdb/env.h"
 
+#include "yb/util/file_system_posix.h"
+
 // For non linux platform, the following macros are used only as place
 // holder.
 #if !(defined __linux__) && !(defined CYGWIN)
@@ -41,11 +43,25 @@ namespace rocksdb {
 
 #define STATUS_IO_ERROR(context, err_number) STATUS(IOError, (context), strerror(err_number))
 
+// Alignment of offsets, sizes and memory buffers used for I/O on files opened with O_DIRECT.
+constexpr size_t kDirectIOAlignment = 4096;
+
+// pread() based random-access file opened with O_DIRECT. Reads are extended to aligned ranges and
+// done through an aligned buffer, so callers could use arbitrary offsets, sizes and scratch.
+class PosixDirectIORandomAccessFile : public yb::PosixRandomAccessFile {
+ public:
+  PosixDirectIORandomAccessFile(const std::string& fname, int fd, const EnvOptions& options);
+
+  CHECKED_STATUS Read(uint64_t offset, size_t n, Slice* result, uint8_t* scratch) const override;
+};
+
 class PosixWritableFile : public WritableFile {
  private:
   const std::string filename_;
   int fd_;
   uint64_t filesize_;
+  // File is opened with O_DIRECT, so all writes should be aligned and done via PositionedAppend.
+  const bool use_direct_writes_;
 #ifdef ROCKSDB_FALLOCATE_PRESENT
   bool allow_fallocate_;
   bool fallocate_with_keep_size_;
@@ -61,12 +77,21 @@ class PosixWritableFile : public WritableFile {
   virtual Status Truncate(uint64_t size) override;
   virtual Status Close() override;
   virtual Status Append(const Slice& data) override;
+  virtual Status PositionedAppend(const Slice& data, uint64_t offset) override;
   virtual Status Flush() override;
   virtual Status Sync() override;
   virtual Status Fsync() override;
   virtual bool IsSyncThreadSafe() const override;
   virtual uint64_t GetFileSize() override;
   virtual Status InvalidateCache(size_t offset, size_t length) override;
+
+  bool UseOSBuffer() const override {
+    return !use_direct_writes_;
+  }
+
+  size_t GetRequiredBufferAlignment() const override {
+    return kDirectIOAlignment;
+  }
 #ifdef ROCKSDB_FALLOCATE_PRESENT
   virtual Status Allocate(uint64_t offset, uint64_t len) override;
   virtual Status RangeSync(uint64_t offset, uint64_t nbytes) override;
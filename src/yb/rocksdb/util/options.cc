@@ -267,6 +267,8 @@ DBOptions::DBOptions()
       allow_os_buffer(true),
       allow_mmap_reads(false),
       allow_mmap_writes(false),
+      use_direct_reads(false),
+      use_direct_io_for_flush_and_compaction(false),
       allow_fallocate(true),
       is_fd_close_on_exec(true),
       skip_log_error_on_recovery(false),
@@ -359,6 +361,10 @@ void DBOptions::Dump(Logger* log) const {
       allow_mmap_reads);
   RHEADER(log, "                       Options.allow_mmap_writes: %d",
       allow_mmap_writes);
+  RHEADER(log, "                        Options.use_direct_reads: %d",
+      use_direct_reads);
+  RHEADER(log, "  Options.use_direct_io_for_flush_and_compaction: %d",
+      use_direct_io_for_flush_and_compaction);
   RHEADER(log, "                     Options.is_fd_close_on_exec: %d",
       is_fd_close_on_exec);
   RHEADER(log, "                   Options.stats_dump_period_sec: %u",
@@ -188,6 +188,12 @@ static std::unordered_map<std::string, OptionTypeInfo> db_options_type_info = {
     {"allow_os_buffer",
      {offsetof(struct DBOptions, allow_os_buffer), OptionType::kBoolean,
       OptionVerificationType::kNormal}},
+    {"use_direct_reads",
+     {offsetof(struct DBOptions, use_direct_reads), OptionType::kBoolean,
+      OptionVerificationType::kNormal}},
+    {"use_direct_io_for_flush_and_compaction",
+     {offsetof(struct DBOptions, use_direct_io_for_flush_and_compaction), OptionType::kBoolean,
+      OptionVerificationType::kNormal}},
     {"create_if_missing",
      {offsetof(struct DBOptions, create_if_missing), OptionType::kBoolean,
       OptionVerificationType::kNormal}},
@@ -549,12 +555,18 @@ static std::unordered_map<std::string,
     {"index_block_restart_interval",
      {offsetof(struct BlockBasedTableOptions, index_block_restart_interval),
       OptionType::kInt, OptionVerificationType::kNormal}},
+    {"delta_encode_index_block_handles",
+     {offsetof(struct BlockBasedTableOptions, delta_encode_index_block_handles),
+      OptionType::kBoolean, OptionVerificationType::kNormal}},
     {"index_block_size",
      {offsetof(struct BlockBasedTableOptions, index_block_size), OptionType::kSizeT,
       OptionVerificationType::kNormal}},
     {"min_keys_per_index_block",
      {offsetof(struct BlockBasedTableOptions, min_keys_per_index_block), OptionType::kSizeT,
       OptionVerificationType::kNormal}},
+    {"data_block_hash_table_util_ratio",
+     {offsetof(struct BlockBasedTableOptions, data_block_hash_table_util_ratio),
+      OptionType::kDouble, OptionVerificationType::kNormal}},
     {"filter_policy",
      {offsetof(struct BlockBasedTableOptions, filter_policy),
       OptionType::kFilterPolicy, OptionVerificationType::kByName}},
@@ -1620,8 +1620,9 @@ Status GetFromString(BlockBasedTableOptions* source, BlockBasedTableOptions* des
       "block_cache=1M;block_cache_compressed=1k;block_size=1024;filter_block_size=16384;"
       "block_size_deviation=8;block_restart_interval=4; "
       "index_block_restart_interval=4;index_block_size=16384;min_keys_per_index_block=16;"
+      "delta_encode_index_block_handles=1;"
       "filter_policy=bloomfilter:4:true;whole_key_filtering=1;"
-      "skip_table_builder_flush=1;format_version=1;"
+      "skip_table_builder_flush=1;format_version=1;data_block_hash_table_util_ratio=0.5;"
       "hash_index_allow_collision=false;";
 
   RETURN_NOT_OK(GetBlockBasedTableOptionsFromString(*source, kOptionsString, destination));
@@ -1682,6 +1683,8 @@ Status GetFromString(DBOptions* source, DBOptions* destination) {
       "stats_dump_period_sec=70127;"
       "allow_fallocate=true;"
       "allow_mmap_reads=true;"
+      "use_direct_reads=false;"
+      "use_direct_io_for_flush_and_compaction=false;"
       "max_log_file_size=4607;"
       "random_access_max_buffer_size=1048576;"
       "advise_random_on_open=true;"
@@ -1893,6 +1896,8 @@ TEST_F(OptionsParserTest, BlockBasedTableOptionsAllFieldsSettable) {
       BLACKLIST_ENTRY(BlockBasedTableOptions, block_cache),
       BLACKLIST_ENTRY(BlockBasedTableOptions, block_cache_compressed),
       BLACKLIST_ENTRY(BlockBasedTableOptions, data_block_key_value_encoding_format),
+      BLACKLIST_ENTRY(BlockBasedTableOptions, data_block_index_type),
+      BLACKLIST_ENTRY(BlockBasedTableOptions, data_block_hash_index_key_transformer),
       BLACKLIST_ENTRY(BlockBasedTableOptions, filter_policy),
       BLACKLIST_ENTRY(BlockBasedTableOptions, supported_filter_policies),
   };
@@ -1932,6 +1937,7 @@ TEST_F(OptionsParserTest, DBOptionsAllFieldsSettable) {
       BLACKLIST_ENTRY(DBOptions, boundary_extractor),
       BLACKLIST_ENTRY(DBOptions, max_file_size_for_compaction),
       BLACKLIST_ENTRY(DBOptions, mem_table_flush_filter_factory),
+      BLACKLIST_ENTRY(DBOptions, flush_record_filter_factory),
       BLACKLIST_ENTRY(DBOptions, log_prefix),
       BLACKLIST_ENTRY(DBOptions, mem_tracker),
       BLACKLIST_ENTRY(DBOptions, block_based_table_mem_tracker),
@@ -290,6 +290,11 @@ class StackableDB : public DB {
     return db_->GetMiddleKey();
   };
 
+  yb::Result<std::vector<DataBlockBounds>> SampleDataBlocks(
+      size_t max_blocks, uint64_t* num_blocks) override {
+    return db_->SampleDataBlocks(max_blocks, num_blocks);
+  }
+
   virtual void GetColumnFamilyMetaData(
       ColumnFamilyHandle *column_family,
       ColumnFamilyMetaData* cf_meta) override {
@@ -132,8 +132,13 @@ class RocksDBEncryptedFileFactory : public rocksdb::RocksDBFileFactoryWrapper {
 
   Status NewWritableFile(const std::string& fname, std::unique_ptr<rocksdb::WritableFile>* result,
                          const rocksdb::EnvOptions& options) override {
+    // Encryption is done in Append, so file should not be written with aligned PositionedAppend
+    // used for direct I/O.
+    auto underlying_options = options;
+    underlying_options.use_direct_writes = false;
     std::unique_ptr<rocksdb::WritableFile> underlying;
-    RETURN_NOT_OK(RocksDBFileFactoryWrapper::NewWritableFile(fname, &underlying, options));
+    RETURN_NOT_OK(RocksDBFileFactoryWrapper::NewWritableFile(
+        fname, &underlying, underlying_options));
     return RocksDBEncryptedWritableFile::Create(
         result, header_manager_.get(), std::move(underlying));
   }
@@ -188,6 +188,10 @@ class Operation {
     return op_id_;
   }
 
+  const OperationCompletionCallback& completion_callback() const {
+    return completion_clbk_;
+  }
+
   bool has_completion_callback() const {
     return completion_clbk_ != nullptr;
   }
@@ -74,6 +74,19 @@ Status UpdateTxnOperation::DoReplicated(int64_t leader_term, Status* complete_st
   }
 }
 
+void UpdateTxnOperation::AddedAsPending() {
+  // Commit time of single tablet commit is the hybrid time of this operation, that becomes known
+  // only when operation is added to the leader. Store it in the log, so bootstrap and CDC see it
+  // in the same form as commit time of regular APPLYING records.
+  if (!request()->single_tablet_commit() || !consensus_round()) {
+    return;
+  }
+  auto& state = *consensus_round()->replicate_msg()->mutable_transaction_state();
+  if (!state.has_commit_hybrid_time()) {
+    state.set_commit_hybrid_time(hybrid_time().ToUint64());
+  }
+}
+
 Status UpdateTxnOperation::DoAborted(const Status& status) {
   if (tablet()->transaction_coordinator()) {
     LOG_WITH_PREFIX(INFO) << "Aborted: " << status;
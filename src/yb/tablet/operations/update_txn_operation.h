@@ -39,6 +39,7 @@ class UpdateTxnOperation
   CHECKED_STATUS Prepare() override;
   CHECKED_STATUS DoReplicated(int64_t leader_term, Status* complete_status) override;
   CHECKED_STATUS DoAborted(const Status& status) override;
+  void AddedAsPending() override;
 };
 
 } // namespace tablet
@@ -0,0 +1,74 @@
+// Copyright (c) YugaByte, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+// in compliance with the License.  You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied.  See the License for the specific language governing permissions and limitations
+// under the License.
+//
+
+#include <thread>
+
+#include "yb/tablet/resolved_transactions_cache.h"
+
+#include "yb/util/test_macros.h"
+#include "yb/util/test_util.h"
+
+using namespace std::literals;
+
+namespace yb {
+namespace tablet {
+
+class ResolvedTransactionsCacheTest : public YBTest {
+};
+
+TEST_F(ResolvedTransactionsCacheTest, Basic) {
+  ResolvedTransactionsCache cache(1000, 1h);
+  auto committed_id = TransactionId::GenerateRandom();
+  auto aborted_id = TransactionId::GenerateRandom();
+
+  ASSERT_FALSE(cache.Get(committed_id));
+
+  const auto commit_ht = HybridTime::FromMicros(1000);
+  cache.Committed(committed_id, commit_ht, AbortedSubTransactionSet());
+  cache.Aborted(aborted_id);
+
+  auto result = cache.Get(committed_id);
+  ASSERT_TRUE(result);
+  ASSERT_EQ(TransactionStatus::COMMITTED, result->status);
+  ASSERT_EQ(commit_ht, result->status_time);
+
+  result = cache.Get(aborted_id);
+  ASSERT_TRUE(result);
+  ASSERT_EQ(TransactionStatus::ABORTED, result->status);
+  ASSERT_EQ(2U, cache.TEST_Size());
+}
+
+TEST_F(ResolvedTransactionsCacheTest, Expiration) {
+  ResolvedTransactionsCache cache(1000, 100ms);
+  auto id = TransactionId::GenerateRandom();
+  cache.Aborted(id);
+  ASSERT_TRUE(cache.Get(id));
+  std::this_thread::sleep_for(200ms);
+  ASSERT_FALSE(cache.Get(id));
+  ASSERT_EQ(0U, cache.TEST_Size());
+}
+
+TEST_F(ResolvedTransactionsCacheTest, Eviction) {
+  // Single entry per shard, so the second transaction of the same shard evicts the first one.
+  ResolvedTransactionsCache cache(1, 1h);
+  std::vector<TransactionId> ids;
+  for (int i = 0; i != 100; ++i) {
+    ids.push_back(TransactionId::GenerateRandom());
+    cache.Aborted(ids.back());
+  }
+  ASSERT_LE(cache.TEST_Size(), 16U);
+  ASSERT_TRUE(cache.Get(ids.back()));
+}
+
+} // namespace tablet
+} // namespace yb
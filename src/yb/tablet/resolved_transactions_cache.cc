@@ -0,0 +1,154 @@
+// Copyright (c) YugaByte, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+// in compliance with the License.  You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied.  See the License for the specific language governing permissions and limitations
+// under the License.
+//
+
+#include "yb/tablet/resolved_transactions_cache.h"
+
+#include <mutex>
+
+#include <boost/multi_index/hashed_index.hpp>
+#include <boost/multi_index/member.hpp>
+#include <boost/multi_index/sequenced_index.hpp>
+#include <boost/multi_index_container.hpp>
+
+#include "yb/util/flag_tags.h"
+#include "yb/util/thread_annotations.h"
+
+using namespace std::literals;
+
+DEFINE_uint64(transaction_status_cache_capacity, 100000,
+              "Max number of final transaction statuses cached by tablet server, to be shared "
+              "by transaction participants of its tablets. 0 to disable the cache.");
+TAG_FLAG(transaction_status_cache_capacity, advanced);
+
+DEFINE_uint64(transaction_status_cache_ttl_ms, 60000,
+              "Time in milliseconds after which cached final transaction status expires.");
+TAG_FLAG(transaction_status_cache_ttl_ms, advanced);
+
+namespace yb {
+namespace tablet {
+
+class ResolvedTransactionsCache::Shard {
+ public:
+  explicit Shard(size_t capacity) : capacity_(capacity) {}
+
+  void Insert(const TransactionId& id, const TransactionStatusResult& result,
+              CoarseTimePoint expiration) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto& index = entries_.get<IdTag>();
+    auto it = index.find(id);
+    if (it != index.end()) {
+      index.replace(it, Entry { id, result, expiration });
+      entries_.relocate(entries_.end(), entries_.project<0>(it));
+      return;
+    }
+    entries_.push_back(Entry { id, result, expiration });
+    while (entries_.size() > capacity_) {
+      entries_.pop_front();
+    }
+  }
+
+  boost::optional<TransactionStatusResult> Get(const TransactionId& id, CoarseTimePoint now) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto& index = entries_.get<IdTag>();
+    auto it = index.find(id);
+    if (it == index.end()) {
+      return boost::none;
+    }
+    if (it->expiration <= now) {
+      index.erase(it);
+      return boost::none;
+    }
+    entries_.relocate(entries_.end(), entries_.project<0>(it));
+    return it->result;
+  }
+
+  size_t Size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return entries_.size();
+  }
+
+ private:
+  class IdTag;
+
+  struct Entry {
+    TransactionId id;
+    TransactionStatusResult result;
+    CoarseTimePoint expiration;
+  };
+
+  // Entries are ordered from the least recently used to the most recently used.
+  typedef boost::multi_index_container<
+      Entry,
+      boost::multi_index::indexed_by<
+          boost::multi_index::sequenced<>,
+          boost::multi_index::hashed_unique<
+              boost::multi_index::tag<IdTag>,
+              boost::multi_index::member<Entry, TransactionId, &Entry::id>,
+              TransactionIdHash>
+      >
+  > Entries;
+
+  const size_t capacity_;
+  mutable std::mutex mutex_;
+  Entries entries_ GUARDED_BY(mutex_);
+};
+
+ResolvedTransactionsCache::ResolvedTransactionsCache()
+    : ResolvedTransactionsCache(FLAGS_transaction_status_cache_capacity,
+                                1ms * FLAGS_transaction_status_cache_ttl_ms) {
+}
+
+ResolvedTransactionsCache::ResolvedTransactionsCache(size_t capacity, CoarseDuration ttl)
+    : ttl_(ttl) {
+  const size_t shard_capacity = (capacity + kNumShards - 1) / kNumShards;
+  for (auto& shard : shards_) {
+    shard = std::make_unique<Shard>(shard_capacity);
+  }
+}
+
+ResolvedTransactionsCache::~ResolvedTransactionsCache() {
+}
+
+void ResolvedTransactionsCache::Committed(
+    const TransactionId& id, HybridTime commit_ht,
+    const AbortedSubTransactionSet& aborted_subtxn_set) {
+  Insert(id, TransactionStatusResult(TransactionStatus::COMMITTED, commit_ht, aborted_subtxn_set));
+}
+
+void ResolvedTransactionsCache::Aborted(const TransactionId& id) {
+  Insert(id, TransactionStatusResult::Aborted());
+}
+
+boost::optional<TransactionStatusResult> ResolvedTransactionsCache::Get(const TransactionId& id) {
+  return ShardFor(id).Get(id, CoarseMonoClock::now());
+}
+
+size_t ResolvedTransactionsCache::TEST_Size() const {
+  size_t result = 0;
+  for (const auto& shard : shards_) {
+    result += shard->Size();
+  }
+  return result;
+}
+
+void ResolvedTransactionsCache::Insert(
+    const TransactionId& id, const TransactionStatusResult& result) {
+  ShardFor(id).Insert(id, result, CoarseMonoClock::now() + ttl_);
+}
+
+ResolvedTransactionsCache::Shard& ResolvedTransactionsCache::ShardFor(const TransactionId& id) {
+  return *shards_[TransactionIdHash()(id) % kNumShards];
+}
+
+} // namespace tablet
+} // namespace yb
@@ -0,0 +1,76 @@
+// Copyright (c) YugaByte, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+// in compliance with the License.  You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied.  See the License for the specific language governing permissions and limitations
+// under the License.
+//
+
+#ifndef YB_TABLET_RESOLVED_TRANSACTIONS_CACHE_H
+#define YB_TABLET_RESOLVED_TRANSACTIONS_CACHE_H
+
+#include <array>
+#include <memory>
+
+#include <boost/optional.hpp>
+
+#include "yb/common/transaction.h"
+
+#include "yb/util/monotime.h"
+
+namespace yb {
+namespace tablet {
+
+// Tablet server wide cache of final statuses of transactions, i.e. commit time for committed
+// transactions and the fact of abort for aborted ones.
+//
+// Transaction that wrote intents to several tablets of the same tablet server would otherwise be
+// resolved by the participant of each of those tablets independently, with a separate status
+// request to the transaction coordinator. Participants consult this cache before sending such
+// request, and populate it from coordinator responses and from applied transactions.
+//
+// Final status of transaction never changes, so cached entries are always valid. Entries are
+// evicted in LRU order when cache is full, and expire after transaction_status_cache_ttl_ms,
+// since by that time transaction is usually removed from all participants.
+class ResolvedTransactionsCache {
+ public:
+  // Capacity and TTL are taken from flags when not specified.
+  ResolvedTransactionsCache();
+  ResolvedTransactionsCache(size_t capacity, CoarseDuration ttl);
+  ~ResolvedTransactionsCache();
+
+  ResolvedTransactionsCache(const ResolvedTransactionsCache&) = delete;
+  void operator=(const ResolvedTransactionsCache&) = delete;
+
+  void Committed(const TransactionId& id, HybridTime commit_ht,
+                 const AbortedSubTransactionSet& aborted_subtxn_set);
+
+  void Aborted(const TransactionId& id);
+
+  // Returns COMMITTED status with commit time, ABORTED status, or none if status of transaction is
+  // not cached.
+  boost::optional<TransactionStatusResult> Get(const TransactionId& id);
+
+  size_t TEST_Size() const;
+
+ private:
+  class Shard;
+
+  void Insert(const TransactionId& id, const TransactionStatusResult& result);
+  Shard& ShardFor(const TransactionId& id);
+
+  static constexpr size_t kNumShards = 16;
+
+  const CoarseDuration ttl_;
+  std::array<std::unique_ptr<Shard>, kNumShards> shards_;
+};
+
+} // namespace tablet
+} // namespace yb
+
+#endif // YB_TABLET_RESOLVED_TRANSACTIONS_CACHE_H
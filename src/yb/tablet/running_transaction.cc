@@ -18,12 +18,15 @@
 #include "yb/common/hybrid_time.h"
 #include "yb/common/pgsql_error.h"
 
+#include "yb/tablet/resolved_transactions_cache.h"
 #include "yb/tablet/transaction_participant_context.h"
+#include "yb/tablet/transaction_status_batcher.h"
 
 #include "yb/tserver/tserver_service.pb.h"
 
 #include "yb/util/flag_tags.h"
 #include "yb/util/logging.h"
+#include "yb/util/status_format.h"
 #include "yb/util/trace.h"
 #include "yb/util/tsan_util.h"
 #include "yb/util/yb_pg_errcodes.h"
@@ -145,6 +148,11 @@ CHECKED_STATUS RunningTransaction::CheckAborted() const {
 void RunningTransaction::Abort(client::YBClient* client,
                                TransactionStatusCallback callback,
                                std::unique_lock<std::mutex>* lock) {
+  if (single_tablet_commit_pending_) {
+    lock->unlock();
+    callback(MakeSingleTabletCommitPendingStatus(id()));
+    return;
+  }
   if (last_known_status_ == TransactionStatus::ABORTED ||
       last_known_status_ == TransactionStatus::COMMITTED) {
     // Transaction is already in final state, so no reason to send abort request.
@@ -214,18 +222,32 @@ void RunningTransaction::SendStatusRequest(
     int64_t serial_no, const RunningTransactionPtr& shared_self) {
   TRACE_FUNC();
   VTRACE(1, yb::ToString(metadata_.transaction_id));
+  if (context_.resolved_transactions_cache_) {
+    // Final status could be already received by participant of another tablet of this server.
+    auto cached_status = context_.resolved_transactions_cache_->Get(id());
+    if (cached_status) {
+      VLOG_WITH_PREFIX(4) << "Use cached status: " << *cached_status;
+      tserver::GetTransactionStatusResponsePB response;
+      response.add_status(cached_status->status);
+      response.add_status_hybrid_time(cached_status->status_time.ToUint64());
+      cached_status->aborted_subtxn_set.ToPB(response.add_aborted_subtxn_set()->mutable_set());
+      DoStatusReceived(Status::OK(), response, serial_no, shared_self);
+      return;
+    }
+  }
   tserver::GetTransactionStatusRequestPB req;
   req.set_tablet_id(metadata_.status_tablet);
   req.add_transaction_id()->assign(
       pointer_cast<const char*>(metadata_.transaction_id.data()), metadata_.transaction_id.size());
   req.set_propagated_hybrid_time(context_.participant_context_.Now().ToUint64());
+  auto deadline = TransactionRpcDeadline();
+  auto* client = context_.participant_context_.client_future().get();
+  auto callback = std::bind(
+      &RunningTransaction::StatusReceived, this, _1, _2, serial_no, shared_self);
   context_.rpcs_.RegisterAndStart(
-      client::GetTransactionStatus(
-          TransactionRpcDeadline(),
-          nullptr /* tablet */,
-          context_.participant_context_.client_future().get(),
-          &req,
-          std::bind(&RunningTransaction::StatusReceived, this, _1, _2, serial_no, shared_self)),
+      context_.status_batcher_
+          ? context_.status_batcher_->GetTransactionStatus(deadline, client, &req, callback)
+          : client::GetTransactionStatus(deadline, nullptr /* tablet */, client, &req, callback),
       &get_status_handle_);
 }
 
@@ -250,7 +272,9 @@ bool RunningTransaction::UpdateStatus(
     HybridTime coordinator_safe_time, AbortedSubTransactionSet aborted_subtxn_set) {
   // Check for local_commit_time_ is not required for correctness, but useful for optimization.
   // So we could avoid unnecessary actions.
-  if (local_commit_time_) {
+  // But the status tablet does not know about single tablet commit, so while it is pending
+  // received status should be ignored.
+  if (local_commit_time_ || single_tablet_commit_pending_) {
     return false;
   }
 
@@ -330,6 +354,17 @@ void RunningTransaction::DoStatusReceived(const Status& status,
         << response.ShortDebugString();
     auto coordinator_safe_time = response.coordinator_safe_time().size() == 1
         ? HybridTime::FromPB(response.coordinator_safe_time(0)) : HybridTime();
+    // Coordinator does not know about pending single tablet commit, so its response should not
+    // be shared. Aborted status of transaction unknown to coordinator is also not shared, since
+    // it is only known relative to coordinator safe time.
+    if (context_.resolved_transactions_cache_ && !single_tablet_commit_pending_) {
+      if (transaction_status == TransactionStatus::COMMITTED) {
+        context_.resolved_transactions_cache_->Committed(
+            id(), time_of_status, aborted_subtxn_set);
+      } else if (transaction_status == TransactionStatus::ABORTED && !coordinator_safe_time) {
+        context_.resolved_transactions_cache_->Aborted(id());
+      }
+    }
     auto did_abort_txn = UpdateStatus(
         transaction_status, time_of_status, coordinator_safe_time, aborted_subtxn_set);
     if (did_abort_txn) {
@@ -439,6 +474,12 @@ void RunningTransaction::AbortReceived(const Status& status,
     std::lock_guard<std::mutex> lock(context_.mutex_);
     context_.rpcs_.Unregister(&abort_handle_);
     abort_waiters_.swap(abort_waiters);
+    if (result.ok() && result->status == TransactionStatus::ABORTED &&
+        (single_tablet_commit_pending_ || local_commit_time_)) {
+      // Transaction was committed by this tablet while abort request was in flight, so status
+      // tablet reply does not reflect actual transaction state.
+      result = MakeSingleTabletCommitPendingStatus(id());
+    }
     // kMax status_time means that this status is not yet replicated and could be rejected.
     // So we could use it as reply to Abort, but cannot store it as transaction status.
     if (result.ok() && result->status_time != HybridTime::kMax) {
@@ -465,6 +506,10 @@ Status MakeAbortedStatus(const TransactionId& id) {
       PgsqlError(YBPgErrorCode::YB_PG_T_R_SERIALIZATION_FAILURE));
 }
 
+Status MakeSingleTabletCommitPendingStatus(const TransactionId& id) {
+  return STATUS_FORMAT(TryAgain, "Transaction is being committed by its tablet: $0", id);
+}
+
 void RunningTransaction::SetApplyData(const docdb::ApplyTransactionState& apply_state,
                                       const TransactionApplyData* data,
                                       ScopedRWOperation* operation) {
@@ -87,6 +87,28 @@ class RunningTransaction : public std::enable_shared_from_this<RunningTransactio
   }
 
   void SetLocalCommitData(HybridTime time, const AbortedSubTransactionSet& aborted_subtxn_set);
+
+  // Id of operation that applied all intents of this transaction at once, empty if transaction
+  // was not applied or was applied in several steps.
+  const OpId& apply_op_id() const {
+    return apply_op_id_;
+  }
+
+  void SetApplyOpId(const OpId& op_id) {
+    apply_op_id_ = op_id;
+  }
+
+  // Single tablet commit of this transaction was submitted, but not yet completed.
+  // While it is pending, abort decisions of the status tablet should not be applied to this
+  // transaction, since it could be already committed locally.
+  bool single_tablet_commit_pending() const {
+    return single_tablet_commit_pending_;
+  }
+
+  void SetSingleTabletCommitPending(bool value) {
+    single_tablet_commit_pending_ = value;
+  }
+
   void AddReplicatedBatch(
       size_t batch_idx, boost::container::small_vector_base<uint8_t>* encoded_replicated_batches);
   void BatchReplicated(const TransactionalBatchData& value);
@@ -157,7 +179,9 @@ class RunningTransaction : public std::enable_shared_from_this<RunningTransactio
   RunningTransactionContext& context_;
   RemoveIntentsTask remove_intents_task_;
   HybridTime local_commit_time_ = HybridTime::kInvalid;
+  bool single_tablet_commit_pending_ = false;
   AbortedSubTransactionSet local_commit_aborted_subtxn_set_;
+  OpId apply_op_id_;
 
   TransactionStatus last_known_status_ = TransactionStatus::CREATED;
   HybridTime last_known_status_hybrid_time_ = HybridTime::kMin;
@@ -178,6 +202,9 @@ class RunningTransaction : public std::enable_shared_from_this<RunningTransactio
 
 CHECKED_STATUS MakeAbortedStatus(const TransactionId& id);
 
+// Status returned to aborters of transaction, whose single tablet commit is in progress.
+CHECKED_STATUS MakeSingleTabletCommitPendingStatus(const TransactionId& id);
+
 } // namespace tablet
 } // namespace yb
 
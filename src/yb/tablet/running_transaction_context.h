@@ -66,8 +66,12 @@ YB_DEFINE_ENUM(RemoveReason,
 class RunningTransactionContext {
  public:
   RunningTransactionContext(TransactionParticipantContext* participant_context,
-                            TransactionIntentApplier* applier)
-      : participant_context_(*participant_context), applier_(*applier) {
+                            TransactionIntentApplier* applier,
+                            ResolvedTransactionsCache* resolved_transactions_cache,
+                            TransactionStatusBatcher* status_batcher)
+      : participant_context_(*participant_context), applier_(*applier),
+        resolved_transactions_cache_(resolved_transactions_cache),
+        status_batcher_(status_batcher) {
   }
 
   virtual ~RunningTransactionContext() {}
@@ -96,6 +100,10 @@ class RunningTransactionContext {
   rpc::Rpcs rpcs_;
   TransactionParticipantContext& participant_context_;
   TransactionIntentApplier& applier_;
+  // Could be null.
+  ResolvedTransactionsCache* const resolved_transactions_cache_;
+  // Could be null.
+  TransactionStatusBatcher* const status_batcher_;
   int64_t request_serial_ = 0;
   std::mutex mutex_;
 
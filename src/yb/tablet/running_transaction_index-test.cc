@@ -0,0 +1,163 @@
+// Copyright (c) YugaByte, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+// in compliance with the License.  You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied.  See the License for the specific language governing permissions and limitations
+// under the License.
+//
+
+#include <atomic>
+#include <vector>
+
+#include "yb/tablet/running_transaction_index.h"
+
+#include "yb/util/random_util.h"
+#include "yb/util/test_macros.h"
+#include "yb/util/test_thread_holder.h"
+#include "yb/util/test_util.h"
+
+using namespace std::literals;
+
+namespace yb {
+namespace tablet {
+
+namespace {
+
+// Index guarded by a single mutex, i.e. the way participant looked up transactions before
+// RunningTransactionIndex. Used as a baseline for the benchmark.
+class SingleMutexIndex {
+ public:
+  void Add(const TransactionId& id) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    transactions_.emplace(id, CommitMetadata{ .commit_ht = HybridTime::kInvalid });
+  }
+
+  void Remove(const TransactionId& id) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    transactions_.erase(id);
+  }
+
+  void SetLocalCommitData(
+      const TransactionId& id, HybridTime commit_ht,
+      const AbortedSubTransactionSet& aborted_subtxn_set) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = transactions_.find(id);
+    if (it != transactions_.end()) {
+      it->second = CommitMetadata{ commit_ht, aborted_subtxn_set };
+    }
+  }
+
+  HybridTime LocalCommitTime(const TransactionId& id) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = transactions_.find(id);
+    return it != transactions_.end() ? it->second.commit_ht : HybridTime::kInvalid;
+  }
+
+ private:
+  mutable std::mutex mutex_;
+  std::unordered_map<TransactionId, CommitMetadata, TransactionIdHash> transactions_;
+};
+
+// Emulates participant workload: each transaction is added once, looked up by several writes and
+// reads, then committed and removed. Returns number of operations per second.
+template <class Index>
+double RunWorkload(size_t num_threads, size_t num_transactions, CoarseDuration duration) {
+  Index index;
+  std::vector<TransactionId> ids;
+  ids.reserve(num_transactions);
+  for (size_t i = 0; i != num_transactions; ++i) {
+    ids.push_back(TransactionId::GenerateRandom());
+    index.Add(ids.back());
+  }
+
+  constexpr size_t kLookupsPerTransaction = 8;
+  std::atomic<size_t> num_ops{0};
+  TestThreadHolder thread_holder;
+  for (size_t thread_idx = 0; thread_idx != num_threads; ++thread_idx) {
+    thread_holder.AddThreadFunctor(
+        [&index, &ids, &num_ops, &stop = thread_holder.stop_flag(), thread_idx, num_threads] {
+      size_t ops = 0;
+      // Each thread processes its own slice of transactions.
+      for (size_t i = thread_idx % ids.size(); !stop.load(std::memory_order_acquire);) {
+        const auto& id = ids[i];
+        for (size_t lookup = 0; lookup != kLookupsPerTransaction; ++lookup) {
+          const auto& other_id = ids[RandomUniformInt<size_t>(0, ids.size() - 1)];
+          if (index.LocalCommitTime(other_id).is_valid()) {
+            ++ops;
+          }
+          ++ops;
+        }
+        index.SetLocalCommitData(id, HybridTime::FromMicros(ops), AbortedSubTransactionSet());
+        index.Remove(id);
+        index.Add(id);
+        ops += 3;
+        i += num_threads;
+        if (i >= ids.size()) {
+          i = thread_idx % ids.size();
+        }
+      }
+      num_ops.fetch_add(ops, std::memory_order_acq_rel);
+    });
+  }
+  thread_holder.WaitAndStop(duration);
+  return num_ops.load(std::memory_order_acquire) / ToSeconds(duration);
+}
+
+} // namespace
+
+class RunningTransactionIndexTest : public YBTest {
+};
+
+TEST_F(RunningTransactionIndexTest, Basic) {
+  RunningTransactionIndex index;
+  auto id1 = TransactionId::GenerateRandom();
+  auto id2 = TransactionId::GenerateRandom();
+
+  ASSERT_FALSE(index.Contains(id1));
+  ASSERT_FALSE(index.LocalCommitData(id1));
+
+  index.Add(id1);
+  index.Add(id2);
+  ASSERT_TRUE(index.Contains(id1));
+  ASSERT_FALSE(index.LocalCommitTime(id1).is_valid());
+  auto commit_data = index.LocalCommitData(id1);
+  ASSERT_TRUE(commit_data);
+  ASSERT_FALSE(commit_data->commit_ht.is_valid());
+
+  const auto commit_ht = HybridTime::FromMicros(1000);
+  index.SetLocalCommitData(id1, commit_ht, AbortedSubTransactionSet());
+  ASSERT_EQ(commit_ht, index.LocalCommitTime(id1));
+  ASSERT_FALSE(index.LocalCommitTime(id2).is_valid());
+
+  index.Remove(id1);
+  ASSERT_FALSE(index.Contains(id1));
+  ASSERT_FALSE(index.LocalCommitTime(id1).is_valid());
+  // Commit data of unknown transaction is ignored.
+  index.SetLocalCommitData(id1, commit_ht, AbortedSubTransactionSet());
+  ASSERT_FALSE(index.Contains(id1));
+
+  index.Clear();
+  ASSERT_FALSE(index.Contains(id2));
+}
+
+// Compares throughput of add/lookup/apply operations for sharded index and the single mutex
+// baseline, for different numbers of concurrent transactions.
+TEST_F(RunningTransactionIndexTest, Benchmark) {
+  const auto kDuration = AllowSlowTests() ? 5s : 1s;
+  constexpr size_t kNumThreads = 8;
+  for (size_t num_transactions : {64, 1024, 16384}) {
+    auto sharded = RunWorkload<RunningTransactionIndex>(kNumThreads, num_transactions, kDuration);
+    auto baseline = RunWorkload<SingleMutexIndex>(kNumThreads, num_transactions, kDuration);
+    LOG(INFO) << "Threads: " << kNumThreads << ", transactions: " << num_transactions
+              << ", sharded: " << sharded << " ops/s, single mutex: " << baseline
+              << " ops/s, speedup: " << sharded / baseline;
+  }
+}
+
+} // namespace tablet
+} // namespace yb
@@ -0,0 +1,87 @@
+// Copyright (c) YugaByte, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+// in compliance with the License.  You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied.  See the License for the specific language governing permissions and limitations
+// under the License.
+//
+
+#include "yb/tablet/running_transaction_index.h"
+
+namespace yb {
+namespace tablet {
+
+constexpr size_t RunningTransactionIndex::kNumShards;
+
+void RunningTransactionIndex::Add(const TransactionId& id) {
+  auto& shard = ShardFor(id);
+  std::lock_guard<std::mutex> lock(shard.mutex);
+  shard.transactions.emplace(id, CommitMetadata{ .commit_ht = HybridTime::kInvalid });
+}
+
+void RunningTransactionIndex::Remove(const TransactionId& id) {
+  auto& shard = ShardFor(id);
+  std::lock_guard<std::mutex> lock(shard.mutex);
+  shard.transactions.erase(id);
+}
+
+void RunningTransactionIndex::Clear() {
+  for (auto& shard : shards_) {
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    shard.transactions.clear();
+  }
+}
+
+void RunningTransactionIndex::SetLocalCommitData(
+    const TransactionId& id, HybridTime commit_ht,
+    const AbortedSubTransactionSet& aborted_subtxn_set) {
+  auto& shard = ShardFor(id);
+  std::lock_guard<std::mutex> lock(shard.mutex);
+  auto it = shard.transactions.find(id);
+  if (it == shard.transactions.end()) {
+    return;
+  }
+  it->second.commit_ht = commit_ht;
+  it->second.aborted_subtxn_set = aborted_subtxn_set;
+}
+
+bool RunningTransactionIndex::Contains(const TransactionId& id) const {
+  const auto& shard = ShardFor(id);
+  std::lock_guard<std::mutex> lock(shard.mutex);
+  return shard.transactions.count(id) != 0;
+}
+
+HybridTime RunningTransactionIndex::LocalCommitTime(const TransactionId& id) const {
+  const auto& shard = ShardFor(id);
+  std::lock_guard<std::mutex> lock(shard.mutex);
+  auto it = shard.transactions.find(id);
+  return it != shard.transactions.end() ? it->second.commit_ht : HybridTime::kInvalid;
+}
+
+boost::optional<CommitMetadata> RunningTransactionIndex::LocalCommitData(
+    const TransactionId& id) const {
+  const auto& shard = ShardFor(id);
+  std::lock_guard<std::mutex> lock(shard.mutex);
+  auto it = shard.transactions.find(id);
+  if (it == shard.transactions.end()) {
+    return boost::none;
+  }
+  return it->second;
+}
+
+RunningTransactionIndex::Shard& RunningTransactionIndex::ShardFor(const TransactionId& id) {
+  return shards_[TransactionIdHash()(id) % kNumShards];
+}
+
+const RunningTransactionIndex::Shard& RunningTransactionIndex::ShardFor(
+    const TransactionId& id) const {
+  return shards_[TransactionIdHash()(id) % kNumShards];
+}
+
+} // namespace tablet
+} // namespace yb
@@ -0,0 +1,83 @@
+// Copyright (c) YugaByte, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+// in compliance with the License.  You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied.  See the License for the specific language governing permissions and limitations
+// under the License.
+//
+
+#ifndef YB_TABLET_RUNNING_TRANSACTION_INDEX_H
+#define YB_TABLET_RUNNING_TRANSACTION_INDEX_H
+
+#include <array>
+#include <mutex>
+#include <unordered_map>
+
+#include <boost/optional.hpp>
+
+#include "yb/common/transaction.h"
+
+#include "yb/util/thread_annotations.h"
+
+namespace yb {
+namespace tablet {
+
+// Lock striped index of transactions running at the transaction participant.
+//
+// Participant keeps its transactions in a container with several ordered indexes, guarded by
+// a single mutex. This index mirrors ids and local commit data of those transactions, so hot
+// lookups from the read and write paths, that do not need the ordered indexes, take only the
+// lock of a single shard instead of the participant mutex.
+//
+// All modifications are performed by the participant while it holds its own mutex, so the index
+// always reflects the same set of transactions as the participant container.
+class RunningTransactionIndex {
+ public:
+  static constexpr size_t kNumShards = 32;
+
+  RunningTransactionIndex() = default;
+  RunningTransactionIndex(const RunningTransactionIndex&) = delete;
+  void operator=(const RunningTransactionIndex&) = delete;
+
+  void Add(const TransactionId& id);
+
+  void Remove(const TransactionId& id);
+
+  void Clear();
+
+  // Updates local commit data of transaction, does nothing if transaction is not present.
+  void SetLocalCommitData(
+      const TransactionId& id, HybridTime commit_ht,
+      const AbortedSubTransactionSet& aborted_subtxn_set);
+
+  bool Contains(const TransactionId& id) const;
+
+  // Returns invalid hybrid time if transaction is not present or was not committed locally.
+  HybridTime LocalCommitTime(const TransactionId& id) const;
+
+  // Returns none if transaction is not present. Otherwise returns its local commit data, with
+  // invalid commit time if transaction was not committed locally yet.
+  boost::optional<CommitMetadata> LocalCommitData(const TransactionId& id) const;
+
+ private:
+  struct Shard {
+    mutable std::mutex mutex;
+    std::unordered_map<TransactionId, CommitMetadata, TransactionIdHash> transactions
+        GUARDED_BY(mutex);
+  };
+
+  Shard& ShardFor(const TransactionId& id);
+  const Shard& ShardFor(const TransactionId& id) const;
+
+  std::array<Shard, kNumShards> shards_;
+};
+
+} // namespace tablet
+} // namespace yb
+
+#endif // YB_TABLET_RUNNING_TRANSACTION_INDEX_H
@@ -61,18 +61,23 @@
 #include "yb/docdb/cql_operation.h"
 #include "yb/docdb/doc_rowwise_iterator.h"
 #include "yb/docdb/doc_write_batch.h"
+#include "yb/docdb/docdb-internal.h"
 #include "yb/docdb/docdb.h"
 #include "yb/docdb/docdb_compaction_filter.h"
 #include "yb/docdb/docdb_compaction_filter_intents.h"
 #include "yb/docdb/docdb_debug.h"
 #include "yb/docdb/docdb_rocksdb_util.h"
+#include "yb/docdb/intent.h"
 #include "yb/docdb/pgsql_operation.h"
 #include "yb/docdb/ql_rocksdb_storage.h"
 #include "yb/docdb/redis_operation.h"
+#include "yb/docdb/value_type.h"
 
 #include "yb/gutil/casts.h"
 
+#include "yb/rocksdb/db/filename.h"
 #include "yb/rocksdb/db/memtable.h"
+#include "yb/rocksdb/sst_file_writer.h"
 #include "yb/rocksdb/utilities/checkpoint.h"
 
 #include "yb/rocksutil/yb_rocksdb.h"
@@ -106,6 +111,7 @@
 #include "yb/util/mem_tracker.h"
 #include "yb/util/metrics.h"
 #include "yb/util/net/net_util.h"
+#include "yb/util/path_util.h"
 #include "yb/util/pg_util.h"
 #include "yb/util/scope_exit.h"
 #include "yb/util/status_format.h"
@@ -149,6 +155,12 @@ DEFINE_int32(intents_flush_max_delay_ms, 2000,
              "Max time to wait for regular db to flush during flush of intents. "
              "After this time flush of regular db will be forced.");
 
+DEFINE_bool(intents_flush_skip_resolved_transactions, false,
+            "Omit records of aborted transactions, and transactions applied by operations already "
+            "flushed to regular DB, when flushing intents DB.");
+TAG_FLAG(intents_flush_skip_resolved_transactions, advanced);
+TAG_FLAG(intents_flush_skip_resolved_transactions, runtime);
+
 DEFINE_int32(num_raft_ops_to_force_idle_intents_db_to_flush, 1000,
              "When writes to intents RocksDB are stopped and the number of Raft operations after "
              "the last write to the intents RocksDB "
@@ -218,7 +230,8 @@ DEFINE_test_flag(int32, backfill_drop_frequency, 0,
 
 DEFINE_bool(tablet_enable_ttl_file_filter, false,
             "Enables compaction to directly delete files that have expired based on TTL, "
-            "rather than removing them via the normal compaction process.");
+            "rather than removing them via the normal compaction process. Also required for "
+            "time-window compaction of tables with compaction_time_window_ms set.");
 
 DEFINE_test_flag(int32, slowdown_backfill_by_ms, 0,
                  "If set > 0, slows down the backfill process by this amount.");
@@ -261,6 +274,16 @@ DECLARE_string(regular_tablets_data_block_key_value_encoding);
 DEFINE_test_flag(uint64, inject_sleep_before_applying_intents_ms, 0,
                  "Sleep before applying intents to docdb after transaction commit");
 
+DEFINE_int32(txn_apply_ingest_min_records, 0,
+             "Min number of records in batch of applied transaction intents, starting from which "
+             "batch is written to a separate SST file that is ingested into regular DB, instead "
+             "of writing it through the memtable. 0 to disable. Batch is ingested only when its "
+             "key range does not overlap existing records, so it is useful mostly for loading "
+             "data into a new table or key range. Each ingestion writes the MANIFEST, so "
+             "small values are not recommended.");
+TAG_FLAG(txn_apply_ingest_min_records, advanced);
+TAG_FLAG(txn_apply_ingest_min_records, runtime);
+
 using namespace std::placeholders;
 
 using std::shared_ptr;
@@ -312,6 +335,29 @@ using docdb::StorageDbType;
 
 namespace {
 
+// Name of temporary SST file used for ingestion of applied intents, see IngestApplyBatch.
+constexpr char kApplyIngestFilePrefix[] = "apply-";
+constexpr char kApplyIngestFileSuffix[] = ".sst.tmp";
+
+// Temporary files are moved into DB on successful ingestion and removed on failure, so they could
+// be left only by a crash during ingestion.
+void DeleteApplyIngestLeftovers(Env* env, const std::string& db_dir) {
+  auto children = env->GetChildren(db_dir, ExcludeDots::kTrue);
+  if (!children.ok()) {
+    LOG(WARNING) << "Failed to list " << db_dir << ": " << children.status();
+    return;
+  }
+  for (const auto& child : *children) {
+    // Split SST has data file with additional suffix.
+    if (Slice(child).starts_with(kApplyIngestFilePrefix) &&
+        child.find(kApplyIngestFileSuffix) != std::string::npos) {
+      auto path = JoinPathSegments(db_dir, child);
+      LOG(INFO) << "Deleting leftover of applied intents ingestion: " << path;
+      WARN_NOT_OK(env->DeleteFile(path), "Failed to delete " + path);
+    }
+  }
+}
+
 std::string MakeTabletLogPrefix(
     const TabletId& tablet_id, const std::string& log_prefix_suffix) {
   return Format("T $0$1: ", tablet_id, log_prefix_suffix);
@@ -426,7 +472,9 @@ Tablet::Tablet(const TabletInitData& data)
       data.transaction_participant_context &&
       (is_sys_catalog_ || transactional)) {
     transaction_participant_ = std::make_unique<TransactionParticipant>(
-        data.transaction_participant_context, this, tablet_metrics_entity_);
+        data.transaction_participant_context, this, tablet_metrics_entity_,
+        tablet_options_.resolved_transactions_cache.get(),
+        tablet_options_.transaction_status_batcher.get());
     // Create transaction manager for secondary index update.
     if (has_index) {
       transaction_manager_ = std::make_unique<client::TransactionManager>(
@@ -547,6 +595,15 @@ auto MakeMemTableFlushFilterFactory(const F& f) {
   return std::make_shared<MemTableFlushFilterFactoryType>(f);
 }
 
+template <class F>
+auto MakeFlushRecordFilterFactory(const F& f) {
+  // Trick to get type of flush_record_filter_factory field.
+  typedef typename decltype(
+      static_cast<rocksdb::Options*>(nullptr)->flush_record_filter_factory)::element_type
+      FlushRecordFilterFactoryType;
+  return std::make_shared<FlushRecordFilterFactoryType>(f);
+}
+
 template <class F>
 auto MakeMaxFileSizeWithTableTTLFunction(const F& f) {
   // Trick to get type of max_file_size_for_compaction field.
@@ -603,6 +660,53 @@ Result<bool> Tablet::IntentsDbFlushFilter(const rocksdb::MemTable& memtable) {
   return false;
 }
 
+rocksdb::FlushRecordFilter Tablet::IntentsDbFlushRecordFilter() {
+  if (!GetAtomicFlag(&FLAGS_intents_flush_skip_resolved_transactions)) {
+    return rocksdb::FlushRecordFilter();
+  }
+
+  // Intents of transaction applied by operation that is not yet flushed to regular DB are still
+  // required, since bootstrap would replay such operation.
+  auto regular_flushed_op_id = OpId::Min();
+  auto regular_flushed_frontier = regular_db_->GetFlushedFrontier();
+  if (regular_flushed_frontier) {
+    regular_flushed_op_id =
+        down_cast<const docdb::ConsensusFrontier&>(*regular_flushed_frontier).op_id();
+  }
+  VLOG_WITH_PREFIX(4) << __func__ << ", regular flushed op id: " << regular_flushed_op_id;
+
+  // Flushed memtable usually contains several records of the same transaction, so decision is
+  // cached per transaction.
+  auto obsolete = std::make_shared<std::unordered_map<TransactionId, bool, TransactionIdHash>>();
+  return [this, regular_flushed_op_id, obsolete](
+      const Slice& key, const Slice& value) -> Result<bool> {
+    Slice transaction_id_slice;
+    switch (docdb::GetKeyType(key, docdb::StorageDbType::kIntents)) {
+      case docdb::KeyType::kTransactionMetadata: FALLTHROUGH_INTENDED;
+      case docdb::KeyType::kReverseTxnKey:
+        transaction_id_slice = key;
+        break;
+      case docdb::KeyType::kIntentKey:
+        transaction_id_slice = value;
+        break;
+      default:
+        return true;
+    }
+    if (!transaction_id_slice.starts_with(docdb::ValueTypeAsChar::kTransactionId)) {
+      return true;
+    }
+    auto transaction_id = VERIFY_RESULT(
+        docdb::DecodeTransactionIdFromIntentValue(&transaction_id_slice));
+    auto it = obsolete->find(transaction_id);
+    if (it == obsolete->end()) {
+      it = obsolete->emplace(
+          transaction_id,
+          transaction_participant_->IntentsObsolete(transaction_id, regular_flushed_op_id)).first;
+    }
+    return !it->second;
+  };
+}
+
 std::string Tablet::LogPrefix() const {
   return MakeTabletLogPrefix(tablet_id(), log_prefix_suffix_);
 }
@@ -696,6 +800,7 @@ Status Tablet::OpenKeyValueTablet() {
 
   const string db_dir = metadata()->rocksdb_dir();
   RETURN_NOT_OK(CreateTabletDirectories(db_dir, metadata()->fs_manager()));
+  DeleteApplyIngestLeftovers(metadata()->fs_manager()->env(), db_dir);
 
   LOG(INFO) << "Opening RocksDB at: " << db_dir;
   rocksdb::DB* db = nullptr;
@@ -719,6 +824,9 @@ Status Tablet::OpenKeyValueTablet() {
     intents_rocksdb_options.mem_table_flush_filter_factory = MakeMemTableFlushFilterFactory([this] {
       return std::bind(&Tablet::IntentsDbFlushFilter, this, _1);
     });
+    intents_rocksdb_options.flush_record_filter_factory = MakeFlushRecordFilterFactory([this] {
+      return IntentsDbFlushRecordFilter();
+    });
 
     intents_rocksdb_options.compaction_filter_factory =
         FLAGS_tablet_do_compaction_cleanup_for_intents ?
@@ -1686,10 +1794,113 @@ Result<docdb::ApplyTransactionState> Tablet::ApplyIntents(const TransactionApply
   // We don't set transaction field of put_batch, otherwise we would write another bunch of intents.
   docdb::ConsensusFrontiers frontiers;
   auto frontiers_ptr = data.op_id.empty() ? nullptr : InitFrontiers(data, &frontiers);
+
+  const auto ingest_min_records = GetAtomicFlag(&FLAGS_txn_apply_ingest_min_records);
+  if (ingest_min_records > 0 &&
+      regular_write_batch.Count() >= implicit_cast<uint32_t>(ingest_min_records)) {
+    rocksdb::WriteBatch remaining_write_batch;
+    auto ingested = IngestApplyBatch(
+        data.transaction_id, frontiers_ptr, regular_write_batch, &remaining_write_batch);
+    if (!ingested.ok()) {
+      LOG_WITH_PREFIX(WARNING) << "Failed to ingest applied intents of " << data.transaction_id
+                               << ": " << ingested.status();
+    } else if (*ingested) {
+      regular_write_batch = std::move(remaining_write_batch);
+      metrics_->transaction_apply_ingested_files->Increment();
+    } else {
+      VLOG_WITH_PREFIX(2) << "Ingestion of " << data.transaction_id << " is not possible, "
+                          << "writing " << regular_write_batch.Count() << " records";
+    }
+  }
+
   WriteToRocksDB(frontiers_ptr, &regular_write_batch, StorageDbType::kRegular);
   return new_apply_state;
 }
 
+namespace {
+
+// Splits batch of applied intents into records that could be ingested into regular DB, and
+// records that should be written through the memtable.
+class ApplyBatchSplitter : public rocksdb::WriteBatch::Handler {
+ public:
+  explicit ApplyBatchSplitter(rocksdb::WriteBatch* remaining_batch)
+      : remaining_batch_(*remaining_batch) {}
+
+  void Put(const Slice& key, const Slice& value) override {
+    // Apply state of large transaction is overwritten by the next batch of the same transaction,
+    // so it should go through the memtable.
+    if (!key.empty() && key[0] == docdb::ValueTypeAsChar::kTransactionApplyState) {
+      remaining_batch_.Put(key, value);
+      return;
+    }
+    records_.emplace_back(key, value);
+  }
+
+  std::vector<std::pair<Slice, Slice>>& records() {
+    return records_;
+  }
+
+ private:
+  rocksdb::WriteBatch& remaining_batch_;
+  std::vector<std::pair<Slice, Slice>> records_;
+};
+
+} // namespace
+
+Result<bool> Tablet::IngestApplyBatch(
+    const TransactionId& transaction_id, const rocksdb::UserFrontiers* frontiers,
+    const rocksdb::WriteBatch& batch, rocksdb::WriteBatch* remaining_batch) {
+  if (batch.HasDelete() || batch.HasSingleDelete() || batch.HasMerge()) {
+    return false;
+  }
+
+  ApplyBatchSplitter splitter(remaining_batch);
+  RETURN_NOT_OK(batch.Iterate(&splitter));
+  auto& records = splitter.records();
+  if (records.empty()) {
+    return false;
+  }
+
+  const auto& options = regular_db_->GetOptions();
+  const auto* comparator = options.comparator;
+  std::sort(records.begin(), records.end(), [comparator](const auto& lhs, const auto& rhs) {
+    return comparator->Compare(lhs.first, rhs.first) < 0;
+  });
+
+  const auto file_path = JoinPathSegments(
+      metadata()->rocksdb_dir(),
+      Format("$0$1$2", kApplyIngestFilePrefix, transaction_id, kApplyIngestFileSuffix));
+  rocksdb::ImmutableCFOptions ioptions(options);
+  rocksdb::SstFileWriter writer(rocksdb::EnvOptions(), ioptions, comparator);
+  RETURN_NOT_OK(writer.Open(file_path));
+  auto se = ScopeExit([&options, &file_path] {
+    // File is moved into DB on successful ingestion, so we have to remove leftovers only.
+    for (const auto& path : {file_path, rocksdb::TableBaseToDataFileName(file_path)}) {
+      if (options.env->FileExists(path).ok()) {
+        WARN_NOT_OK(options.env->DeleteFile(path), "Failed to delete " + path);
+      }
+    }
+  });
+  for (const auto& record : records) {
+    RETURN_NOT_OK(writer.Add(record.first, record.second));
+  }
+  rocksdb::ExternalSstFileInfo file_info;
+  RETURN_NOT_OK(writer.Finish(&file_info));
+  // Ingested file should have frontiers, the same way as files created by flush.
+  file_info.frontiers = frontiers;
+
+  // Ingestion fails with NotSupported when key range of the file overlaps existing records,
+  // caller falls back to regular write in this case.
+  auto status = regular_db_->AddFile(&file_info, true /* move_file */);
+  if (status.IsNotSupported()) {
+    return false;
+  }
+  RETURN_NOT_OK(status);
+
+  VLOG_WITH_PREFIX(2) << "Ingested " << records.size() << " records of " << transaction_id;
+  return true;
+}
+
 template <class Ids>
 CHECKED_STATUS Tablet::RemoveIntentsImpl(const RemoveIntentsData& data, const Ids& ids) {
   auto scoped_read_operation = CreateNonAbortableScopedRWOperation();
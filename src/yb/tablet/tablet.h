@@ -925,9 +925,23 @@ class Tablet : public AbstractTablet, public TransactionIntentApplier {
 
   Result<bool> IntentsDbFlushFilter(const rocksdb::MemTable& memtable);
 
+  // Filter for records of intents DB flush, that omits records of transactions whose intents
+  // are not required anymore. See intents_flush_skip_resolved_transactions.
+  rocksdb::FlushRecordFilter IntentsDbFlushRecordFilter();
+
   template <class Ids>
   CHECKED_STATUS RemoveIntentsImpl(const RemoveIntentsData& data, const Ids& ids);
 
+  // Writes records of applied intents batch to SST file and ingests it into regular DB,
+  // records that could not be ingested are added to remaining_batch. Ingested file gets the
+  // specified frontiers.
+  // Returns false if ingestion is not possible, for instance because the key range of batch
+  // overlaps existing records. Each batch is ingested separately, so it happens for almost any
+  // batch that writes into key range with existing data.
+  Result<bool> IngestApplyBatch(
+      const TransactionId& transaction_id, const rocksdb::UserFrontiers* frontiers,
+      const rocksdb::WriteBatch& batch, rocksdb::WriteBatch* remaining_batch);
+
   // Tries to find intent .SST files that could be deleted and remove them.
   void CleanupIntentFiles();
   void DoCleanupIntentFiles();
@@ -46,6 +46,7 @@ typedef std::shared_ptr<TabletPeer> TabletPeerPtr;
 class ChangeMetadataOperation;
 class Operation;
 class OperationFilter;
+class ResolvedTransactionsCache;
 class SnapshotCoordinator;
 class SnapshotOperation;
 class SplitOperation;
@@ -58,6 +59,7 @@ class TransactionCoordinatorContext;
 class TransactionParticipant;
 class TransactionParticipantContext;
 class TransactionStatePB;
+class TransactionStatusBatcher;
 class TruncateOperation;
 class TruncatePB;
 class UpdateTxnOperation;
@@ -130,6 +130,11 @@ METRIC_DEFINE_counter(tablet, tablet_data_corruptions,
   yb::MetricUnit::kUnits,
   "Number of times this tablet was flagged for corrupted data");
 
+METRIC_DEFINE_counter(tablet, transaction_apply_ingested_files,
+  "Ingested Files of Applied Transactions",
+  yb::MetricUnit::kUnits,
+  "Number of batches of applied transaction intents ingested into regular DB as SST files.");
+
 using strings::Substitute;
 
 namespace yb {
@@ -152,6 +157,7 @@ TabletMetrics::TabletMetrics(const scoped_refptr<MetricEntity>& table_entity,
     MINIT(tablet_entity, consistent_prefix_read_requests),
     MINIT(tablet_entity, pgsql_consistent_prefix_read_rows),
     MINIT(tablet_entity, tablet_data_corruptions),
+    MINIT(tablet_entity, transaction_apply_ingested_files),
     MINIT(tablet_entity, rows_inserted) {
 }
 #undef MINIT
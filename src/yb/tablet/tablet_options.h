@@ -53,6 +53,10 @@ struct TabletOptions {
   yb::Env* env = Env::Default();
   rocksdb::Env* rocksdb_env = rocksdb::Env::Default();
   std::shared_ptr<rocksdb::RateLimiter> rate_limiter;
+  // Final statuses of transactions, shared by transaction participants of all tablets.
+  std::shared_ptr<ResolvedTransactionsCache> resolved_transactions_cache;
+  // Merges status requests sent by transaction participants of all tablets.
+  std::shared_ptr<TransactionStatusBatcher> transaction_status_batcher;
 };
 
 struct TabletInitData {
@@ -100,10 +100,18 @@ HistoryRetentionDirective TabletRetentionPolicy::GetRetentionDirective() {
     }
   }
 
+  auto schema = metadata_.schema();
+  MonoDelta compaction_time_window;
+  if (schema->table_properties().HasCompactionTimeWindow()) {
+    compaction_time_window = MonoDelta::FromMilliseconds(
+        schema->table_properties().CompactionTimeWindow());
+  }
+
   return {history_cutoff, std::move(deleted_before_history_cutoff),
-          TableTTL(*metadata_.schema()),
+          TableTTL(*schema),
           docdb::ShouldRetainDeleteMarkersInMajorCompaction(
-              ShouldRetainDeleteMarkersInMajorCompaction())};
+              ShouldRetainDeleteMarkersInMajorCompaction()),
+          compaction_time_window};
 }
 
 Status TabletRetentionPolicy::RegisterReaderTimestamp(HybridTime timestamp) {
@@ -75,6 +75,14 @@ DEFINE_int64(avoid_abort_after_sealing_ms, 20,
              "If transaction was only sealed, we will try to abort it not earlier than this "
                  "period in milliseconds.");
 
+DEFINE_uint64(transaction_check_sealed_interval_ms, 500,
+              "Interval in milliseconds at which the leader of transaction status tablet checks "
+              "participants of sealed transactions, that still have batches not known to be "
+              "replicated. So such transactions are committed even when nobody reads their "
+              "intents.");
+TAG_FLAG(transaction_check_sealed_interval_ms, advanced);
+TAG_FLAG(transaction_check_sealed_interval_ms, runtime);
+
 DEFINE_test_flag(uint64, inject_txn_get_status_delay_ms, 0,
                  "Inject specified delay to transaction get status requests.");
 DEFINE_test_flag(int64, inject_random_delay_on_txn_status_response_ms, 0,
@@ -316,6 +324,7 @@ class TransactionState {
     it->second.all_batches_replicated = true;
 
     if (tablets_with_not_replicated_batches_ == 0) {
+      NotifyAbortWaiters(TransactionStatusResult(TransactionStatus::COMMITTED, commit_time_));
       StartApply();
     }
   }
@@ -382,6 +391,15 @@ class TransactionState {
       return TransactionStatusResult(TransactionStatus::COMMITTED, HybridTime::kMax);
     } else if (status_ == TransactionStatus::ABORTED) {
       return TransactionStatusResult::Aborted();
+    } else if (status_ == TransactionStatus::SEALED) {
+      // Sealed transaction could be aborted only when some of its batches are not replicated yet.
+      // So participants are checked immediately, and asked to abort transaction if its batches
+      // are not replicated there. Waiters are notified when transaction is committed or aborted.
+      VLOG_WITH_PREFIX(1) << "External abort request of sealed transaction";
+      abort_waiters_.emplace_back(std::move(*callback));
+      abort_sealed_ = true;
+      next_check_sealed_batches_ = CoarseTimePoint();
+      return TransactionStatusResult(TransactionStatus::PENDING, HybridTime::kMax);
     } else {
       VLOG_WITH_PREFIX(1) << "External abort request";
       CHECK_EQ(TransactionStatus::PENDING, status_);
@@ -428,6 +446,23 @@ class TransactionState {
     return log_prefix_;
   }
 
+  // Returns true if participants should be checked for batches of this sealed transaction, and
+  // fills batches that are not known to be replicated yet. abort_if_not_replicated is set when
+  // abort of this transaction was requested.
+  bool CheckSealedBatches(
+      CoarseTimePoint now, std::vector<ExpectedTabletBatches>* expected_tablet_batches,
+      bool* abort_if_not_replicated) {
+    if (status_ != TransactionStatus::SEALED || tablets_with_not_replicated_batches_ == 0 ||
+        now < next_check_sealed_batches_) {
+      return false;
+    }
+    next_check_sealed_batches_ =
+        now + 1ms * GetAtomicFlag(&FLAGS_transaction_check_sealed_interval_ms);
+    FillExpectedTabletBatches(expected_tablet_batches);
+    *abort_if_not_replicated = abort_sealed_;
+    return true;
+  }
+
   // now_physical is just optimization to avoid querying the current time multiple times.
   void Poll(bool leader, MonoTime now_physical) {
     if (status_ != TransactionStatus::COMMITTED &&
@@ -688,6 +723,9 @@ class TransactionState {
     commit_time_ = data.hybrid_time;
     // TODO(dtxn) Not yet implemented
     next_abort_after_sealing_ = CoarseMonoClock::now() + FLAGS_avoid_abort_after_sealing_ms * 1ms;
+    // Give batches that were sent concurrently with seal record a chance to be replicated,
+    // before checking participants.
+    next_check_sealed_batches_ = next_abort_after_sealing_;
     // TODO(savepoints) Savepoints with sealed transactions is not yet tested
     aborted_ = data.state.aborted();
     VLOG_WITH_PREFIX(4) << "Seal time: " << commit_time_;
@@ -835,6 +873,14 @@ class TransactionState {
   // If transaction was only sealed, we will try to abort it not earlier than this time.
   CoarseTimePoint next_abort_after_sealing_;
 
+  // If transaction was sealed, leader checks participants for replicated batches not earlier than
+  // this time.
+  CoarseTimePoint next_check_sealed_batches_;
+
+  // Whether abort of sealed transaction was requested, so participants are asked to abort it
+  // when its batches are not replicated.
+  bool abort_sealed_ = false;
+
   struct InvolvedTabletState {
     // How many batches should be replicated at this tablet.
     size_t required_replicated_batches = 0;
@@ -1003,10 +1049,8 @@ class TransactionCoordinator::Impl : public TransactionStateContext {
         << ", expected tablet batches: " << AsString(expected_tablet_batches)
         << ", abort if not replicated: " << abort_if_not_replicated;
 
-    auto deadline = TransactionRpcDeadline();
-    auto now_ht = context_.clock().Now();
-    CountDownLatch latch(expected_tablet_batches.size());
-    std::vector<HybridTime> write_hybrid_times(expected_tablet_batches.size());
+    CountDownLatch latch(1);
+    std::vector<HybridTime> write_hybrid_times;
     {
       lock->unlock();
       auto scope_exit = ScopeExit([lock] {
@@ -1014,54 +1058,14 @@ class TransactionCoordinator::Impl : public TransactionStateContext {
           lock->lock();
         }
       });
-      size_t idx = 0;
-      for (const auto& p : expected_tablet_batches) {
-        tserver::GetTransactionStatusAtParticipantRequestPB req;
-        req.set_tablet_id(p.tablet);
-        req.set_transaction_id(
-            pointer_cast<const char*>(transaction_id.data()), transaction_id.size());
-        req.set_propagated_hybrid_time(now_ht.ToUint64());
-        if (abort_if_not_replicated) {
-          req.set_required_num_replicated_batches(p.batches);
-        }
-
-        auto handle = rpcs_.Prepare();
-        if (handle != rpcs_.InvalidHandle()) {
-          *handle = GetTransactionStatusAtParticipant(
-              deadline,
-              nullptr /* remote_tablet */,
-              context_.client_future().get(),
-              &req,
-              [this, handle, idx, &write_hybrid_times, &expected_tablet_batches, &latch,
-               &transaction_id, &p](
-                  const Status& status,
-                  const tserver::GetTransactionStatusAtParticipantResponsePB& resp) {
-                client::UpdateClock(resp, &context_);
-                rpcs_.Unregister(handle);
-
-                VLOG_WITH_PREFIX(4)
-                    << "TXN: " << transaction_id << " batch status at " << p.tablet << ": "
-                    << "idx: " << idx << ", resp: " << resp.ShortDebugString() << ", expected: "
-                    << expected_tablet_batches[idx].batches;
-                if (status.ok()) {
-                  if (resp.aborted()) {
-                    write_hybrid_times[idx] = HybridTime::kMin;
-                  } else if (implicit_cast<size_t>(resp.num_replicated_batches()) ==
-                                 expected_tablet_batches[idx].batches) {
-                    write_hybrid_times[idx] = HybridTime(resp.status_hybrid_time());
-                    LOG_IF_WITH_PREFIX(DFATAL, !write_hybrid_times[idx].is_valid())
-                        << "Received invalid hybrid time when all batches were replicated: "
-                        << resp.ShortDebugString();
-                  }
-                }
-                latch.CountDown();
-              });
-          (**handle).SendRpc();
-        } else {
-          latch.CountDown();
-        }
-        ++idx;
-      }
+      RequestSealedBatchesStatus(
+          transaction_id,
+          std::make_shared<std::vector<ExpectedTabletBatches>>(expected_tablet_batches),
+          abort_if_not_replicated,
+          [&write_hybrid_times, &latch](std::vector<HybridTime>* hybrid_times) {
+            write_hybrid_times = std::move(*hybrid_times);
+            latch.CountDown();
+          });
       latch.Wait();
     }
 
@@ -1071,6 +1075,111 @@ class TransactionCoordinator::Impl : public TransactionStateContext {
       return TransactionStatusResult{TransactionStatus::PENDING, commit_time.Decremented()};
     }
 
+    ApplySealedBatchesStatus(txn_it, expected_tablet_batches, write_hybrid_times);
+    auto result = VERIFY_RESULT(txn_it->GetStatus(/* expected_tablet_batches = */ nullptr));
+    if (result.status != TransactionStatus::SEALED) {
+      VLOG_WITH_PREFIX(4) << "TXN: " << transaction_id << " status resolved: "
+                          << TransactionStatus_Name(result.status);
+      return result;
+    }
+
+    VLOG_WITH_PREFIX(4) << "TXN: " << transaction_id << " status NOT resolved";
+    return TransactionStatusResult{TransactionStatus::PENDING, result.status_time.Decremented()};
+  }
+
+  using SealedBatchesStatusCallback = std::function<void(std::vector<HybridTime>*)>;
+
+  // Sealed transaction which participants should be checked by the leader poll.
+  struct SealedTransactionCheck {
+    TransactionId id;
+    std::shared_ptr<std::vector<ExpectedTabletBatches>> expected_tablet_batches;
+    bool abort_if_not_replicated;
+  };
+
+  // Requests the number of replicated batches of sealed transaction from its participants.
+  // Callback receives hybrid time of the last batch for each tablet that replicated all expected
+  // batches, HybridTime::kMin for tablets where transaction was aborted, and invalid hybrid time
+  // for other tablets.
+  void RequestSealedBatchesStatus(
+      const TransactionId& transaction_id,
+      std::shared_ptr<std::vector<ExpectedTabletBatches>> expected_tablet_batches,
+      bool abort_if_not_replicated,
+      SealedBatchesStatusCallback callback) {
+    struct RequestState {
+      std::vector<HybridTime> write_hybrid_times;
+      std::atomic<size_t> pending;
+      SealedBatchesStatusCallback callback;
+
+      void CountDown() {
+        if (pending.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+          callback(&write_hybrid_times);
+        }
+      }
+    };
+
+    auto state = std::make_shared<RequestState>();
+    state->write_hybrid_times.resize(expected_tablet_batches->size());
+    // Extra count is released after all requests are sent, so callback is not invoked earlier.
+    state->pending = expected_tablet_batches->size() + 1;
+    state->callback = std::move(callback);
+
+    auto deadline = TransactionRpcDeadline();
+    auto now_ht = context_.clock().Now();
+    for (size_t idx = 0; idx != expected_tablet_batches->size(); ++idx) {
+      const auto& p = (*expected_tablet_batches)[idx];
+      tserver::GetTransactionStatusAtParticipantRequestPB req;
+      req.set_tablet_id(p.tablet);
+      req.set_transaction_id(
+          pointer_cast<const char*>(transaction_id.data()), transaction_id.size());
+      req.set_propagated_hybrid_time(now_ht.ToUint64());
+      if (abort_if_not_replicated) {
+        req.set_required_num_replicated_batches(p.batches);
+      }
+
+      auto handle = rpcs_.Prepare();
+      if (handle == rpcs_.InvalidHandle()) {
+        state->CountDown();
+        continue;
+      }
+      *handle = GetTransactionStatusAtParticipant(
+          deadline,
+          nullptr /* remote_tablet */,
+          context_.client_future().get(),
+          &req,
+          [this, handle, idx, state, expected_tablet_batches, transaction_id](
+              const Status& status,
+              const tserver::GetTransactionStatusAtParticipantResponsePB& resp) {
+            client::UpdateClock(resp, &context_);
+            rpcs_.Unregister(handle);
+
+            const auto& expected = (*expected_tablet_batches)[idx];
+            VLOG_WITH_PREFIX(4)
+                << "TXN: " << transaction_id << " batch status at " << expected.tablet << ": "
+                << "idx: " << idx << ", resp: " << resp.ShortDebugString() << ", expected: "
+                << expected.batches;
+            if (status.ok()) {
+              auto& write_hybrid_time = state->write_hybrid_times[idx];
+              if (resp.aborted()) {
+                write_hybrid_time = HybridTime::kMin;
+              } else if (implicit_cast<size_t>(resp.num_replicated_batches()) ==
+                             expected.batches) {
+                write_hybrid_time = HybridTime(resp.status_hybrid_time());
+                LOG_IF_WITH_PREFIX(DFATAL, !write_hybrid_time.is_valid())
+                    << "Received invalid hybrid time when all batches were replicated: "
+                    << resp.ShortDebugString();
+              }
+            }
+            state->CountDown();
+          });
+      (**handle).SendRpc();
+    }
+    state->CountDown();
+  }
+
+  void ApplySealedBatchesStatus(
+      ManagedTransactions::iterator txn_it,
+      const std::vector<ExpectedTabletBatches>& expected_tablet_batches,
+      const std::vector<HybridTime>& write_hybrid_times) {
     for (size_t idx = 0; idx != expected_tablet_batches.size(); ++idx) {
       if (write_hybrid_times[idx] == HybridTime::kMin) {
         managed_transactions_.modify(txn_it, [](TransactionState& state) {
@@ -1084,15 +1193,25 @@ class TransactionCoordinator::Impl : public TransactionStateContext {
         });
       }
     }
-    auto result = VERIFY_RESULT(txn_it->GetStatus(/* expected_tablet_batches = */ nullptr));
-    if (result.status != TransactionStatus::SEALED) {
-      VLOG_WITH_PREFIX(4) << "TXN: " << transaction_id << " status resolved: "
-                          << TransactionStatus_Name(result.status);
-      return result;
-    }
+  }
 
-    VLOG_WITH_PREFIX(4) << "TXN: " << transaction_id << " status NOT resolved";
-    return TransactionStatusResult{TransactionStatus::PENDING, result.status_time.Decremented()};
+  // Invoked when batches of sealed transaction were checked by the leader poll.
+  void SealedBatchesChecked(
+      const TransactionId& transaction_id,
+      const std::vector<ExpectedTabletBatches>& expected_tablet_batches,
+      const std::vector<HybridTime>& write_hybrid_times) {
+    PostponedLeaderActions actions;
+    {
+      std::lock_guard<std::mutex> lock(managed_mutex_);
+      auto it = managed_transactions_.find(transaction_id);
+      if (it == managed_transactions_.end()) {
+        return;
+      }
+      postponed_leader_actions_.leader_term = context_.LeaderTerm();
+      ApplySealedBatchesStatus(it, expected_tablet_batches, write_hybrid_times);
+      actions.Swap(&postponed_leader_actions_);
+    }
+    ExecutePostponedLeaderActions(&actions);
   }
 
   void Abort(const std::string& transaction_id, int64_t term, TransactionAbortCallback callback) {
@@ -1449,6 +1568,7 @@ class TransactionCoordinator::Impl : public TransactionStateContext {
     auto leader_term = context_.LeaderTerm();
     bool leader = leader_term != OpId::kUnknownTerm;
     PostponedLeaderActions actions;
+    std::vector<SealedTransactionCheck> sealed_transactions;
     {
       std::lock_guard<std::mutex> lock(managed_mutex_);
       postponed_leader_actions_.leader_term = leader_term;
@@ -1481,12 +1601,37 @@ class TransactionCoordinator::Impl : public TransactionStateContext {
         }
       }
       auto now_physical = MonoTime::Now();
+      auto now_coarse = ToCoarse(now_physical);
       for (auto& transaction : managed_transactions_) {
-        const_cast<TransactionState&>(transaction).Poll(leader, now_physical);
+        auto& mutable_transaction = const_cast<TransactionState&>(transaction);
+        mutable_transaction.Poll(leader, now_physical);
+        if (!leader) {
+          continue;
+        }
+        // Batches of sealed transaction could be replicated when nobody is interested in its
+        // status, so leader checks them itself to commit such transaction.
+        SealedTransactionCheck check{
+            transaction.id(), std::make_shared<std::vector<ExpectedTabletBatches>>(), false};
+        if (mutable_transaction.CheckSealedBatches(
+                now_coarse, check.expected_tablet_batches.get(), &check.abort_if_not_replicated)) {
+          sealed_transactions.push_back(std::move(check));
+        }
       }
       postponed_leader_actions_.Swap(&actions);
     }
     ExecutePostponedLeaderActions(&actions);
+
+    for (auto& check : sealed_transactions) {
+      VLOG_WITH_PREFIX(4) << "Check sealed batches of " << check.id << ": "
+                          << AsString(*check.expected_tablet_batches)
+                          << ", abort if not replicated: " << check.abort_if_not_replicated;
+      RequestSealedBatchesStatus(
+          check.id, check.expected_tablet_batches, check.abort_if_not_replicated,
+          [this, id = check.id, expected_tablet_batches = check.expected_tablet_batches](
+              std::vector<HybridTime>* write_hybrid_times) {
+            SealedBatchesChecked(id, *expected_tablet_batches, *write_hybrid_times);
+          });
+    }
   }
 
   void CheckCompleted(ManagedTransactions::iterator it) {
@@ -29,8 +29,10 @@
 
 #include "yb/docdb/docdb_rocksdb_util.h"
 #include "yb/docdb/transaction_dump.h"
+#include "yb/docdb/wait_queue.h"
 
 #include "yb/rpc/poller.h"
+#include "yb/rpc/thread_pool.h"
 
 #include "yb/server/clock.h"
 
@@ -38,8 +40,10 @@
 #include "yb/tablet/cleanup_intents_task.h"
 #include "yb/tablet/operations/update_txn_operation.h"
 #include "yb/tablet/remove_intents_task.h"
+#include "yb/tablet/resolved_transactions_cache.h"
 #include "yb/tablet/running_transaction.h"
 #include "yb/tablet/running_transaction_context.h"
+#include "yb/tablet/running_transaction_index.h"
 #include "yb/tablet/transaction_loader.h"
 #include "yb/tablet/transaction_participant_context.h"
 #include "yb/tablet/transaction_status_resolver.h"
@@ -108,6 +112,33 @@ namespace {
 
 YB_STRONGLY_TYPED_BOOL(PostApplyCleanup);
 
+// Invokes wait queue waiter callback in the service thread pool, or with the thread pool error,
+// when the task could not be executed.
+class ResumeWaiterTask : public rpc::ThreadPoolTask {
+ public:
+  ResumeWaiterTask(docdb::WaiterCallback callback, const Status& status)
+      : callback_(std::move(callback)), status_(status) {}
+
+  void Run() override {
+    auto callback = std::move(callback_);
+    callback_ = nullptr;
+    callback(status_);
+  }
+
+  void Done(const Status& status) override {
+    if (callback_) {
+      callback_(status.ok() ? status_ : status);
+    }
+    delete this;
+  }
+
+ private:
+  virtual ~ResumeWaiterTask() = default;
+
+  docdb::WaiterCallback callback_;
+  Status status_;
+};
+
 } // namespace
 
 std::string TransactionApplyData::ToString() const {
@@ -119,10 +150,19 @@ class TransactionParticipant::Impl
     : public RunningTransactionContext, public TransactionLoaderContext {
  public:
   Impl(TransactionParticipantContext* context, TransactionIntentApplier* applier,
-       const scoped_refptr<MetricEntity>& entity)
-      : RunningTransactionContext(context, applier),
+       const scoped_refptr<MetricEntity>& entity,
+       ResolvedTransactionsCache* resolved_transactions_cache,
+       TransactionStatusBatcher* status_batcher)
+      : RunningTransactionContext(
+            context, applier, resolved_transactions_cache, status_batcher),
         log_prefix_(context->LogPrefix()),
         loader_(this, entity),
+        wait_queue_(
+            log_prefix_,
+            [this](docdb::WaiterCallback callback, const Status& status) {
+              participant_context_.Enqueue(new ResumeWaiterTask(std::move(callback), status));
+            },
+            entity),
         poller_(log_prefix_, std::bind(&Impl::Poll, this)) {
     LOG_WITH_PREFIX(INFO) << "Create";
     metric_transactions_running_ = METRIC_transactions_running.Instantiate(entity, 0);
@@ -145,6 +185,7 @@ class TransactionParticipant::Impl
     }
 
     poller_.Shutdown();
+    wait_queue_.StartShutdown();
 
     if (start_latch_.count()) {
       start_latch_.CountDown();
@@ -162,6 +203,7 @@ class TransactionParticipant::Impl
       MinRunningNotifier min_running_notifier(nullptr /* applier */);
       std::lock_guard<std::mutex> lock(mutex_);
       transactions_.clear();
+      transactions_index_.Clear();
       TransactionsModifiedUnlocked(&min_running_notifier);
       status_resolvers.swap(status_resolvers_);
     }
@@ -191,6 +233,11 @@ class TransactionParticipant::Impl
       return false;
     }
     loader_.WaitLoaded(metadata->transaction_id);
+    // Most writes belong to transactions that are already running, so check it without taking
+    // the participant mutex.
+    if (transactions_index_.Contains(metadata->transaction_id)) {
+      return true;
+    }
     bool store = false;
     {
       MinRunningNotifier min_running_notifier(&applier_);
@@ -206,6 +253,7 @@ class TransactionParticipant::Impl
         VLOG_WITH_PREFIX(4) << "Create new transaction: " << metadata->transaction_id;
         transactions_.insert(std::make_shared<RunningTransaction>(
             *metadata, TransactionalBatchData(), OneWayBitmap(), metadata->start_time, this));
+        transactions_index_.Add(metadata->transaction_id);
         TransactionsModifiedUnlocked(&min_running_notifier);
         store = true;
       }
@@ -223,24 +271,11 @@ class TransactionParticipant::Impl
   }
 
   HybridTime LocalCommitTime(const TransactionId& id) {
-    std::lock_guard<std::mutex> lock(mutex_);
-    auto it = transactions_.find(id);
-    if (it == transactions_.end()) {
-      return HybridTime::kInvalid;
-    }
-    return (**it).local_commit_time();
+    return transactions_index_.LocalCommitTime(id);
   }
 
   boost::optional<CommitMetadata> LocalCommitData(const TransactionId& id) {
-    std::lock_guard<std::mutex> lock(mutex_);
-    auto it = transactions_.find(id);
-    if (it == transactions_.end()) {
-      return boost::none;
-    }
-    return boost::make_optional<CommitMetadata>({
-      .commit_ht = (**it).local_commit_time(),
-      .aborted_subtxn_set = (**it).local_commit_aborted_subtxn_set(),
-    });
+    return transactions_index_.LocalCommitData(id);
   }
 
   std::pair<size_t, size_t> TEST_CountIntents() {
@@ -442,7 +477,11 @@ class TransactionParticipant::Impl
   void Handle(std::unique_ptr<tablet::UpdateTxnOperation> operation, int64_t term) {
     auto txn_status = operation->request()->status();
     if (txn_status == TransactionStatus::APPLYING) {
-      HandleApplying(std::move(operation), term);
+      if (operation->request()->single_tablet_commit()) {
+        HandleSingleTabletCommit(std::move(operation), term);
+      } else {
+        HandleApplying(std::move(operation), term);
+      }
       return;
     }
 
@@ -533,6 +572,11 @@ class TransactionParticipant::Impl
         transactions_.modify(lock_and_iterator.iterator, [&data](auto& txn) {
           txn->SetLocalCommitData(data.commit_ht, data.aborted);
         });
+        transactions_index_.SetLocalCommitData(data.transaction_id, data.commit_ht, data.aborted);
+        if (resolved_transactions_cache_) {
+          resolved_transactions_cache_->Committed(
+              data.transaction_id, data.commit_ht, data.aborted);
+        }
 
         LOG_IF_WITH_PREFIX(DFATAL, data.log_ht < last_safe_time_)
             << "Apply transaction before last safe time " << data.transaction_id
@@ -550,6 +594,7 @@ class TransactionParticipant::Impl
     }
 
     NotifyApplied(data);
+    wait_queue_.SignalResolved(data.transaction_id);
     return Status::OK();
   }
 
@@ -564,6 +609,9 @@ class TransactionParticipant::Impl
         data.transaction_id, "apply"s, TransactionLoadFlags{TransactionLoadFlag::kMustExist});
     if (lock_and_iterator.found()) {
       if (!apply_state.active()) {
+        transactions_.modify(lock_and_iterator.iterator, [&data](auto& txn) {
+          txn->SetApplyOpId(data.op_id);
+        });
         RemoveUnlocked(lock_and_iterator.iterator, RemoveReason::kApplied, &min_running_notifier);
       } else {
         lock_and_iterator.transaction().SetApplyData(apply_state, &data, operation);
@@ -574,7 +622,8 @@ class TransactionParticipant::Impl
   void NotifyApplied(const TransactionApplyData& data) {
     VLOG_WITH_PREFIX(4) << Format("NotifyApplied($0)", data);
 
-    if (data.leader_term != OpId::kUnknownTerm) {
+    // Transaction committed by this tablet directly does not have status tablet to notify.
+    if (data.leader_term != OpId::kUnknownTerm && !data.status_tablet.empty()) {
       tserver::UpdateTransactionRequestPB req;
       req.set_tablet_id(data.status_tablet);
       req.set_propagated_hybrid_time(participant_context_.Now().ToUint64());
@@ -624,6 +673,10 @@ class TransactionParticipant::Impl
       VLOG_WITH_PREFIX(2) << "Don't cleanup transaction because it is applying intents: "
                           << data.transaction_id;
       return Status::OK();
+    } else if ((**it).single_tablet_commit_pending()) {
+      VLOG_WITH_PREFIX(2) << "Don't cleanup transaction because it is being committed: "
+                          << data.transaction_id;
+      return Status::OK();
     }
 
     if (cleanup_type == CleanupType::kGraceful) {
@@ -663,6 +716,7 @@ class TransactionParticipant::Impl
     MinRunningNotifier min_running_notifier(&applier_);
     std::lock_guard<std::mutex> lock(mutex_);
     transactions_.clear();
+    transactions_index_.Clear();
     TransactionsModifiedUnlocked(&min_running_notifier);
   }
 
@@ -756,7 +810,8 @@ class TransactionParticipant::Impl
     // resolve_at.
     for (;;) {
       TransactionStatusResolver resolver(
-          &participant_context_, &rpcs_, FLAGS_max_transactions_in_status_request,
+          &participant_context_, &rpcs_, resolved_transactions_cache_,
+          FLAGS_max_transactions_in_status_request,
           [this, resolve_at, &recheck_ids, &committed_ids](
               const std::vector <TransactionStatusInfo>& status_infos) {
             std::vector<TransactionId> aborted;
@@ -927,6 +982,10 @@ class TransactionParticipant::Impl
     return participant_context_.WaitForSafeTime(safe_time, deadline);
   }
 
+  docdb::WaitQueue& wait_queue() const {
+    return wait_queue_;
+  }
+
   void IgnoreAllTransactionsStartedBefore(HybridTime limit) {
     std::lock_guard<std::mutex> lock(mutex_);
     ignore_all_transactions_started_before_ =
@@ -1228,6 +1287,11 @@ class TransactionParticipant::Impl
       txn->SetApplyData(pending_apply->state);
     }
     transactions_.insert(txn);
+    transactions_index_.Add(txn->id());
+    if (pending_apply) {
+      transactions_index_.SetLocalCommitData(
+          txn->id(), pending_apply->commit_ht, pending_apply->state.aborted);
+    }
     TransactionsModifiedUnlocked(&min_running_notifier);
   }
 
@@ -1260,9 +1324,12 @@ class TransactionParticipant::Impl
         Remove, participant_context_.tablet_id(), transaction.id(), participant_context_.Now(),
         static_cast<uint8_t>(reason));
     recently_removed_transactions_cleanup_queue_.push_back({transaction.id(), now + 15s});
-    LOG_IF_WITH_PREFIX(DFATAL, !recently_removed_transactions_.insert(transaction.id()).second)
+    LOG_IF_WITH_PREFIX(DFATAL, !recently_removed_transactions_.emplace(
+        transaction.id(), IntentsObsoleteAfter(transaction)).second)
         << "Transaction removed twice: " << transaction.id();
     VLOG_WITH_PREFIX(4) << "Remove transaction: " << transaction.id();
+    wait_queue_.SignalResolved(transaction.id());
+    transactions_index_.Remove(transaction.id());
     transactions_.erase(it);
     TransactionsModifiedUnlocked(min_running_notifier);
   }
@@ -1280,6 +1347,28 @@ class TransactionParticipant::Impl
     return recently_removed_transactions_.count(id) != 0;
   }
 
+  // Returns op id, after flushing which to regular DB, intents of removed transaction are no
+  // longer required for recovery.
+  static OpId IntentsObsoleteAfter(const RunningTransaction& transaction) {
+    if (!transaction.local_commit_time().is_valid()) {
+      // Aborted transaction, its intents would never be applied.
+      return OpId::Min();
+    }
+    const auto& apply_op_id = transaction.apply_op_id();
+    // Transaction applied in several steps keeps its intents until they are compacted.
+    return apply_op_id.empty() ? OpId::Max() : apply_op_id;
+  }
+
+  bool IntentsObsolete(const TransactionId& id, const OpId& regular_flushed_op_id) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (transactions_.find(id) != transactions_.end()) {
+      return false;
+    }
+    CleanupRecentlyRemovedTransactions(CoarseMonoClock::now());
+    auto it = recently_removed_transactions_.find(id);
+    return it != recently_removed_transactions_.end() && it->second <= regular_flushed_op_id;
+  }
+
   void CheckMinRunningHybridTimeSatisfiedUnlocked(
       MinRunningNotifier* min_running_notifier) {
     if (min_running_ht_.load(std::memory_order_acquire) <= waiting_for_min_running_ht_) {
@@ -1323,6 +1412,66 @@ class TransactionParticipant::Impl
     participant_context_.SubmitUpdateTransaction(std::move(operation), term);
   }
 
+  // Commits transaction that has intents only at this tablet, using a single APPLYING operation
+  // instead of going through the status tablet.
+  void HandleSingleTabletCommit(
+      std::unique_ptr<tablet::UpdateTxnOperation> operation, int64_t term) {
+    auto id = FullyDecodeTransactionId(operation->request()->transaction_id());
+    if (!id.ok()) {
+      operation->CompleteWithStatus(id.status());
+      return;
+    }
+
+    {
+      auto lock_and_iterator = LockAndFind(
+          *id, "single tablet commit"s, TransactionLoadFlags{TransactionLoadFlag::kMustExist});
+      if (!lock_and_iterator.found()) {
+        // Commit request could be retried after transaction was already committed and removed.
+        // Lock is not held when transaction is not found.
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (single_tablet_commits_.Erase(*id)) {
+          single_tablet_commits_.Insert(*id);
+          operation->CompleteWithStatus(Status::OK());
+        } else {
+          operation->CompleteWithStatus(MakeAbortedStatus(*id));
+        }
+        return;
+      }
+      auto& transaction = lock_and_iterator.transaction();
+      if (transaction.local_commit_time()) {
+        operation->CompleteWithStatus(Status::OK());
+        return;
+      }
+      if (transaction.single_tablet_commit_pending()) {
+        // Retry of request that is still in progress, ask client to retry it later.
+        operation->CompleteWithStatus(STATUS_FORMAT(
+            ServiceUnavailable, "Single tablet commit in progress: $0", *id));
+        return;
+      }
+      if (transaction.WasAborted()) {
+        operation->CompleteWithStatus(MakeAbortedStatus(*id));
+        return;
+      }
+      // From this point abort decisions of the status tablet are ignored, so conflicting
+      // transaction could not abort this transaction while it is being committed.
+      transaction.SetSingleTabletCommitPending(true);
+    }
+
+    VLOG_WITH_PREFIX(2) << "Single tablet commit: " << *id;
+    auto callback = operation->completion_callback();
+    operation->set_completion_callback([this, id = *id, callback](const Status& status) {
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = transactions_.find(id);
+        if (it != transactions_.end()) {
+          (**it).SetSingleTabletCommitPending(false);
+        }
+      }
+      callback(status);
+    });
+    participant_context_.SubmitUpdateTransaction(std::move(operation), term);
+  }
+
   void HandleCleanup(
       std::unique_ptr<tablet::UpdateTxnOperation> operation, int64_t term,
       CleanupType cleanup_type) {
@@ -1354,7 +1503,15 @@ class TransactionParticipant::Impl
                            "Expected only one table during APPLYING, state received: $0",
                            data.state);
     }
-    HybridTime commit_time(data.state.commit_hybrid_time());
+    // Leader fills commit time of single tablet commit only in the log entry, but it always
+    // matches the hybrid time of the operation.
+    const bool single_tablet_commit = data.state.single_tablet_commit();
+    HybridTime commit_time = single_tablet_commit
+        ? data.hybrid_time : HybridTime(data.state.commit_hybrid_time());
+    if (single_tablet_commit) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      single_tablet_commits_.Insert(id);
+    }
     TransactionApplyData apply_data = {
         .leader_term = data.leader_term,
         .transaction_id = id,
@@ -1363,7 +1520,7 @@ class TransactionParticipant::Impl
         .commit_ht = commit_time,
         .log_ht = data.hybrid_time,
         .sealed = data.sealed,
-        .status_tablet = data.state.tablets(0)
+        .status_tablet = single_tablet_commit ? TabletId() : data.state.tablets(0)
       };
     if (!data.already_applied_to_regular_db) {
       return ProcessApply(apply_data);
@@ -1387,6 +1544,7 @@ class TransactionParticipant::Impl
       };
       it = transactions_.insert(std::make_shared<RunningTransaction>(
           metadata, TransactionalBatchData(), OneWayBitmap(), HybridTime::kMax, this)).first;
+      transactions_index_.Add(id);
       TransactionsModifiedUnlocked(&min_running_notifier);
     }
 
@@ -1408,6 +1566,7 @@ class TransactionParticipant::Impl
       CleanTransactionsQueue(&graceful_cleanup_queue_, &min_running_notifier);
     }
     CleanupStatusResolvers();
+    wait_queue_.Poll(CoarseMonoClock::now());
   }
 
   void CheckForAbortedTransactions() REQUIRES(mutex_) {
@@ -1454,7 +1613,8 @@ class TransactionParticipant::Impl
   TransactionStatusResolver& AddStatusResolver() override EXCLUDES(status_resolvers_mutex_) {
     std::lock_guard<std::mutex> lock(status_resolvers_mutex_);
     status_resolvers_.emplace_back(
-        &participant_context_, &rpcs_, FLAGS_max_transactions_in_status_request,
+        &participant_context_, &rpcs_, resolved_transactions_cache_,
+        FLAGS_max_transactions_in_status_request,
         std::bind(&Impl::TransactionsStatus, this, _1));
     return status_resolvers_.back();
   }
@@ -1491,6 +1651,8 @@ class TransactionParticipant::Impl
   RWOperationCounter* pending_op_counter_ = nullptr;
 
   Transactions transactions_;
+  // Mirrors ids and local commit data of transactions_, for lookups without taking mutex_.
+  RunningTransactionIndex transactions_index_;
   // Ids of running requests, stored in increasing order.
   std::deque<int64_t> running_requests_;
   // Ids of complete requests, minimal request is on top.
@@ -1526,7 +1688,8 @@ class TransactionParticipant::Impl
 
   HybridTime ignore_all_transactions_started_before_ GUARDED_BY(mutex_) = HybridTime::kMin;
 
-  std::unordered_set<TransactionId, TransactionIdHash> recently_removed_transactions_;
+  // Maps recently removed transaction to op id returned by IntentsObsoleteAfter.
+  std::unordered_map<TransactionId, OpId, TransactionIdHash> recently_removed_transactions_;
   struct RecentlyRemovedTransaction {
     TransactionId id;
     CoarseTimePoint time;
@@ -1552,13 +1715,21 @@ class TransactionParticipant::Impl
 
   LRUCache<TransactionId> cleanup_cache_{FLAGS_transactions_cleanup_cache_size};
 
+  // Recently committed single tablet transactions, used to respond to retried commit requests.
+  // Guarded by RunningTransactionContext::mutex_
+  LRUCache<TransactionId> single_tablet_commits_{FLAGS_transactions_cleanup_cache_size};
+
+  mutable docdb::WaitQueue wait_queue_;
+
   rpc::Poller poller_;
 };
 
 TransactionParticipant::TransactionParticipant(
     TransactionParticipantContext* context, TransactionIntentApplier* applier,
-    const scoped_refptr<MetricEntity>& entity)
-    : impl_(new Impl(context, applier, entity)) {
+    const scoped_refptr<MetricEntity>& entity,
+    ResolvedTransactionsCache* resolved_transactions_cache,
+    TransactionStatusBatcher* status_batcher)
+    : impl_(new Impl(context, applier, entity, resolved_transactions_cache, status_batcher)) {
 }
 
 TransactionParticipant::~TransactionParticipant() {
@@ -1664,6 +1835,11 @@ HybridTime TransactionParticipant::MinRunningHybridTime() const {
   return impl_->MinRunningHybridTime();
 }
 
+bool TransactionParticipant::IntentsObsolete(
+    const TransactionId& id, const OpId& regular_flushed_op_id) {
+  return impl_->IntentsObsolete(id, regular_flushed_op_id);
+}
+
 void TransactionParticipant::WaitMinRunningHybridTime(HybridTime ht) {
   impl_->WaitMinRunningHybridTime(ht);
 }
@@ -1711,6 +1887,10 @@ void TransactionParticipant::IgnoreAllTransactionsStartedBefore(HybridTime limit
   impl_->IgnoreAllTransactionsStartedBefore(limit);
 }
 
+docdb::WaitQueue& TransactionParticipant::wait_queue() const {
+  return impl_->wait_queue();
+}
+
 const TabletId& TransactionParticipant::tablet_id() const {
   return impl_->participant_context()->tablet_id();
 }
@@ -102,9 +102,13 @@ struct TransactionalBatchData {
 // instance per tablet.
 class TransactionParticipant : public TransactionStatusManager {
  public:
+  // resolved_transactions_cache and status_batcher are optional, and should outlive the
+  // participant.
   TransactionParticipant(
       TransactionParticipantContext* context, TransactionIntentApplier* applier,
-      const scoped_refptr<MetricEntity>& entity);
+      const scoped_refptr<MetricEntity>& entity,
+      ResolvedTransactionsCache* resolved_transactions_cache = nullptr,
+      TransactionStatusBatcher* status_batcher = nullptr);
   virtual ~TransactionParticipant();
 
   // Notify participant that this context is ready and it could start performing its requests.
@@ -173,6 +177,11 @@ class TransactionParticipant : public TransactionStatusManager {
 
   HybridTime MinRunningHybridTime() const override;
 
+  // Returns true if intents of the specified transaction are not required anymore, when regular DB
+  // is flushed up to regular_flushed_op_id. I.e. transaction was recently removed, and was either
+  // aborted or applied by an operation that is already flushed to regular DB.
+  bool IntentsObsolete(const TransactionId& id, const OpId& regular_flushed_op_id);
+
   Result<HybridTime> WaitForSafeTime(HybridTime safe_time, CoarseTimePoint deadline) override;
 
   // When minimal start hybrid time of running transaction will be at least `ht` applier
@@ -198,6 +207,9 @@ class TransactionParticipant : public TransactionStatusManager {
 
   void IgnoreAllTransactionsStartedBefore(HybridTime limit);
 
+  // Queue of requests waiting for conflicting transactions of this tablet to commit or abort.
+  docdb::WaitQueue& wait_queue() const;
+
   std::string DumpTransactions() const;
 
   const TabletId& tablet_id() const override;
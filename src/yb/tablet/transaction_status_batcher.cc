@@ -0,0 +1,263 @@
+// Copyright (c) YugaByte, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+// in compliance with the License.  You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied.  See the License for the specific language governing permissions and limitations
+// under the License.
+//
+
+#include "yb/tablet/transaction_status_batcher.h"
+
+#include "yb/gutil/casts.h"
+
+#include "yb/tserver/tserver_service.pb.h"
+
+#include "yb/util/flag_tags.h"
+#include "yb/util/format.h"
+#include "yb/util/logging.h"
+#include "yb/util/status_format.h"
+
+DEFINE_bool(transaction_status_batching, true,
+            "Merge transaction status requests sent by participants of all tablets of tablet "
+            "server to the same status tablet.");
+TAG_FLAG(transaction_status_batching, advanced);
+
+DECLARE_int32(max_transactions_in_status_request);
+
+namespace yb {
+namespace tablet {
+
+class TransactionStatusBatcher::Command : public rpc::RpcCommand {
+ public:
+  Command(TransactionStatusBatcher* batcher, CoarseTimePoint deadline, client::YBClient* client,
+          tserver::GetTransactionStatusRequestPB* req,
+          client::GetTransactionStatusCallback callback)
+      : batcher_(batcher), deadline_(deadline), client_(client), callback_(std::move(callback)) {
+    req_.Swap(req);
+  }
+
+  void SendRpc() override {
+    batcher_->Enqueue(std::static_pointer_cast<Command>(shared_from_this()));
+  }
+
+  std::string ToString() const override {
+    return Format("Batched transaction status: $0", req_.ShortDebugString());
+  }
+
+  void Finished(const Status& status) override {
+    callback_(status, tserver::GetTransactionStatusResponsePB());
+  }
+
+  void Abort() override {
+    batcher_->Abort(this);
+  }
+
+  CoarseTimePoint deadline() const override {
+    return deadline_;
+  }
+
+  client::YBClient* client() const {
+    return client_;
+  }
+
+  const TabletId& status_tablet_id() const {
+    return req_.tablet_id();
+  }
+
+  const tserver::GetTransactionStatusRequestPB& request() const {
+    return req_;
+  }
+
+  void Done(const Status& status, const tserver::GetTransactionStatusResponsePB& response) {
+    callback_(status, response);
+  }
+
+ private:
+  TransactionStatusBatcher* const batcher_;
+  const CoarseTimePoint deadline_;
+  client::YBClient* const client_;
+  tserver::GetTransactionStatusRequestPB req_;
+  client::GetTransactionStatusCallback callback_;
+};
+
+TransactionStatusBatcher::TransactionStatusBatcher() {
+}
+
+TransactionStatusBatcher::~TransactionStatusBatcher() {
+  Shutdown();
+}
+
+void TransactionStatusBatcher::Shutdown() {
+  Batch aborted;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (closing_) {
+      return;
+    }
+    closing_ = true;
+    for (auto& queue : queues_) {
+      aborted.insert(aborted.end(), queue.second.queued.begin(), queue.second.queued.end());
+      queue.second.queued.clear();
+    }
+  }
+  for (const auto& command : aborted) {
+    command->Finished(STATUS(Aborted, "Transaction status batcher is shutting down"));
+  }
+  rpcs_.Shutdown();
+}
+
+rpc::RpcCommandPtr TransactionStatusBatcher::GetTransactionStatus(
+    CoarseTimePoint deadline, client::YBClient* client,
+    tserver::GetTransactionStatusRequestPB* req,
+    client::GetTransactionStatusCallback callback) {
+  DCHECK_EQ(req->transaction_id().size(), 1);
+  return std::make_shared<Command>(this, deadline, client, req, std::move(callback));
+}
+
+void TransactionStatusBatcher::Enqueue(const CommandPtr& command) {
+  Batch batch;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!closing_) {
+      auto& queue = queues_[command->status_tablet_id()];
+      queue.queued.push_back(command);
+      if (queue.in_flight) {
+        return;
+      }
+      queue.in_flight = true;
+      batch.swap(queue.queued);
+    }
+  }
+  if (batch.empty()) {
+    command->Finished(STATUS(Aborted, "Transaction status batcher is shutting down"));
+    return;
+  }
+  Send(std::move(batch));
+}
+
+void TransactionStatusBatcher::Abort(Command* command) {
+  CommandPtr aborted;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = queues_.find(command->status_tablet_id());
+    if (it == queues_.end()) {
+      return;
+    }
+    auto& queued = it->second.queued;
+    for (auto i = queued.begin(); i != queued.end(); ++i) {
+      if (i->get() == command) {
+        aborted = std::move(*i);
+        queued.erase(i);
+        break;
+      }
+    }
+  }
+  // Request that is already sent will be completed with the response of its batch.
+  if (aborted) {
+    aborted->Finished(STATUS(Aborted, "Transaction status request aborted"));
+  }
+}
+
+void TransactionStatusBatcher::Send(Batch batch) {
+  tserver::GetTransactionStatusRequestPB req;
+  const auto& first = *batch.front();
+  req.set_tablet_id(first.status_tablet_id());
+  uint64_t propagated_hybrid_time = 0;
+  auto deadline = CoarseTimePoint::min();
+  for (const auto& command : batch) {
+    const auto& command_req = command->request();
+    *req.add_transaction_id() = command_req.transaction_id(0);
+    propagated_hybrid_time = std::max(
+        propagated_hybrid_time, command_req.propagated_hybrid_time());
+    deadline = std::max(deadline, command->deadline());
+  }
+  req.set_propagated_hybrid_time(propagated_hybrid_time);
+
+  VLOG(4) << "Request status of " << batch.size() << " transactions from " << req.tablet_id();
+
+  auto* client = first.client();
+  auto handle = rpcs_.Prepare();
+  if (handle == rpcs_.InvalidHandle()) {
+    BatchDone(STATUS(Aborted, "Transaction status batcher is shutting down"),
+              tserver::GetTransactionStatusResponsePB(), batch);
+    return;
+  }
+  *handle = client::GetTransactionStatus(
+      deadline,
+      nullptr /* tablet */,
+      client,
+      &req,
+      [this, handle, batch = std::move(batch)](
+          const Status& status, const tserver::GetTransactionStatusResponsePB& response) {
+        rpcs_.Unregister(handle);
+        BatchDone(status, response, batch);
+      });
+  (**handle).SendRpc();
+}
+
+void TransactionStatusBatcher::BatchDone(
+    const Status& status, const tserver::GetTransactionStatusResponsePB& response,
+    const Batch& batch) {
+  Status batch_status = status;
+  if (batch_status.ok() && static_cast<size_t>(response.status().size()) != batch.size()) {
+    batch_status = STATUS_FORMAT(
+        IllegalState, "Wrong number of statuses, $0 expected: $1", batch.size(),
+        response.ShortDebugString());
+  }
+  for (size_t i = 0; i != batch.size(); ++i) {
+    tserver::GetTransactionStatusResponsePB command_response;
+    if (response.has_propagated_hybrid_time()) {
+      command_response.set_propagated_hybrid_time(response.propagated_hybrid_time());
+    }
+    if (batch_status.ok()) {
+      // Split batch response into response for the single transaction, see
+      // GetTransactionStatusResponsePB for details about sizes of repeated fields.
+      const int idx = narrow_cast<int>(i);
+      command_response.add_status(response.status(idx));
+      if (idx < response.status_hybrid_time().size()) {
+        command_response.add_status_hybrid_time(response.status_hybrid_time(idx));
+      }
+      if (idx < response.num_replicated_batches().size()) {
+        command_response.add_num_replicated_batches(response.num_replicated_batches(idx));
+      }
+      if (idx < response.coordinator_safe_time().size() && response.coordinator_safe_time(idx)) {
+        command_response.add_coordinator_safe_time(response.coordinator_safe_time(idx));
+      }
+      if (idx < response.aborted_subtxn_set().size()) {
+        *command_response.add_aborted_subtxn_set() = response.aborted_subtxn_set(idx);
+      }
+    }
+    batch[i]->Done(batch_status, command_response);
+  }
+
+  // Send requests that were queued while this batch was in flight.
+  Batch next_batch;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = queues_.find(batch.front()->status_tablet_id());
+    if (it == queues_.end()) {
+      return;
+    }
+    auto& queued = it->second.queued;
+    if (queued.empty()) {
+      queues_.erase(it);
+      return;
+    }
+    const size_t max_batch_size = std::max(FLAGS_max_transactions_in_status_request, 1);
+    if (queued.size() <= max_batch_size) {
+      next_batch.swap(queued);
+    } else {
+      next_batch.assign(queued.begin(), queued.begin() + max_batch_size);
+      queued.erase(queued.begin(), queued.begin() + max_batch_size);
+    }
+  }
+  Send(std::move(next_batch));
+}
+
+} // namespace tablet
+} // namespace yb
@@ -0,0 +1,87 @@
+// Copyright (c) YugaByte, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+// in compliance with the License.  You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied.  See the License for the specific language governing permissions and limitations
+// under the License.
+//
+
+#ifndef YB_TABLET_TRANSACTION_STATUS_BATCHER_H
+#define YB_TABLET_TRANSACTION_STATUS_BATCHER_H
+
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "yb/client/client_fwd.h"
+#include "yb/client/transaction_rpc.h"
+
+#include "yb/common/entity_ids_types.h"
+
+#include "yb/rpc/rpc.h"
+
+#include "yb/util/thread_annotations.h"
+
+namespace yb {
+namespace tablet {
+
+// Tablet server wide merger of GetTransactionStatus requests, sent by transaction participants of
+// all tablets of the tablet server. Requests to the same status tablet are sent in a single RPC.
+//
+// Request is sent immediately when there is no status RPC in flight to its status tablet.
+// Otherwise it is queued, and all queued requests are sent together when response to the previous
+// RPC is received. So batching does not delay requests, while the number of status RPCs to each
+// status tablet is limited to one per round trip.
+class TransactionStatusBatcher {
+ public:
+  TransactionStatusBatcher();
+  ~TransactionStatusBatcher();
+
+  TransactionStatusBatcher(const TransactionStatusBatcher&) = delete;
+  void operator=(const TransactionStatusBatcher&) = delete;
+
+  void Shutdown();
+
+  // Returns command that requests status of the single transaction specified by req, it should be
+  // started using rpc::Rpcs like regular transaction RPC. Response passed to callback contains
+  // status of this transaction only.
+  MUST_USE_RESULT rpc::RpcCommandPtr GetTransactionStatus(
+      CoarseTimePoint deadline, client::YBClient* client,
+      tserver::GetTransactionStatusRequestPB* req,
+      client::GetTransactionStatusCallback callback);
+
+ private:
+  class Command;
+  typedef std::shared_ptr<Command> CommandPtr;
+  typedef std::vector<CommandPtr> Batch;
+
+  struct StatusTabletQueue {
+    // Whether there is status RPC in flight to this status tablet.
+    bool in_flight = false;
+    Batch queued;
+  };
+
+  void Enqueue(const CommandPtr& command);
+  void Abort(Command* command);
+  void Send(Batch batch);
+  void BatchDone(
+      const Status& status, const tserver::GetTransactionStatusResponsePB& response,
+      const Batch& batch);
+
+  rpc::Rpcs rpcs_;
+
+  std::mutex mutex_;
+  bool closing_ GUARDED_BY(mutex_) = false;
+  std::unordered_map<TabletId, StatusTabletQueue> queues_ GUARDED_BY(mutex_);
+};
+
+} // namespace tablet
+} // namespace yb
+
+#endif // YB_TABLET_TRANSACTION_STATUS_BATCHER_H
@@ -18,7 +18,9 @@
 #include "yb/common/wire_protocol.h"
 
 #include "yb/rpc/rpc.h"
+#include "yb/rpc/thread_pool.h"
 
+#include "yb/tablet/resolved_transactions_cache.h"
 #include "yb/tablet/transaction_participant_context.h"
 
 #include "yb/tserver/tserver_service.pb.h"
@@ -46,8 +48,10 @@ namespace tablet {
 class TransactionStatusResolver::Impl {
  public:
   Impl(TransactionParticipantContext* participant_context, rpc::Rpcs* rpcs,
+       ResolvedTransactionsCache* resolved_transactions_cache,
        int max_transactions_per_request, TransactionStatusResolverCallback callback)
       : participant_context_(*participant_context), rpcs_(*rpcs),
+        resolved_transactions_cache_(resolved_transactions_cache),
         max_transactions_per_request_(max_transactions_per_request), callback_(std::move(callback)),
         log_prefix_(participant_context->LogPrefix()), handle_(rpcs_.InvalidHandle()) {}
 
@@ -71,6 +75,12 @@ class TransactionStatusResolver::Impl {
 
     deadline_ = deadline;
     run_latch_.Reset(1);
+    if (!cached_status_infos_.empty()) {
+      // Start could be invoked under participant mutex, while callback acquires it.
+      // So cached statuses are reported from participant thread pool.
+      participant_context_.Enqueue(&report_cached_task_);
+      return;
+    }
     Execute();
   }
 
@@ -84,6 +94,19 @@ class TransactionStatusResolver::Impl {
 
   void Add(const TabletId& status_tablet, const TransactionId& transaction_id) {
     LOG_IF(DFATAL, run_latch_.count()) << "Add while running";
+    if (resolved_transactions_cache_) {
+      auto cached_status = resolved_transactions_cache_->Get(transaction_id);
+      if (cached_status) {
+        cached_status_infos_.push_back(TransactionStatusInfo {
+          .transaction_id = transaction_id,
+          .status = cached_status->status,
+          .aborted_subtxn_set = cached_status->aborted_subtxn_set,
+          .status_ht = cached_status->status_time,
+          .coordinator_safe_time = HybridTime(),
+        });
+        return;
+      }
+    }
     queues_[status_tablet].push_back(transaction_id);
   }
 
@@ -207,6 +230,7 @@ class TransactionStatusResolver::Impl {
       status_info.coordinator_safe_time = i < response.coordinator_safe_time().size()
           ? HybridTime::FromPB(response.coordinator_safe_time(i)) : HybridTime();
       VLOG_WITH_PREFIX(4) << "Status: " << status_info.ToString();
+      CacheStatus(status_info);
       queue.pop_front();
     }
     if (queue.empty()) {
@@ -219,6 +243,28 @@ class TransactionStatusResolver::Impl {
     Execute();
   }
 
+  void ReportCachedStatuses() {
+    VLOG_WITH_PREFIX(2) << "Cached statuses: " << cached_status_infos_.size();
+    if (max_transactions_per_request_ > 0) {
+      callback_(cached_status_infos_);
+    }
+    cached_status_infos_.clear();
+    Execute();
+  }
+
+  void CacheStatus(const TransactionStatusInfo& status_info) {
+    if (!resolved_transactions_cache_) {
+      return;
+    }
+    if (status_info.status == TransactionStatus::COMMITTED) {
+      resolved_transactions_cache_->Committed(
+          status_info.transaction_id, status_info.status_ht, status_info.aborted_subtxn_set);
+    } else if (status_info.status == TransactionStatus::ABORTED &&
+               !status_info.coordinator_safe_time) {
+      resolved_transactions_cache_->Aborted(status_info.transaction_id);
+    }
+  }
+
   void Complete(const Status& status) {
     VLOG_WITH_PREFIX(2) << "Complete: " << status;
     result_promise_.set_value(status);
@@ -228,6 +274,7 @@ class TransactionStatusResolver::Impl {
 
   TransactionParticipantContext& participant_context_;
   rpc::Rpcs& rpcs_;
+  ResolvedTransactionsCache* const resolved_transactions_cache_;
   const int max_transactions_per_request_;
   TransactionStatusResolverCallback callback_;
 
@@ -239,14 +286,38 @@ class TransactionStatusResolver::Impl {
   CoarseTimePoint deadline_;
   std::unordered_map<TabletId, std::deque<TransactionId>> queues_;
   std::vector<TransactionStatusInfo> status_infos_;
+  // Statuses found in cache during Add, reported when resolution starts.
+  std::vector<TransactionStatusInfo> cached_status_infos_;
+
+  class ReportCachedTask : public rpc::ThreadPoolTask {
+   public:
+    explicit ReportCachedTask(Impl* impl) : impl_(*impl) {}
+
+    void Run() override {
+      impl_.ReportCachedStatuses();
+    }
+
+    void Done(const Status& status) override {
+      if (!status.ok()) {
+        impl_.Complete(status);
+      }
+    }
+
+   private:
+    Impl& impl_;
+  };
+
+  ReportCachedTask report_cached_task_{this};
   std::promise<Status> result_promise_;
 };
 
 TransactionStatusResolver::TransactionStatusResolver(
     TransactionParticipantContext* participant_context, rpc::Rpcs* rpcs,
+    ResolvedTransactionsCache* resolved_transactions_cache,
     int max_transactions_per_request, TransactionStatusResolverCallback callback)
     : impl_(new Impl(
-        participant_context, rpcs, max_transactions_per_request, std::move(callback))) {
+        participant_context, rpcs, resolved_transactions_cache, max_transactions_per_request,
+        std::move(callback))) {
 }
 
 TransactionStatusResolver::~TransactionStatusResolver() {}
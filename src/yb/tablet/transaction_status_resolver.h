@@ -49,8 +49,11 @@ using TransactionStatusResolverCallback =
 class TransactionStatusResolver {
  public:
   // If max_transactions_per_request is zero then resolution is skipped.
+  // Statuses found in resolved_transactions_cache are reported without requesting coordinator,
+  // cache could be null.
   TransactionStatusResolver(
       TransactionParticipantContext* participant_context, rpc::Rpcs* rpcs,
+      ResolvedTransactionsCache* resolved_transactions_cache,
       int max_transactions_per_request,
       TransactionStatusResolverCallback callback);
   ~TransactionStatusResolver();
@@ -30,6 +30,7 @@
 #include "yb/docdb/doc_write_batch.h"
 #include "yb/docdb/pgsql_operation.h"
 #include "yb/docdb/redis_operation.h"
+#include "yb/docdb/wait_queue.h"
 
 #include "yb/tablet/tablet_metadata.h"
 #include "yb/tablet/operations/write_operation.h"
@@ -426,8 +427,18 @@ CHECKED_STATUS WriteQuery::DoExecute() {
 
   if (isolation_level_ == IsolationLevel::NON_TRANSACTIONAL) {
     auto now = tablet().clock()->Now();
+    // Atomic multi-row write of a single statement was based on snapshot at read time, so it
+    // should conflict with writes committed after that time, as transaction would do.
+    const bool check_read_time_conflicts =
+        client_request_ && client_request_->check_read_time_conflicts();
+    if (check_read_time_conflicts && !read_time_) {
+      // Without read time such write could silently overwrite concurrent updates.
+      return STATUS(InvalidArgument, "Check of read time conflicts requested without read time");
+    }
+    const auto conflicts_read_time = check_read_time_conflicts ? read_time_.read
+                                                               : HybridTime::kMax;
     docdb::ResolveOperationConflicts(
-        doc_ops_, now, tablet().doc_db(), partial_range_key_intents,
+        doc_ops_, now, conflicts_read_time, tablet().doc_db(), partial_range_key_intents,
         transaction_participant, tablet().metrics()->transaction_conflicts.get(),
         [this, now](const Result<HybridTime>& result) {
           if (!result.ok()) {
@@ -461,13 +472,27 @@ CHECKED_STATUS WriteQuery::DoExecute() {
     }
   }
 
+  ResolveTransactionalConflicts(partial_range_key_intents);
+
+  return Status::OK();
+}
+
+void WriteQuery::ResolveTransactionalConflicts(
+    docdb::PartialRangeKeyIntents partial_range_key_intents) {
+  blockers_.clear();
   docdb::ResolveTransactionConflicts(
-      doc_ops_, write_batch, tablet().clock()->Now(),
+      doc_ops_, request().write_batch(), tablet().clock()->Now(),
       read_time_ ? read_time_.read : HybridTime::kMax,
       tablet().doc_db(), partial_range_key_intents,
-      transaction_participant, tablet().metrics()->transaction_conflicts.get(),
+      tablet().transaction_participant(), tablet().metrics()->transaction_conflicts.get(),
+      docdb::WaitQueuesEnabled() ? &blockers_ : nullptr,
       [this](const Result<HybridTime>& result) {
         if (!result.ok()) {
+          if (!blockers_.empty()) {
+            WaitForBlockers(result.status());
+            TRACE("WaitForBlockers");
+            return;
+          }
           ExecuteDone(result.status());
           TRACE("ExecuteDone");
           return;
@@ -475,7 +500,42 @@ CHECKED_STATUS WriteQuery::DoExecute() {
         TransactionalConflictsResolved();
         TRACE("TransactionalConflictsResolved");
       });
+}
+
+void WriteQuery::WaitForBlockers(const Status& conflict_status) {
+  auto transaction_id = FullyDecodeTransactionId(
+      request().write_batch().transaction().transaction_id());
+  if (!transaction_id.ok()) {
+    ExecuteDone(conflict_status);
+    return;
+  }
+
+  // Release locks and request scope while waiting, so neither blockers nor other requests to
+  // this tablet are delayed by this request.
+  prepare_result_.lock_batch.Unlock();
+  request_scope_ = RequestScope();
+  tablet().transaction_participant()->wait_queue().WaitOn(
+      *transaction_id, blockers_, deadline(), [this, conflict_status](const Status& status) {
+        if (!status.ok()) {
+          // When wait times out, respond with the original conflict, so client would retry.
+          ExecuteDone(status.IsTimedOut() ? conflict_status : status);
+          return;
+        }
+        auto resume_status = ResumeAfterWait();
+        if (!resume_status.ok()) {
+          ExecuteDone(resume_status);
+        }
+      });
+}
 
+CHECKED_STATUS WriteQuery::ResumeAfterWait() {
+  TRACE("ResumeAfterWait");
+  RETURN_NOT_OK(prepare_result_.lock_batch.Relock(deadline()));
+  request_scope_ = RequestScope(tablet().transaction_participant());
+  // Blockers are resolved, so resolve conflicts from scratch, since new conflicting intents could
+  // be written while we were waiting.
+  ResolveTransactionalConflicts(
+      docdb::PartialRangeKeyIntents(tablet().metadata()->UsePartialRangeKeyIntents()));
   return Status::OK();
 }
 
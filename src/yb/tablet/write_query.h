@@ -141,6 +141,13 @@ class WriteQuery {
 
   void NonTransactionalConflictsResolved(HybridTime now, HybridTime result);
 
+  void ResolveTransactionalConflicts(docdb::PartialRangeKeyIntents partial_range_key_intents);
+
+  // Parks this query in the wait queue until transactions in blockers_ are resolved.
+  void WaitForBlockers(const Status& conflict_status);
+
+  CHECKED_STATUS ResumeAfterWait();
+
   void TransactionalConflictsResolved();
 
   CHECKED_STATUS DoTransactionalConflictsResolved();
@@ -218,6 +225,8 @@ class WriteQuery {
   IsolationLevel isolation_level_;
   docdb::PrepareDocWriteOperationResult prepare_result_;
   RequestScope request_scope_;
+  // Transactions of higher priority that this query conflicts with, when wait queues are enabled.
+  TransactionIdSet blockers_;
   std::unique_ptr<WriteQuery> self_; // Keep self while Execute is performed.
 };
 
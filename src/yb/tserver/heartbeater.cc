@@ -32,6 +32,7 @@
 
 #include "yb/tserver/heartbeater.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <iosfwd>
 #include <map>
@@ -116,6 +117,9 @@ DEFINE_test_flag(bool, tserver_disable_heartbeat, false, "Should heartbeat be di
 TAG_FLAG(TEST_tserver_disable_heartbeat, runtime);
 
 DEFINE_CAPABILITY(TabletReportLimit, 0xb1a2a020);
+DECLARE_CAPABILITY(TransactionSealing);
+
+DECLARE_bool(enable_transaction_sealing);
 
 using google::protobuf::RepeatedPtrField;
 using yb::HostPortPB;
@@ -388,6 +392,12 @@ Status Heartbeater::Thread::TryHeartbeat() {
     RETURN_NOT_OK_PREPEND(SetupRegistration(req.mutable_registration()),
                           "Unable to set up registration");
     auto capabilities = Capabilities();
+    // Capability is registered by the client library, but sealing is supported only when enabled.
+    if (!FLAGS_enable_transaction_sealing) {
+      capabilities.erase(
+          std::remove(capabilities.begin(), capabilities.end(), CAPABILITY_TransactionSealing),
+          capabilities.end());
+    }
     *req.mutable_registration()->mutable_capabilities() =
         google::protobuf::RepeatedField<CapabilityId>(capabilities.begin(), capabilities.end());
   }
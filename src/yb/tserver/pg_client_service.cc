@@ -35,6 +35,7 @@
 #include "yb/rpc/scheduler.h"
 
 #include "yb/tserver/pg_client_session.h"
+#include "yb/tserver/pg_response_cache.h"
 
 #include "yb/util/net/net_util.h"
 #include "yb/util/result.h"
@@ -109,6 +110,14 @@ class ApplyToValue {
   Extractor extractor_;
 };
 
+template <class Resp>
+void Respond(const Status& status, Resp* resp, rpc::RpcContext* context) {
+  if (!status.ok()) {
+    StatusToPB(status, resp->mutable_status());
+  }
+  context->RespondSuccess();
+}
+
 class PgClientServiceImpl::Impl {
  public:
   explicit Impl(
@@ -136,7 +145,8 @@ class PgClientServiceImpl::Impl {
     resp->set_session_id(session_id);
     sessions_.emplace(
         FLAGS_pg_client_session_expiration_ms * 1ms,
-        std::make_shared<PgClientSession>(&client(), session_id));
+        std::make_shared<PgClientSession>(
+            &client(), transaction_pool_provider_, &response_cache_, session_id));
     return Status::OK();
   }
 
@@ -311,6 +321,16 @@ class PgClientServiceImpl::Impl {
 
   BOOST_PP_SEQ_FOR_EACH(PG_CLIENT_SESSION_METHOD_FORWARD, ~, PG_CLIENT_SESSION_METHODS);
 
+  void Perform(
+      const PgPerformRequestPB& req, PgPerformResponsePB* resp, rpc::RpcContext* context) {
+    auto session = GetSession(req);
+    if (!session.ok()) {
+      Respond(session.status(), resp, context);
+      return;
+    }
+    (*session)->Perform(req, resp, context);
+  }
+
  private:
   client::YBClient& client() { return *client_future_.get(); }
 
@@ -360,6 +380,7 @@ class PgClientServiceImpl::Impl {
 
   std::shared_future<client::YBClient*> client_future_;
   TransactionPoolProvider transaction_pool_provider_;
+  PgResponseCache response_cache_;
   std::mutex mutex_;
 
   class ExpirationTag;
@@ -396,14 +417,6 @@ PgClientServiceImpl::PgClientServiceImpl(
 
 PgClientServiceImpl::~PgClientServiceImpl() {}
 
-template <class Resp>
-void Respond(const Status& status, Resp* resp, rpc::RpcContext* context) {
-  if (!status.ok()) {
-    StatusToPB(status, resp->mutable_status());
-  }
-  context->RespondSuccess();
-}
-
 #define YB_PG_CLIENT_METHOD_DEFINE(r, data, method) \
 void PgClientServiceImpl::method( \
     const BOOST_PP_CAT(BOOST_PP_CAT(Pg, method), RequestPB)* req, \
@@ -414,5 +427,11 @@ void PgClientServiceImpl::method( \
 
 BOOST_PP_SEQ_FOR_EACH(YB_PG_CLIENT_METHOD_DEFINE, ~, YB_PG_CLIENT_METHODS);
 
+// Perform responds asynchronously, when all operations are done.
+void PgClientServiceImpl::Perform(
+    const PgPerformRequestPB* req, PgPerformResponsePB* resp, rpc::RpcContext context) {
+  impl_->Perform(*req, resp, &context);
+}
+
 }  // namespace tserver
 }  // namespace yb
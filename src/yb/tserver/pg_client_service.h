@@ -21,6 +21,7 @@
 #include "yb/rpc/rpc_fwd.h"
 
 #include "yb/tserver/pg_client.service.h"
+#include "yb/tserver/tserver_fwd.h"
 
 namespace yb {
 namespace tserver {
@@ -32,8 +33,6 @@ namespace tserver {
     (ListLiveTabletServers)(OpenTable)(ReserveOids)(TabletServerCount)(TruncateTable) \
     (ValidatePlacement)
 
-using TransactionPoolProvider = std::function<client::TransactionPool*()>;
-
 class PgClientServiceImpl : public PgClientServiceIf {
  public:
   explicit PgClientServiceImpl(
@@ -52,6 +51,9 @@ class PgClientServiceImpl : public PgClientServiceIf {
 
   BOOST_PP_SEQ_FOR_EACH(YB_PG_CLIENT_METHOD_DECLARE, ~, YB_PG_CLIENT_METHODS);
 
+  void Perform(
+      const PgPerformRequestPB* req, PgPerformResponsePB* resp, rpc::RpcContext context) override;
+
  private:
   class Impl;
 
@@ -14,15 +14,27 @@
 #include "yb/tserver/pg_client_session.h"
 
 #include "yb/client/client.h"
+#include "yb/client/error.h"
 #include "yb/client/namespace_alterer.h"
+#include "yb/client/session.h"
+#include "yb/client/table.h"
 #include "yb/client/table_alterer.h"
+#include "yb/client/transaction.h"
+#include "yb/client/transaction_manager.h"
+#include "yb/client/transaction_pool.h"
+#include "yb/client/yb_op.h"
 
+#include "yb/common/consistent_read_point.h"
 #include "yb/common/ql_type.h"
+#include "yb/common/wire_protocol.h"
+
+#include "yb/gutil/casts.h"
 
 #include "yb/rpc/rpc_context.h"
 
 #include "yb/tserver/pg_client.pb.h"
 #include "yb/tserver/pg_create_table.h"
+#include "yb/tserver/pg_response_cache.h"
 
 #include "yb/util/result.h"
 #include "yb/util/status_format.h"
@@ -30,8 +42,73 @@
 namespace yb {
 namespace tserver {
 
-PgClientSession::PgClientSession(client::YBClient* client, uint64_t id)
-    : client_(*client), id_(id) {
+namespace {
+
+// State of the Perform call, that should be alive until operations are flushed.
+struct PerformData {
+  PgPerformResponsePB* resp;
+  std::shared_ptr<rpc::RpcContext> context;
+  client::YBSessionPtr session;
+  client::YBTransactionPtr transaction;
+  HadReadTime had_read_time = HadReadTime::kFalse;
+  std::vector<std::shared_ptr<client::YBPgsqlOp>> ops;
+  // Stores response to the response cache, when it is cacheable.
+  PgResponseCache::Setter cache_setter;
+
+  void FlushDone(client::FlushStatus* flush_status) {
+    auto& responses = *resp->mutable_responses();
+    responses.Reserve(narrow_cast<int>(ops.size()));
+    std::unordered_map<const client::YBOperation*, PgPerformOpResponsePB*> op_responses;
+    for (const auto& op : ops) {
+      auto& op_resp = *responses.Add();
+      op_resp.mutable_response()->Swap(op->mutable_response());
+      op_resp.set_rows_data(op->rows_data());
+      if (op->type() == client::YBOperation::Type::PGSQL_READ) {
+        const auto& used_read_time = down_cast<client::YBPgsqlReadOp&>(*op).used_read_time();
+        if (used_read_time) {
+          used_read_time.ToPB(op_resp.mutable_used_read_time());
+        }
+      }
+      op_responses.emplace(op.get(), &op_resp);
+    }
+    for (const auto& error : flush_status->errors) {
+      auto it = op_responses.find(&error->failed_op());
+      if (it != op_responses.end()) {
+        StatusToPB(error->status(), it->second->mutable_error());
+      }
+    }
+
+    // Involved tablets should be passed to the parent transaction even if flush failed, so
+    // they are cleaned up when the parent transaction is aborted.
+    auto status = flush_status->status;
+    if (transaction) {
+      auto result = transaction->FinishChild();
+      if (result.ok()) {
+        resp->mutable_child_transaction_result()->Swap(result.get_ptr());
+      } else if (status.ok()) {
+        status = result.status();
+      }
+    } else {
+      session->read_point()->FinishChildTransactionResult(
+          had_read_time, resp->mutable_child_transaction_result());
+    }
+    if (!status.ok()) {
+      StatusToPB(status, resp->mutable_status());
+    }
+    if (cache_setter) {
+      cache_setter(*resp);
+    }
+    context->RespondSuccess();
+  }
+};
+
+} // namespace
+
+PgClientSession::PgClientSession(
+    client::YBClient* client, const TransactionPoolProvider& transaction_pool_provider,
+    PgResponseCache* response_cache, uint64_t id)
+    : client_(*client), transaction_pool_provider_(transaction_pool_provider),
+      response_cache_(*response_cache), id_(id) {
 }
 
 uint64_t PgClientSession::id() const {
@@ -175,6 +252,112 @@ Status PgClientSession::DropTablegroup(
   return status;
 }
 
+void PgClientSession::Perform(
+    const PgPerformRequestPB& req, PgPerformResponsePB* resp, rpc::RpcContext* context) {
+  auto shared_context = std::make_shared<rpc::RpcContext>(std::move(*context));
+  PgResponseCache::Setter cache_setter;
+  if (req.cached_catalog_version()) {
+    cache_setter = response_cache_.Get(
+        req.cached_catalog_version(), PgResponseCache::BuildKey(req),
+        [resp, shared_context](const PgPerformResponsePB& response) {
+      *resp = response;
+      shared_context->RespondSuccess();
+    });
+    if (!cache_setter) {
+      return;
+    }
+  }
+  auto status = DoPerform(req, resp, shared_context, &cache_setter);
+  if (!status.ok()) {
+    StatusToPB(status, resp->mutable_status());
+    if (cache_setter) {
+      cache_setter(*resp);
+    }
+    shared_context->RespondSuccess();
+  }
+}
+
+Status PgClientSession::DoPerform(
+    const PgPerformRequestPB& req, PgPerformResponsePB* resp,
+    const std::shared_ptr<rpc::RpcContext>& context, PgResponseCache::Setter* cache_setter) {
+  auto& transaction_manager = transaction_pool_provider_()->manager();
+  auto session = std::make_shared<client::YBSession>(&client(), transaction_manager.clock());
+  session->SetDeadline(context->GetClientDeadline());
+  session->SetForceConsistentRead(client::ForceConsistentRead::kTrue);
+
+  client::YBTransactionPtr transaction;
+  auto had_read_time = HadReadTime::kFalse;
+  const auto& child_data = req.child_transaction_data();
+  if (child_data.has_metadata()) {
+    transaction = std::make_shared<client::YBTransaction>(
+        &transaction_manager, VERIFY_RESULT(client::ChildTransactionData::FromPB(child_data)));
+    session->SetTransaction(transaction);
+  } else if (child_data.has_read_time()) {
+    ConsistentReadPoint::HybridTimeMap local_limits;
+    for (const auto& entry : child_data.local_limits()) {
+      local_limits.emplace(entry.first, HybridTime(entry.second));
+    }
+    session->read_point()->SetReadTime(
+        ReadHybridTime::FromReadTimePB(child_data), std::move(local_limits));
+    had_read_time = HadReadTime::kTrue;
+  }
+
+  std::vector<std::shared_ptr<client::YBPgsqlOp>> ops;
+  ops.reserve(req.ops().size());
+  for (const auto& op : req.ops()) {
+    if (op.has_read()) {
+      const auto& read = op.read();
+      auto table = VERIFY_RESULT(GetTable(read.table_id(), read.schema_version()));
+      std::shared_ptr<client::YBPgsqlReadOp> read_op = client::YBPgsqlReadOp::NewSelect(table);
+      *read_op->mutable_request() = read;
+      if (op.read_from_followers()) {
+        read_op->set_yb_consistency_level(YBConsistencyLevel::CONSISTENT_PREFIX);
+      }
+      ops.push_back(std::move(read_op));
+    } else if (op.has_write()) {
+      const auto& write = op.write();
+      auto table = VERIFY_RESULT(GetTable(write.table_id(), write.schema_version()));
+      auto write_op = std::make_shared<client::YBPgsqlWriteOp>(table);
+      *write_op->mutable_request() = write;
+      write_op->set_is_single_row_txn(op.is_single_row_txn());
+      write_op->set_check_read_time_conflicts(op.check_read_time_conflicts());
+      ops.push_back(std::move(write_op));
+    } else {
+      return STATUS_FORMAT(InvalidArgument, "Operation without request: $0", op.ShortDebugString());
+    }
+  }
+
+  for (const auto& op : ops) {
+    session->Apply(op);
+  }
+
+  // Context is responded only when flush is done.
+  auto data = std::make_shared<PerformData>();
+  data->resp = resp;
+  data->context = context;
+  data->cache_setter = std::move(*cache_setter);
+  data->session = session;
+  data->transaction = std::move(transaction);
+  data->had_read_time = had_read_time;
+  data->ops = std::move(ops);
+  session->FlushAsync([data](client::FlushStatus* flush_status) {
+    data->FlushDone(flush_status);
+  });
+  return Status::OK();
+}
+
+Result<client::YBTablePtr> PgClientSession::GetTable(
+    const TableId& table_id, uint32_t schema_version) {
+  auto it = tables_.find(table_id);
+  if (it != tables_.end() && it->second->schema().version() == schema_version) {
+    return it->second;
+  }
+  // Table is not known yet, or was altered since it was opened.
+  auto table = VERIFY_RESULT(client().OpenTable(table_id));
+  tables_[table_id] = table;
+  return table;
+}
+
 Result<const TransactionMetadata*> PgClientSession::GetDdlTransactionMetadata(
     const TransactionMetadataPB& metadata) {
   if (!metadata.has_transaction_id()) {
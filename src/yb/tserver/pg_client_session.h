@@ -21,6 +21,7 @@
 #include <set>
 #include <string>
 #include <type_traits>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 
@@ -36,6 +37,7 @@
 
 #include "yb/tserver/tserver_fwd.h"
 #include "yb/tserver/pg_client.fwd.h"
+#include "yb/tserver/pg_response_cache.h"
 
 namespace yb {
 namespace tserver {
@@ -46,10 +48,17 @@ namespace tserver {
 
 class PgClientSession {
  public:
-  PgClientSession(client::YBClient* client, uint64_t id);
+  PgClientSession(
+      client::YBClient* client, const TransactionPoolProvider& transaction_pool_provider,
+      PgResponseCache* response_cache, uint64_t id);
 
   uint64_t id() const;
 
+  // Performs DML operations of the backend asynchronously. Operations are executed as a child of
+  // the transaction (or the read point) of the backend, and context is responded after all of
+  // them are done.
+  void Perform(const PgPerformRequestPB& req, PgPerformResponsePB* resp, rpc::RpcContext* context);
+
   #define PG_CLIENT_SESSION_METHOD_DECLARE(r, data, method) \
   CHECKED_STATUS method( \
       const BOOST_PP_CAT(BOOST_PP_CAT(Pg, method), RequestPB)& req, \
@@ -66,10 +75,20 @@ class PgClientSession {
 
   client::YBClient& client();
 
+  CHECKED_STATUS DoPerform(
+      const PgPerformRequestPB& req, PgPerformResponsePB* resp,
+      const std::shared_ptr<rpc::RpcContext>& context, PgResponseCache::Setter* cache_setter);
+
+  Result<client::YBTablePtr> GetTable(const TableId& table_id, uint32_t schema_version);
+
   client::YBClient& client_;
+  const TransactionPoolProvider& transaction_pool_provider_;
+  PgResponseCache& response_cache_;
   const uint64_t id_;
 
   std::mutex mutex_;
+  // Tables used by DML operations of this session.
+  std::unordered_map<TableId, client::YBTablePtr> tables_;
   TransactionMetadata last_txn_metadata_; // TODO(PG_CLIENT) Remove after migration.
 };
 
@@ -0,0 +1,185 @@
+// Copyright (c) YugaByte, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+// in compliance with the License.  You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied.  See the License for the specific language governing permissions and limitations
+// under the License.
+//
+
+#include "yb/tserver/pg_response_cache.h"
+
+#include "yb/tserver/pg_client.pb.h"
+
+#include "yb/util/flag_tags.h"
+#include "yb/util/logging.h"
+
+using namespace std::literals;
+
+DEFINE_int32(pg_response_cache_capacity, 1024,
+             "Max number of catalog read responses cached by tablet server for Postgres backends. "
+             "0 disables the cache.");
+TAG_FLAG(pg_response_cache_capacity, advanced);
+TAG_FLAG(pg_response_cache_capacity, runtime);
+
+DEFINE_int32(pg_response_cache_lifetime_ms, 10000,
+             "Time in milliseconds during which cached catalog read response could be returned to "
+             "Postgres backends. DDL that does not change catalog version becomes visible to new "
+             "backends only after responses that were read before it expire.");
+TAG_FLAG(pg_response_cache_lifetime_ms, advanced);
+TAG_FLAG(pg_response_cache_lifetime_ms, runtime);
+
+namespace yb {
+namespace tserver {
+
+namespace {
+
+bool IsSuccess(const PgPerformResponsePB& response) {
+  if (response.has_status()) {
+    return false;
+  }
+  for (const auto& op_response : response.responses()) {
+    if (op_response.has_error() ||
+        op_response.response().status() != PgsqlResponsePB::PGSQL_STATUS_OK) {
+      return false;
+    }
+  }
+  return true;
+}
+
+} // namespace
+
+struct PgResponseCache::Entry {
+  // Whether response is already received.
+  bool ready = false;
+  CoarseTimePoint expiration;
+  std::shared_ptr<const PgPerformResponsePB> response;
+  std::vector<Callback> waiters;
+};
+
+PgResponseCache::PgResponseCache() = default;
+
+PgResponseCache::~PgResponseCache() = default;
+
+std::string PgResponseCache::BuildKey(const PgPerformRequestPB& req) {
+  const auto& child_data = req.child_transaction_data();
+  if (child_data.has_metadata() || !child_data.local_limits().empty() || req.ops().empty()) {
+    return std::string();
+  }
+  std::string result;
+  if (child_data.has_read_time()) {
+    child_data.read_time().AppendToString(&result);
+  }
+  PgsqlReadRequestPB read;
+  for (const auto& op : req.ops()) {
+    if (!op.has_read() || op.read_from_followers()) {
+      return std::string();
+    }
+    // Statement id is specific to backend and does not affect response.
+    read = op.read();
+    read.clear_stmt_id();
+    result += '\0';
+    read.AppendToString(&result);
+  }
+  return result;
+}
+
+PgResponseCache::Setter PgResponseCache::Get(
+    uint64_t catalog_version, const std::string& key, Callback callback) {
+  static const Setter kNoCaching = [](const PgPerformResponsePB&) {};
+
+  const auto capacity = FLAGS_pg_response_cache_capacity;
+  if (capacity <= 0 || key.empty()) {
+    return kNoCaching;
+  }
+
+  const auto now = CoarseMonoClock::now();
+  std::shared_ptr<const PgPerformResponsePB> response;
+  EntryPtr entry;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (catalog_version > catalog_version_) {
+      // Responses read with the previous catalog version are not used anymore. Requests in flight
+      // still notify their waiters.
+      entries_.clear();
+      catalog_version_ = catalog_version;
+    } else if (catalog_version < catalog_version_) {
+      // Backend did not catch up with the latest catalog version yet.
+      return kNoCaching;
+    }
+
+    auto it = entries_.find(key);
+    if (it != entries_.end()) {
+      auto& existing = *it->second;
+      if (!existing.ready) {
+        existing.waiters.push_back(std::move(callback));
+        return Setter();
+      }
+      if (now < existing.expiration) {
+        response = existing.response;
+      } else {
+        entries_.erase(it);
+      }
+    }
+
+    if (!response) {
+      if (entries_.size() >= static_cast<size_t>(capacity)) {
+        EvictExpired(now);
+        if (entries_.size() >= static_cast<size_t>(capacity)) {
+          return kNoCaching;
+        }
+      }
+      entry = std::make_shared<Entry>();
+      entries_.emplace(key, entry);
+    }
+  }
+
+  if (response) {
+    VLOG(4) << "Catalog read response served from cache";
+    callback(*response);
+    return Setter();
+  }
+
+  return [this, key, entry](const PgPerformResponsePB& response) {
+    Set(key, entry, response);
+  };
+}
+
+void PgResponseCache::Set(
+    const std::string& key, const EntryPtr& entry, const PgPerformResponsePB& response) {
+  std::vector<Callback> waiters;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    waiters.swap(entry->waiters);
+    auto it = entries_.find(key);
+    const bool cached = it != entries_.end() && it->second == entry;
+    if (IsSuccess(response)) {
+      entry->response = std::make_shared<PgPerformResponsePB>(response);
+      entry->expiration = CoarseMonoClock::now() + FLAGS_pg_response_cache_lifetime_ms * 1ms;
+      entry->ready = true;
+    } else if (cached) {
+      // Failed responses are not cached, but sessions that waited for it receive the same failure.
+      entries_.erase(it);
+    }
+  }
+  for (const auto& waiter : waiters) {
+    waiter(response);
+  }
+}
+
+void PgResponseCache::EvictExpired(CoarseTimePoint now) {
+  for (auto it = entries_.begin(); it != entries_.end();) {
+    if (it->second->ready && it->second->expiration <= now) {
+      it = entries_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
+}  // namespace tserver
+}  // namespace yb
@@ -0,0 +1,76 @@
+// Copyright (c) YugaByte, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+// in compliance with the License.  You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied.  See the License for the specific language governing permissions and limitations
+// under the License.
+//
+
+#ifndef YB_TSERVER_PG_RESPONSE_CACHE_H
+#define YB_TSERVER_PG_RESPONSE_CACHE_H
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "yb/tserver/pg_client.fwd.h"
+
+#include "yb/util/monotime.h"
+#include "yb/util/thread_annotations.h"
+
+namespace yb {
+namespace tserver {
+
+// Tablet server wide cache of responses to catalog reads, that backends perform while loading
+// their catalog caches. After connect or catalog version change all backends of the node read the
+// same catalog data, so it is read once and the response is shared by all of them. Identical
+// reads that arrive while the first one is in flight wait for its response.
+//
+// Responses are keyed by the catalog version, the read time and the read requests. The first read
+// of the catalog has no read time, so the backend picks up the read time of the cached response,
+// and its further reads use responses produced at the same read time. So each backend sees a
+// consistent snapshot of the catalog.
+class PgResponseCache {
+ public:
+  using Callback = std::function<void(const PgPerformResponsePB&)>;
+  // Invoked with the response of performed request, exactly once.
+  using Setter = std::function<void(const PgPerformResponsePB&)>;
+
+  PgResponseCache();
+  ~PgResponseCache();
+
+  PgResponseCache(const PgResponseCache&) = delete;
+  void operator=(const PgResponseCache&) = delete;
+
+  // Returns key for the request, or empty string when response to request could not be cached.
+  static std::string BuildKey(const PgPerformRequestPB& req);
+
+  // When response for the key is cached or is being read by another session, callback is invoked
+  // with this response, possibly later, and null setter is returned. Otherwise the caller should
+  // perform the request itself and pass its response to the returned setter.
+  Setter Get(uint64_t catalog_version, const std::string& key, Callback callback);
+
+ private:
+  struct Entry;
+  using EntryPtr = std::shared_ptr<Entry>;
+
+  void Set(const std::string& key, const EntryPtr& entry, const PgPerformResponsePB& response);
+  void EvictExpired(CoarseTimePoint now) REQUIRES(mutex_);
+
+  std::mutex mutex_;
+  uint64_t catalog_version_ GUARDED_BY(mutex_) = 0;
+  std::unordered_map<std::string, EntryPtr> entries_ GUARDED_BY(mutex_);
+};
+
+}  // namespace tserver
+}  // namespace yb
+
+#endif  // YB_TSERVER_PG_RESPONSE_CACHE_H
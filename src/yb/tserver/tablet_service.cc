@@ -1037,6 +1037,70 @@ void TabletServiceImpl::UpdateTransaction(const UpdateTransactionRequestPB* req,
   }
 }
 
+void TabletServiceImpl::HeartbeatTransactions(const HeartbeatTransactionsRequestPB* req,
+                                              HeartbeatTransactionsResponsePB* resp,
+                                              rpc::RpcContext context) {
+  TRACE("HeartbeatTransactions");
+
+  VLOG(1) << "HeartbeatTransactions: " << req->tablet_id() << ", transactions: "
+          << req->transaction_id().size() << ", context: " << context.ToString();
+  UpdateClock(*req, server_->Clock());
+
+  auto tablet = LookupLeaderTabletOrRespond(
+      server_->tablet_peer_lookup(), req->tablet_id(), resp, &context);
+  if (!tablet) {
+    return;
+  }
+
+  auto* coordinator = tablet.tablet->transaction_coordinator();
+  if (!coordinator) {
+    SetupErrorAndRespond(
+        resp->mutable_error(),
+        STATUS(InvalidArgument, "Does not have transaction coordinator to process heartbeats"),
+        &context);
+    return;
+  }
+
+  // Each heartbeat is handled by coordinator as a separate PENDING update, response is sent
+  // when all of them are completed.
+  struct HeartbeatsState {
+    explicit HeartbeatsState(rpc::RpcContext context_) : context(std::move(context_)) {}
+
+    rpc::RpcContext context;
+    std::vector<tablet::TransactionStatePB> states;
+    std::atomic<size_t> pending{0};
+  };
+
+  const auto num_heartbeats = req->transaction_id().size();
+  for (int i = 0; i != num_heartbeats; ++i) {
+    resp->add_status();
+  }
+  if (num_heartbeats == 0) {
+    resp->set_propagated_hybrid_time(server_->Clock()->Now().ToUint64());
+    context.RespondSuccess();
+    return;
+  }
+
+  auto heartbeats_state = std::make_shared<HeartbeatsState>(std::move(context));
+  heartbeats_state->states.resize(num_heartbeats);
+  heartbeats_state->pending.store(num_heartbeats, std::memory_order_release);
+  for (int i = 0; i != num_heartbeats; ++i) {
+    auto& state = heartbeats_state->states[i];
+    state.set_transaction_id(req->transaction_id(i));
+    state.set_status(TransactionStatus::PENDING);
+    auto operation = std::make_unique<tablet::UpdateTxnOperation>(tablet.tablet.get(), &state);
+    operation->set_completion_callback(
+        [heartbeats_state, resp, i, clock = server_->Clock()](const Status& status) {
+      StatusToPB(status, resp->mutable_status(i));
+      if (heartbeats_state->pending.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        resp->set_propagated_hybrid_time(clock->Now().ToUint64());
+        heartbeats_state->context.RespondSuccess();
+      }
+    });
+    coordinator->Handle(std::move(operation), tablet.leader_term);
+  }
+}
+
 template <class Req, class Resp, class Action>
 void TabletServiceImpl::PerformAtLeader(
     const Req& req, Resp* resp, rpc::RpcContext* context, const Action& action) {
@@ -117,6 +117,10 @@ class TabletServiceImpl : public TabletServerServiceIf, public ReadTabletProvide
                          UpdateTransactionResponsePB* resp,
                          rpc::RpcContext context) override;
 
+  void HeartbeatTransactions(const HeartbeatTransactionsRequestPB* req,
+                             HeartbeatTransactionsResponsePB* resp,
+                             rpc::RpcContext context) override;
+
   void GetTransactionStatus(const GetTransactionStatusRequestPB* req,
                             GetTransactionStatusResponsePB* resp,
                             rpc::RpcContext context) override;
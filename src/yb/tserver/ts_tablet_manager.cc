@@ -77,6 +77,8 @@
 
 #include "yb/tablet/metadata.pb.h"
 #include "yb/tablet/operations/split_operation.h"
+#include "yb/tablet/resolved_transactions_cache.h"
+#include "yb/tablet/transaction_status_batcher.h"
 #include "yb/tablet/tablet.h"
 #include "yb/tablet/tablet.pb.h"
 #include "yb/tablet/tablet_bootstrap_if.h"
@@ -110,6 +112,9 @@
 using namespace std::literals;
 using namespace std::placeholders;
 
+DECLARE_uint64(transaction_status_cache_capacity);
+DECLARE_bool(transaction_status_batching);
+
 DEFINE_int32(num_tablets_to_open_simultaneously, 0,
              "Number of threads available to open tablets during startup. If this "
              "is set to 0 (the default), then the number of bootstrap threads will "
@@ -416,6 +421,14 @@ Status TSTabletManager::Init() {
   if (docdb::GetRocksDBRateLimiterSharingMode() == docdb::RateLimiterSharingMode::TSERVER) {
     tablet_options_.rate_limiter = docdb::CreateRocksDBRateLimiter();
   }
+  if (FLAGS_transaction_status_cache_capacity > 0) {
+    tablet_options_.resolved_transactions_cache =
+        std::make_shared<tablet::ResolvedTransactionsCache>();
+  }
+  if (FLAGS_transaction_status_batching) {
+    tablet_options_.transaction_status_batcher =
+        std::make_shared<tablet::TransactionStatusBatcher>();
+  }
 
   // Start the threadpool we'll use to open tablets.
   // This has to be done in Init() instead of the constructor, since the
@@ -1551,6 +1564,10 @@ void TSTabletManager::CompleteShutdown() {
     peer->CompleteShutdown();
   }
 
+  if (tablet_options_.transaction_status_batcher) {
+    tablet_options_.transaction_status_batcher->Shutdown();
+  }
+
   // Shut down the apply pool.
   apply_pool_->Shutdown();
 
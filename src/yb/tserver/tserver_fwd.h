@@ -14,6 +14,10 @@
 #ifndef YB_TSERVER_TSERVER_FWD_H
 #define YB_TSERVER_TSERVER_FWD_H
 
+#include <functional>
+
+#include "yb/client/client_fwd.h"
+
 #include "yb/tserver/backup.fwd.h"
 #include "yb/tserver/tserver.fwd.h"
 #include "yb/tserver/tserver_service.fwd.h"
@@ -48,6 +52,8 @@ enum class TabletServerServiceRpcMethodIndexes;
 
 YB_STRONGLY_TYPED_BOOL(AllowSplitTablet);
 
+using TransactionPoolProvider = std::function<client::TransactionPool*()>;
+
 } // namespace tserver
 } // namespace yb
 
@@ -128,6 +128,20 @@ class RandomAccessFile : public FileWithUniqueId {
 
   CHECKED_STATUS Read(uint64_t offset, size_t n, Slice* result, char* scratch);
 
+  struct ReadRequest {
+    uint64_t offset;
+    size_t size;
+    // Should have at least size bytes, result could point to it after read.
+    uint8_t* scratch;
+    Slice result;
+  };
+
+  // Reads a batch of ranges of the file, filling result of every request. Implementations could
+  // issue the whole batch at once, default implementation reads requests one by one.
+  //
+  // Safe for concurrent use by multiple threads.
+  virtual CHECKED_STATUS MultiRead(ReadRequest* requests, size_t num_requests) const;
+
   // Returns the size of the file
   virtual Result<uint64_t> Size() const = 0;
 
@@ -19,6 +19,9 @@
 #include <sys/stat.h>
 #include <sys/types.h>
 
+#include <algorithm>
+#include <vector>
+
 #ifdef __linux__
 #include <linux/fs.h>
 #include <sys/statfs.h>
@@ -69,6 +72,11 @@ int Fadvise(int fd, off_t offset, size_t len, int advice) {
 #define STATUS_IO_ERROR(context, err_number) \
     STATUS_FROM_ERRNO_SPECIAL_EIO_HANDLING(context, err_number)
 
+// Requests of MultiRead separated by at most this number of bytes are merged into a single read.
+constexpr uint64_t kMultiReadMaxGap = 16 * 1024;
+// Max size of a single read issued by MultiRead for merged requests.
+constexpr uint64_t kMultiReadMaxMergedSize = 1024 * 1024;
+
 } // namespace
 
 #if defined(__linux__)
@@ -194,6 +202,55 @@ Status PosixRandomAccessFile::Read(uint64_t offset, size_t n, Slice* result,
   return s;
 }
 
+Status PosixRandomAccessFile::MultiRead(ReadRequest* requests, size_t num_requests) const {
+  std::vector<ReadRequest*> sorted_requests;
+  sorted_requests.reserve(num_requests);
+  for (auto* request = requests; request != requests + num_requests; ++request) {
+    sorted_requests.push_back(request);
+  }
+  std::sort(sorted_requests.begin(), sorted_requests.end(), [](auto* lhs, auto* rhs) {
+    return lhs->offset < rhs->offset;
+  });
+
+  std::unique_ptr<uint8_t[]> buffer;
+  size_t buffer_size = 0;
+  auto it = sorted_requests.begin();
+  while (it != sorted_requests.end()) {
+    const uint64_t start = (*it)->offset;
+    uint64_t end = start + (*it)->size;
+    auto group_end = it + 1;
+    while (group_end != sorted_requests.end() &&
+           (*group_end)->offset <= end + kMultiReadMaxGap &&
+           std::max(end, (*group_end)->offset + (*group_end)->size) - start <=
+               kMultiReadMaxMergedSize) {
+      end = std::max(end, (*group_end)->offset + (*group_end)->size);
+      ++group_end;
+    }
+
+    if (group_end == it + 1) {
+      RETURN_NOT_OK(Read(start, (*it)->size, &(*it)->result, (*it)->scratch));
+    } else {
+      const size_t size = end - start;
+      if (buffer_size < size) {
+        buffer.reset(new uint8_t[size]);
+        buffer_size = size;
+      }
+      Slice data;
+      RETURN_NOT_OK(Read(start, size, &data, buffer.get()));
+      for (auto request_it = it; request_it != group_end; ++request_it) {
+        auto& request = **request_it;
+        const size_t begin = request.offset - start;
+        const size_t available =
+            data.size() > begin ? std::min<size_t>(data.size() - begin, request.size) : 0;
+        memcpy(request.scratch, data.data() + begin, available);
+        request.result = Slice(request.scratch, available);
+      }
+    }
+    it = group_end;
+  }
+  return Status::OK();
+}
+
 Result<uint64_t> PosixRandomAccessFile::Size() const {
   TRACE_EVENT1("io", __PRETTY_FUNCTION__, "path", filename_);
   ThreadRestrictions::AssertIOAllowed();
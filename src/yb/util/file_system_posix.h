@@ -50,6 +50,10 @@ class PosixRandomAccessFile : public RandomAccessFile {
   virtual CHECKED_STATUS Read(uint64_t offset, size_t n, Slice* result,
                       uint8_t* scratch) const override;
 
+  // Requests that are close to each other are merged into a single read, so batch is served with
+  // fewer system calls.
+  CHECKED_STATUS MultiRead(ReadRequest* requests, size_t num_requests) const override;
+
   Result<uint64_t> Size() const override;
 
   Result<uint64_t> INode() const override;
@@ -64,7 +68,7 @@ class PosixRandomAccessFile : public RandomAccessFile {
   virtual void Hint(AccessPattern pattern) override;
   virtual CHECKED_STATUS InvalidateCache(size_t offset, size_t length) override;
 
- private:
+ protected:
   std::string filename_;
   int fd_;
   bool use_os_buffer_;
@@ -44,6 +44,8 @@ namespace ql {
 namespace {
 
 const std::string kCompactionClassPrefix = "org.apache.cassandra.db.compaction.";
+const std::string kTimeWindowCompactionClass =
+    kCompactionClassPrefix + "TimeWindowCompactionStrategy";
 
 }
 
@@ -520,10 +522,12 @@ Status PTTablePropertyMap::SetTableProperty(yb::TableProperties *table_property)
   }
   switch (iterator->second) {
     case PropertyMapType::kCaching: FALLTHROUGH_INTENDED;
-    case PropertyMapType::kCompaction: FALLTHROUGH_INTENDED;
     case PropertyMapType::kCompression:
       LOG(WARNING) << "Ignoring table property " << table_property_name;
       break;
+    case PropertyMapType::kCompaction:
+      RETURN_NOT_OK(SetCompactionTableProperty(table_property));
+      break;
     case PropertyMapType::kTransactions:
       for (const auto& subproperty : map_elements_->node_list()) {
         string subproperty_name;
@@ -551,6 +555,68 @@ Status PTTablePropertyMap::SetTableProperty(yb::TableProperties *table_property)
   return Status::OK();
 }
 
+Status PTTablePropertyMap::SetCompactionTableProperty(yb::TableProperties *table_property) const {
+  // Only TimeWindowCompactionStrategy is mapped to DocDB time-window compaction. Other strategies
+  // are accepted for compatibility and switch table back to the default compaction. Time windows
+  // are used only by tables with default_time_to_live, and only when tablet servers have
+  // tablet_enable_ttl_file_filter set.
+  bool is_time_window_strategy = false;
+  int64_t window_size = 1;
+  string window_unit = "days";
+  for (const auto& subproperty : map_elements_->node_list()) {
+    string subproperty_name;
+    ToLowerCase(subproperty->lhs()->c_str(), &subproperty_name);
+    if (subproperty_name == "class") {
+      string class_name;
+      RETURN_NOT_OK(GetStringValueFromExpr(subproperty->rhs(), false, subproperty_name,
+                                           &class_name));
+      if (class_name.find('.') == string::npos) {
+        class_name.insert(0, kCompactionClassPrefix);
+      }
+      is_time_window_strategy = class_name == kTimeWindowCompactionClass;
+      continue;
+    }
+    auto iter = Compaction::kSubpropertyDataTypes.find(subproperty_name);
+    DCHECK(iter != Compaction::kSubpropertyDataTypes.end());
+    switch (iter->second) {
+      case Compaction::Subproperty::kCompactionWindowSize:
+        RETURN_NOT_OK(GetIntValueFromExpr(subproperty->rhs(), subproperty_name, &window_size));
+        break;
+      case Compaction::Subproperty::kCompactionWindowUnit:
+        RETURN_NOT_OK(GetStringValueFromExpr(subproperty->rhs(), true, subproperty_name,
+                                             &window_unit));
+        break;
+      default:
+        break;
+    }
+  }
+
+  if (!is_time_window_strategy) {
+    table_property->SetCompactionTimeWindow(0);
+    return Status::OK();
+  }
+
+  if (window_size <= 0) {
+    return STATUS(InvalidArgument, Substitute(
+        "Invalid value for compaction_window_size: $0, it should be positive", window_size));
+  }
+  int64_t unit_seconds;
+  if (window_unit == "minutes") {
+    unit_seconds = MonoTime::kSecondsPerMinute;
+  } else if (window_unit == "hours") {
+    unit_seconds = 60 * MonoTime::kSecondsPerMinute;
+  } else if (window_unit == "days") {
+    unit_seconds = 24 * 60 * MonoTime::kSecondsPerMinute;
+  } else {
+    return STATUS(InvalidArgument, Substitute(
+        "Invalid value for compaction_window_unit: $0, it should be one of minutes, hours, days",
+        window_unit));
+  }
+  table_property->SetCompactionTimeWindow(
+      window_size * unit_seconds * MonoTime::kMillisecondsPerSecond);
+  return Status::OK();
+}
+
 Status PTTablePropertyMap::AnalyzeCompaction() {
   vector<string> invalid_subproperties;
   vector<PTTableProperty::SharedPtr> subproperties;
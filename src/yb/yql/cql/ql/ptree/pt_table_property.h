@@ -212,6 +212,8 @@ class PTTablePropertyMap : public PTTableProperty {
   Status AnalyzeCompression();
   Status AnalyzeTransactions(SemContext *sem_context);
 
+  Status SetCompactionTableProperty(yb::TableProperties *table_property) const;
+
   static const std::map<std::string, PTTablePropertyMap::PropertyMapType> kPropertyDataTypes;
   TreeListNode<PTTableProperty>::SharedPtr map_elements_;
 };
@@ -13,6 +13,9 @@
 //
 //--------------------------------------------------------------------------------------------------
 
+#include "yb/master/catalog_manager_if.h"
+#include "yb/master/master_ddl.pb.h"
+
 #include "yb/yql/cql/ql/test/ql-test-base.h"
 
 namespace yb {
@@ -72,5 +75,43 @@ TEST_F(QLTestBase, TestQLAlterTableRemoveIndexedColumnExpr) {
   EXEC_VALID_STMT("ALTER TABLE t DROP v;");
 }
 
+TEST_F(QLTestBase, TestQLAlterTableKeepsCompactionTimeWindow) {
+  // Init the simulated cluster.
+  ASSERT_NO_FATALS(CreateSimulatedCluster());
+
+  // Get an available processor.
+  TestQLProcessor *processor = GetQLProcessor();
+
+  EXEC_VALID_STMT("CREATE TABLE t(h int PRIMARY KEY, v int) WITH default_time_to_live = 100 AND "
+                  "compaction = { 'class' : 'TimeWindowCompactionStrategy', "
+                  "'compaction_window_size' : 2, 'compaction_window_unit' : 'HOURS' };");
+
+  auto get_table_properties = [this]() -> Result<TablePropertiesPB> {
+    master::GetTableSchemaRequestPB request_pb;
+    master::GetTableSchemaResponsePB response_pb;
+    request_pb.mutable_table()->mutable_namespace_()->set_name(kDefaultKeyspaceName);
+    request_pb.mutable_table()->set_table_name("t");
+    RETURN_NOT_OK(cluster_->mini_master()->catalog_manager().GetTableSchema(
+        &request_pb, &response_pb));
+    return response_pb.schema().table_properties();
+  };
+  constexpr uint64_t kTimeWindowMs = 2 * 60 * 60 * 1000;
+  ASSERT_EQ(ASSERT_RESULT(get_table_properties()).compaction_time_window_ms(), kTimeWindowMs);
+
+  // Altering other property does not reset the time window.
+  EXEC_VALID_STMT("ALTER TABLE t WITH default_time_to_live = 200;");
+  auto properties = ASSERT_RESULT(get_table_properties());
+  ASSERT_EQ(properties.default_time_to_live(), 200 * 1000);
+  ASSERT_EQ(properties.compaction_time_window_ms(), kTimeWindowMs);
+
+  // Other compaction strategy disables time windows.
+  EXEC_VALID_STMT("ALTER TABLE t WITH compaction = { 'class' : 'SizeTieredCompactionStrategy' };");
+  ASSERT_EQ(ASSERT_RESULT(get_table_properties()).compaction_time_window_ms(), 0);
+
+  EXEC_INVALID_STMT("ALTER TABLE t WITH compaction = { "
+                    "'class' : 'TimeWindowCompactionStrategy', "
+                    "'compaction_window_unit' : 'WEEKS' };");
+}
+
 } // namespace ql
 } // namespace yb
@@ -242,6 +242,18 @@ class PgClient::Impl {
     return ResponseStatus(resp);
   }
 
+  void PerformAsync(
+      tserver::PgPerformRequestPB* req, CoarseTimePoint deadline, PerformCallback callback) {
+    req->set_session_id(session_id_);
+    // Each call uses its own controller and response, since calls could be sent concurrently.
+    auto data = std::make_shared<PerformData>();
+    data->callback = std::move(callback);
+    SetupAdminController(&data->controller, deadline);
+    proxy_->PerformAsync(*req, &data->resp, &data->controller, [data] {
+      data->callback(data->controller.status(), &data->resp);
+    });
+  }
+
   #define YB_PG_CLIENT_SIMPLE_METHOD_IMPL(r, data, method) \
   CHECKED_STATUS method( \
       tserver::BOOST_PP_CAT(BOOST_PP_CAT(Pg, method), RequestPB)* req, \
@@ -256,6 +268,12 @@ class PgClient::Impl {
   BOOST_PP_SEQ_FOR_EACH(YB_PG_CLIENT_SIMPLE_METHOD_IMPL, ~, YB_PG_CLIENT_SIMPLE_METHODS);
 
  private:
+  struct PerformData {
+    rpc::RpcController controller;
+    tserver::PgPerformResponsePB resp;
+    PerformCallback callback;
+  };
+
   static rpc::RpcController* SetupAdminController(
       rpc::RpcController* controller, CoarseTimePoint deadline = CoarseTimePoint()) {
     if (deadline != CoarseTimePoint()) {
@@ -353,6 +371,11 @@ Status PgClient::ValidatePlacement(const tserver::PgValidatePlacementRequestPB*
   return impl_->ValidatePlacement(req);
 }
 
+void PgClient::PerformAsync(
+    tserver::PgPerformRequestPB* req, CoarseTimePoint deadline, PerformCallback callback) {
+  impl_->PerformAsync(req, deadline, std::move(callback));
+}
+
 #define YB_PG_CLIENT_SIMPLE_METHOD_DEFINE(r, data, method) \
 Status PgClient::method( \
     tserver::BOOST_PP_CAT(BOOST_PP_CAT(Pg, method), RequestPB)* req, \
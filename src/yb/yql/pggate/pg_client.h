@@ -14,6 +14,7 @@
 #ifndef YB_YQL_PGGATE_PG_CLIENT_H
 #define YB_YQL_PGGATE_PG_CLIENT_H
 
+#include <functional>
 #include <memory>
 #include <string>
 
@@ -43,6 +44,9 @@ namespace pggate {
     (AlterDatabase)(AlterTable)(CreateDatabase)(CreateTable)(CreateTablegroup) \
     (DropDatabase)(DropTablegroup)(TruncateTable)
 
+// Invoked with status of the RPC and response, when Perform call is done.
+using PerformCallback = std::function<void(const Status&, tserver::PgPerformResponsePB*)>;
+
 class PgClient {
  public:
   PgClient();
@@ -76,6 +80,11 @@ class PgClient {
 
   CHECKED_STATUS ValidatePlacement(const tserver::PgValidatePlacementRequestPB* req);
 
+  // Sends DML operations to be performed by the local tablet server. Several Perform calls could
+  // be in progress at the same time.
+  void PerformAsync(
+      tserver::PgPerformRequestPB* req, CoarseTimePoint deadline, PerformCallback callback);
+
 #define YB_PG_CLIENT_SIMPLE_METHOD_DECLARE(r, data, method) \
   CHECKED_STATUS method(                             \
       tserver::BOOST_PP_CAT(BOOST_PP_CAT(Pg, method), RequestPB)* req, \
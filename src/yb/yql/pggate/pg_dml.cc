@@ -387,13 +387,19 @@ Result<bool> PgDml::GetNextRow(PgTuple *pg_tuple) {
 
 bool PgDml::has_aggregate_targets() {
   size_t num_aggregate_targets = 0;
+  size_t num_colref_targets = 0;
   for (const auto& target : targets_) {
     if (target->is_aggregate()) {
       num_aggregate_targets++;
+    } else if (target->is_colref()) {
+      num_colref_targets++;
     }
   }
 
-  CHECK(num_aggregate_targets == 0 || num_aggregate_targets == targets_.size())
+  // Column references could be selected along with aggregates only as grouping columns.
+  const size_t num_grouping_targets = has_group_by() ? num_colref_targets : 0;
+  CHECK(num_aggregate_targets == 0 ||
+        num_aggregate_targets + num_grouping_targets == targets_.size())
     << "Some, but not all, targets are aggregate expressions.";
 
   return num_aggregate_targets > 0;
@@ -79,6 +79,10 @@ class PgDml : public PgStatement {
 
   bool has_aggregate_targets();
 
+  virtual bool has_group_by() const {
+    return false;
+  }
+
   bool has_doc_op() {
     return doc_op_ != nullptr;
   }
@@ -29,6 +29,7 @@
 
 #include "yb/yql/pggate/pg_select_index.h"
 #include "yb/yql/pggate/pg_tools.h"
+#include "yb/yql/pggate/pggate_flags.h"
 #include "yb/yql/pggate/util/pg_doc_data.h"
 
 namespace yb {
@@ -119,6 +120,29 @@ PgsqlExpressionPB *PgDmlRead::AllocTargetPB() {
   return read_req_->add_targets();
 }
 
+Status PgDmlRead::AppendGroupBy(PgExpr *expr) {
+  SCHECK(expr->is_colref(), InvalidArgument, "Only column references could be grouped by");
+  return expr->PrepareForRead(this, read_req_->add_group_by_exprs());
+}
+
+Status PgDmlRead::AppendOrderBy(PgExpr *expr, bool is_descending, bool nulls_first) {
+  SCHECK(expr->is_colref(), InvalidArgument, "Only column references could be ordered by");
+  auto* order_by = read_req_->add_order_by();
+  order_by->set_is_descending(is_descending);
+  order_by->set_nulls_first(nulls_first);
+  return expr->PrepareForRead(this, order_by->mutable_expr());
+}
+
+void PgDmlRead::SetOrderByLimit(uint64_t limit) {
+  // Too many rows kept by every tablet would not make the scan cheaper, read all rows then.
+  if (FLAGS_ysql_max_pushdown_order_by_limit <= 0 ||
+      limit > static_cast<uint64_t>(FLAGS_ysql_max_pushdown_order_by_limit)) {
+    read_req_->clear_order_by();
+    return;
+  }
+  read_req_->set_order_by_limit(limit);
+}
+
 //--------------------------------------------------------------------------------------------------
 // RESULT SET SUPPORT.
 // For now, selected expressions are just a list of column names (ref).
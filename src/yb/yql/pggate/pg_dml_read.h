@@ -62,6 +62,16 @@ class PgDmlRead : public PgDml {
   // Set forward (or backward) scan.
   void SetForwardScan(const bool is_forward_scan);
 
+  // Append a grouping column for aggregate targets.
+  // - SELECT column_l, count(*) FROM a_table GROUP BY column_l;
+  CHECKED_STATUS AppendGroupBy(PgExpr *expr);
+
+  // Append a sort key and set the number of rows for top-N read, so each tablet returns only its
+  // first limit rows in the requested order.
+  // - SELECT * FROM a_table ORDER BY column_l DESC LIMIT 100;
+  CHECKED_STATUS AppendOrderBy(PgExpr *expr, bool is_descending, bool nulls_first);
+  void SetOrderByLimit(uint64_t limit);
+
   // Bind a range column with a BETWEEN condition.
   CHECKED_STATUS BindColumnCondBetween(int attr_num, PgExpr *attr_value, PgExpr *attr_value_end);
 
@@ -94,6 +104,10 @@ class PgDmlRead : public PgDml {
   // Add column refs to protobuf read request.
   void SetColumnRefs();
 
+  bool has_group_by() const override {
+    return read_req_ && read_req_->group_by_exprs_size() > 0;
+  }
+
   // References mutable request from template operation of doc_op_.
   PgsqlReadRequestPB *read_req_ = nullptr;
 
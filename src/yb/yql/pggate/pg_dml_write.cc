@@ -150,6 +150,30 @@ Status PgDmlWrite::SetWriteTime(const HybridTime& write_time) {
   return Status::OK();
 }
 
+Result<bool> PgDmlWrite::PrepareForReuse() {
+  auto table = VERIFY_RESULT(pg_session_->LoadTable(table_id_));
+  if (table.get() != &*target_) {
+    return false;
+  }
+
+  exprs_.clear();
+  targets_.clear();
+  expr_binds_.clear();
+  expr_assigns_.clear();
+  ybctid_bind_ = false;
+  bind_table_ = false;
+  rowsets_.clear();
+  current_row_order_ = 0;
+  rows_affected_count_ = 0;
+
+  // Columns keep pointers to the binds of the previous write request, so they are recreated
+  // together with the request.
+  target_ = bind_ = PgTable(table);
+  AllocWriteRequest();
+  PrepareColumns();
+  return true;
+}
+
 void PgDmlWrite::AllocWriteRequest() {
   auto wop = AllocWriteOperation();
   DCHECK(wop);
@@ -52,6 +52,12 @@ class PgDmlWrite : public PgDml {
 
   CHECKED_STATUS SetWriteTime(const HybridTime& write_time);
 
+  // Prepare the statement to be executed again with new binds. The table descriptor and the
+  // statement itself are kept, while the binds, expressions and the write request of the
+  // previous execution are dropped. Returns false when the table was altered after the statement
+  // was prepared, so the statement cannot be reused.
+  Result<bool> PrepareForReuse();
+
  protected:
   // Constructor.
   PgDmlWrite(PgSession::ScopedRefPtr pg_session,
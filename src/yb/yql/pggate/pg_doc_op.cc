@@ -65,9 +65,19 @@ int64_t PgDocResult::NextRowOrder() {
   return row_orders_.size() > 0 ? row_orders_.front() : -1;
 }
 
+Status PgDocResult::LoadColumns() {
+  is_columnar_ = true;
+  return PgDocData::LoadColumns(row_count_, &row_iterator_, &columns_);
+}
+
 Status PgDocResult::WritePgTuple(const std::vector<PgExpr*>& targets, PgTuple *pg_tuple,
                                  int64_t *row_order) {
+  if (is_columnar_) {
+    SCHECK_EQ(targets.size(), columns_.size(), InternalError,
+              "Number of targets does not match number of columns");
+  }
   int attr_num = 0;
+  auto column = columns_.begin();
   for (const PgExpr *target : targets) {
     if (!target->is_colref() && !target->is_aggregate()) {
       return STATUS(InternalError,
@@ -79,9 +89,23 @@ Status PgDocResult::WritePgTuple(const std::vector<PgExpr*>& targets, PgTuple *p
       attr_num++;
     }
 
-    PgWireDataHeader header = PgDocData::ReadDataHeader(&row_iterator_);
-    target->TranslateData(&row_iterator_, header, attr_num - 1, pg_tuple);
+    if (is_columnar_) {
+      // Value of the row is accessed directly in its column, without header.
+      PgWireDataHeader header;
+      Slice value;
+      if (column->IsNull(next_row_)) {
+        header.set_null();
+      } else {
+        value = column->Value(next_row_);
+      }
+      ++column;
+      target->TranslateData(&value, header, attr_num - 1, pg_tuple);
+    } else {
+      PgWireDataHeader header = PgDocData::ReadDataHeader(&row_iterator_);
+      target->TranslateData(&row_iterator_, header, attr_num - 1, pg_tuple);
+    }
   }
+  ++next_row_;
 
   if (row_orders_.size()) {
     *row_order = row_orders_.front();
@@ -98,6 +122,19 @@ Status PgDocResult::ProcessSystemColumns() {
   }
   syscol_processed_ = true;
 
+  if (is_columnar_) {
+    SCHECK(!columns_.empty(), InternalError, "System column ybctid is missing");
+    const auto& column = columns_.front();
+    for (; next_row_ < row_count_; ++next_row_) {
+      SCHECK(!column.IsNull(next_row_), InternalError, "System column ybctid cannot be NULL");
+      Slice value = column.Value(next_row_);
+      int64_t data_size;
+      value.remove_prefix(PgDocData::ReadNumber(&value, &data_size));
+      ybctids_.emplace_back(value.data(), data_size);
+    }
+    return Status::OK();
+  }
+
   for (int i = 0; i < row_count_; i++) {
     PgWireDataHeader header = PgDocData::ReadDataHeader(&row_iterator_);
     SCHECK(!header.is_null(), InternalError, "System column ybctid cannot be NULL");
@@ -113,6 +150,7 @@ Status PgDocResult::ProcessSystemColumns() {
 }
 
 Status PgDocResult::ProcessSparseSystemColumns(std::string *reservoir) {
+  SCHECK(!is_columnar_, InternalError, "Sampling result is not expected in columnar format");
   // Process block sampling result returned from DocDB.
   // Results come as (index, ybctid) tuples where index is the position in the reservoir of
   // predetermined size. DocDB returns ybctids with sequential indexes first, starting from 0 and
@@ -191,16 +229,22 @@ Status PgDocOp::GetResult(list<PgDocResult> *rowsets) {
       RETURN_NOT_OK(exec_status_);
     }
 
-    DCHECK(response_.InProgress());
-    auto rows = VERIFY_RESULT(ProcessResponse(response_.GetStatus(pg_session_.get())));
-    // In case ProcessResponse doesn't fail with an error
-    // it should return non empty rows and/or set end_of_data_.
-    DCHECK(!rows.empty() || end_of_data_);
-    rowsets->splice(rowsets->end(), rows);
-    // Prefetch next portion of data if needed.
-    if (!(end_of_data_ || suppress_next_result_prefetching_)) {
-      exec_status_ = SendRequest(true /* force_non_bufferable */);
-      RETURN_NOT_OK(exec_status_);
+    for (;;) {
+      DCHECK(response_.InProgress());
+      auto rows = VERIFY_RESULT(ProcessResponse(response_.GetStatus(pg_session_.get())));
+      // In case ProcessResponse doesn't fail with an error it returns non empty rows and/or sets
+      // end_of_data_. The exception is parallel scan, that holds back rows of the tablets which
+      // are ahead of the tablet being returned. Then the next response should be awaited.
+      const bool wait_for_rows = rows.empty() && !end_of_data_;
+      rowsets->splice(rowsets->end(), rows);
+      // Prefetch next portion of data if needed.
+      if (!end_of_data_ && (wait_for_rows || !suppress_next_result_prefetching_)) {
+        exec_status_ = SendRequest(true /* force_non_bufferable */);
+        RETURN_NOT_OK(exec_status_);
+      }
+      if (!wait_for_rows) {
+        break;
+      }
     }
   }
 
@@ -351,6 +395,9 @@ Result<std::list<PgDocResult>> PgDocOp::ProcessResponseResult() {
           result.emplace_back(pgsql_op->rows_data(), std::move(batch_row_orders_[op_index]));
         }
       }
+      if (pgsql_op->response().is_columnar_result()) {
+        RETURN_NOT_OK(result.back().LoadColumns());
+      }
     }
   }
 
@@ -377,6 +424,7 @@ Status PgDocReadOp::ExecuteInit(const PgExecParameters *exec_params) {
   RETURN_NOT_OK(PgDocOp::ExecuteInit(exec_params));
 
   template_op_->mutable_request()->set_return_paging_state(true);
+  template_op_->mutable_request()->set_accept_columnar_result(FLAGS_ysql_enable_columnar_result);
   // TODO(10696): This is probably the only place in pg_doc_op where pg_session is being
   // used as a source of truth. All other uses treat it as stateless. Refactor to move this
   // state elsewhere.
@@ -391,6 +439,10 @@ Status PgDocReadOp::ExecuteInit(const PgExecParameters *exec_params) {
 }
 
 Result<std::list<PgDocResult>> PgDocReadOp::ProcessResponseImpl() {
+  if (!parallel_scan_streams_.empty()) {
+    return ProcessParallelScanResponse();
+  }
+
   // Process result from tablet server and check result status.
   auto result = VERIFY_RESULT(ProcessResponseResult());
 
@@ -400,6 +452,10 @@ Result<std::list<PgDocResult>> PgDocReadOp::ProcessResponseImpl() {
 }
 
 Status PgDocReadOp::CreateRequests() {
+  if (!parallel_scan_streams_.empty()) {
+    // Parallel scan picks the partitions to read on every request.
+    return SelectParallelScanStreams();
+  }
   if (request_population_completed_) {
     return Status::OK();
   }
@@ -414,6 +470,7 @@ Status PgDocReadOp::CreateRequests() {
   } else if (template_op_->request().is_aggregate()) {
     // Optimization for COUNT() operator.
     // - SELECT count(*) FROM sql_table;
+    // - SELECT k, count(*) FROM sql_table GROUP BY k;
     // - Multiple requests are created to run sequential COUNT() in parallel.
     return PopulateParallelSelectCountOps();
 
@@ -423,6 +480,18 @@ Status PgDocReadOp::CreateRequests() {
     // - Multiple requests for differrent hash permutations / keys.
     return PopulateNextHashPermutationOps();
 
+  } else if (template_op_->request().order_by_size() > 0 && exec_params_.partition_key == nullptr) {
+    // Optimization for ORDER BY with LIMIT.
+    // - SELECT * FROM sql_table ORDER BY col LIMIT 100;
+    // - Every tablet returns only its first rows, so all tablets are read in parallel.
+    return PopulateParallelSelectCountOps();
+
+  } else if (CanUseParallelScan()) {
+    // Optimization for full and range scans of a multi-tablet table.
+    // - SELECT * FROM sql_table WHERE range_c1 > 100;
+    // - Several partitions are read in parallel, their rows are returned in the order of the scan.
+    return PopulateParallelScanOps();
+
   } else {
     // No optimization.
     if (exec_params_.partition_key != nullptr) {
@@ -627,13 +696,7 @@ Status PgDocReadOp::InitializeHashPermutationStates() {
   return Status::OK();
 }
 
-Status PgDocReadOp::PopulateParallelSelectCountOps() {
-  // Create batch operators, one per partition, to SELECT COUNT() in parallel.
-  // TODO(tsplit): what if table partition is changed during PgDocReadOp lifecycle before or after
-  // the following line?
-  RETURN_NOT_OK(ClonePgsqlOps(table_->GetPartitionCount()));
-  // Set "pararallelism_level_" to control how many operators can be sent at one time.
-  //
+Result<size_t> PgDocReadOp::GetSelectParallelism() {
   // TODO(neil) The calculation for this control variable should be applied to ALL operators, but
   // the following calculation needs to be refined before it can be used for all statements.
   auto parallelism_level = FLAGS_ysql_select_parallelism;
@@ -643,11 +706,19 @@ Status PgDocReadOp::PopulateParallelSelectCountOps() {
     // Establish lower and upper bounds on parallelism.
     int kMinParSelCountParallelism = 1;
     int kMaxParSelCountParallelism = 16;
-    parallelism_level_ =
-      std::min(std::max(tserver_count * 2, kMinParSelCountParallelism), kMaxParSelCountParallelism);
-  } else {
-    parallelism_level_ = parallelism_level;
+    return static_cast<size_t>(std::min(
+        std::max(tserver_count * 2, kMinParSelCountParallelism), kMaxParSelCountParallelism));
   }
+  return static_cast<size_t>(std::max(parallelism_level, 1));
+}
+
+Status PgDocReadOp::PopulateParallelSelectCountOps() {
+  // Create batch operators, one per partition, to SELECT COUNT() in parallel.
+  // TODO(tsplit): what if table partition is changed during PgDocReadOp lifecycle before or after
+  // the following line?
+  RETURN_NOT_OK(ClonePgsqlOps(table_->GetPartitionCount()));
+  // Set "pararallelism_level_" to control how many operators can be sent at one time.
+  parallelism_level_ = VERIFY_RESULT(GetSelectParallelism());
 
   // Assign partitions to operators.
   const auto& partition_keys = table_->GetPartitions();
@@ -679,6 +750,144 @@ Status PgDocReadOp::PopulateParallelSelectCountOps() {
   return Status::OK();
 }
 
+bool PgDocReadOp::CanUseParallelScan() const {
+  // Parallel scan is used for full and range scans of the table itself, that read all of its
+  // partitions and are expected to return many rows.
+  const auto& req = template_op_->request();
+  return FLAGS_ysql_enable_parallel_scan &&
+         table_->GetPartitionCount() > 1 &&
+         exec_params_.partition_key == nullptr &&
+         !exec_params_.is_index_backfill &&
+         !suppress_next_result_prefetching_ &&
+         !req.has_index_request() &&
+         !req.has_ybctid_column_value() &&
+         !req.has_backfill_spec() &&
+         !req.has_lower_bound() &&
+         !req.has_upper_bound();
+}
+
+Status PgDocReadOp::PopulateParallelScanOps() {
+  // Create one stream per partition, in the order partitions are scanned. Rows of a stream are
+  // returned only after all rows of the preceding streams, so the order of the scan is preserved,
+  // as if all the streams were merged by the key of the scan.
+  // TODO(tsplit): what if table partition is changed during PgDocReadOp lifecycle before or after
+  // the following line?
+  const auto& partition_keys = table_->GetPartitions();
+  const bool is_forward_scan = template_op_->request().is_forward_scan();
+  for (size_t i = 0; i < partition_keys.size(); i++) {
+    const size_t partition = is_forward_scan ? i : partition_keys.size() - 1 - i;
+    auto op = CloneFromTemplate();
+    string upper_bound;
+    if (partition < partition_keys.size() - 1) {
+      upper_bound = partition_keys[partition + 1];
+    }
+    RETURN_NOT_OK(table_->SetScanBoundary(
+        static_cast<YBPgsqlReadOp*>(op.get())->mutable_request(),
+        partition_keys[partition],
+        true /* lower_bound_is_inclusive */,
+        upper_bound,
+        false /* upper_bound_is_inclusive */));
+    op->set_active(true);
+    parallel_scan_streams_.emplace_back();
+    parallel_scan_streams_.back().op = std::move(op);
+  }
+  parallelism_level_ = VERIFY_RESULT(GetSelectParallelism());
+  request_population_completed_ = true;
+  VLOG(1) << "Parallel scan of " << parallel_scan_streams_.size() << " partitions, "
+          << parallelism_level_ << " at a time";
+
+  return SelectParallelScanStreams();
+}
+
+Status PgDocReadOp::SelectParallelScanStreams() {
+  // The first stream is the one its rows are returned from, so it is always read. The following
+  // streams are read ahead until their share of the buffer is used up, so tablets do not run too
+  // far ahead of a slow consumer.
+  const size_t buffer_share = ParallelScanBufferShare();
+  pgsql_ops_.clear();
+  parallel_scan_sent_streams_.clear();
+  for (auto& stream : parallel_scan_streams_) {
+    if (parallel_scan_sent_streams_.size() >= parallelism_level_) {
+      break;
+    }
+    if (stream.done) {
+      continue;
+    }
+    if (!parallel_scan_sent_streams_.empty() &&
+        (stream.buffered_bytes >= buffer_share ||
+         parallel_scan_buffered_bytes_ >= FLAGS_ysql_parallel_scan_buffer_size)) {
+      continue;
+    }
+    pgsql_ops_.push_back(stream.op);
+    parallel_scan_sent_streams_.push_back(&stream);
+  }
+  active_op_count_ = pgsql_ops_.size();
+  return Status::OK();
+}
+
+size_t PgDocReadOp::ParallelScanBufferShare() const {
+  return std::max<size_t>(FLAGS_ysql_parallel_scan_buffer_size / parallelism_level_, 1);
+}
+
+Result<std::list<PgDocResult>> PgDocReadOp::ProcessParallelScanResponse() {
+  const size_t buffer_share = ParallelScanBufferShare();
+  const uint64_t prefetch_limit = template_op_->request().limit();
+  rows_affected_count_ = 0;
+  for (auto* stream : parallel_scan_sent_streams_) {
+    auto* read_op = static_cast<YBPgsqlReadOp*>(stream->op.get());
+    RETURN_NOT_OK(pg_session_->HandleResponse(*read_op, PgObjectId()));
+    RETURN_NOT_OK(ReviewResponsePagingState(read_op));
+
+    auto* rows_data = read_op->mutable_rows_data();
+    if (!rows_data->empty()) {
+      const size_t rows_bytes = rows_data->size();
+      stream->rows.emplace_back(std::move(*rows_data));
+      rows_data->clear();
+      if (read_op->response().is_columnar_result()) {
+        RETURN_NOT_OK(stream->rows.back().LoadColumns());
+      }
+      stream->buffered_bytes += rows_bytes;
+      parallel_scan_buffered_bytes_ += rows_bytes;
+
+      // Adapt the page size of the stream to the size of its rows, so that a page fits the share
+      // of the stream in the buffer.
+      const auto row_count = stream->rows.back().row_count();
+      if (row_count > 0) {
+        const size_t row_bytes = std::max<size_t>(rows_bytes / static_cast<size_t>(row_count), 1);
+        const uint64_t limit = std::max<uint64_t>(
+            std::min<uint64_t>(prefetch_limit, buffer_share / row_bytes), 1);
+        read_op->mutable_request()->set_limit(limit);
+      }
+    }
+
+    if (read_op->response().has_paging_state()) {
+      SetNextPageRequest(read_op);
+    } else {
+      stream->done = true;
+    }
+  }
+  parallel_scan_sent_streams_.clear();
+
+  // Return rows of the leading streams, up to the first stream that is not completed yet.
+  std::list<PgDocResult> result;
+  while (!parallel_scan_streams_.empty()) {
+    auto& stream = parallel_scan_streams_.front();
+    result.splice(result.end(), stream.rows);
+    parallel_scan_buffered_bytes_ -= stream.buffered_bytes;
+    stream.buffered_bytes = 0;
+    if (!stream.done) {
+      break;
+    }
+    parallel_scan_streams_.pop_front();
+  }
+  end_of_data_ = parallel_scan_streams_.empty();
+  if (end_of_data_) {
+    active_op_count_ = 0;
+  }
+
+  return result;
+}
+
 Status PgDocReadOp::PopulateSamplingOps() {
   // Create one PgsqlOp per partition
   RETURN_NOT_OK(ClonePgsqlOps(table_->GetPartitionCount()));
@@ -764,6 +973,36 @@ Status PgDocReadOp::SetScanPartitionBoundary() {
   return Status::OK();
 }
 
+void PgDocReadOp::SetNextPageRequest(YBPgsqlReadOp *read_op) {
+  auto& res = *read_op->mutable_response();
+  PgsqlReadRequestPB *req = read_op->mutable_request();
+
+  // Set up paging state for next request.
+  // A query request can be nested, and paging state belong to the innermost query which is
+  // the read operator that is operated first and feeds data to other queries.
+  // Recursive Proto Message:
+  //     PgsqlReadRequestPB { PgsqlReadRequestPB index_request; }
+  PgsqlReadRequestPB *innermost_req = req;
+  while (innermost_req->has_index_request()) {
+    innermost_req = innermost_req->mutable_index_request();
+  }
+  *innermost_req->mutable_paging_state() = std::move(*res.mutable_paging_state());
+  if (innermost_req->paging_state().has_read_time()) {
+    read_op->SetReadTime(ReadHybridTime::FromPB(innermost_req->paging_state().read_time()));
+  }
+
+  // Setup backfill_spec for the next request.
+  if (res.has_backfill_spec()) {
+    *innermost_req->mutable_backfill_spec() = std::move(*res.mutable_backfill_spec());
+  }
+
+  // Parse/Analysis/Rewrite catalog version has already been checked on the first request.
+  // The docdb layer will check the target table's schema version is compatible.
+  // This allows long-running queries to continue in the presence of other DDL statements
+  // as long as they do not affect the table(s) being queried.
+  req->clear_ysql_catalog_version();
+}
+
 Status PgDocReadOp::ProcessResponseReadStates() {
   // For each read_op, set up its request for the next batch of data or make it in-active.
   bool has_more_data = false;
@@ -782,32 +1021,7 @@ Status PgDocReadOp::ProcessResponseReadStates() {
       out_param_backfill_spec_ = res.backfill_spec();
     } else if (res.has_paging_state()) {
       has_more_arg = true;
-      PgsqlReadRequestPB *req = read_op->mutable_request();
-
-      // Set up paging state for next request.
-      // A query request can be nested, and paging state belong to the innermost query which is
-      // the read operator that is operated first and feeds data to other queries.
-      // Recursive Proto Message:
-      //     PgsqlReadRequestPB { PgsqlReadRequestPB index_request; }
-      PgsqlReadRequestPB *innermost_req = req;
-      while (innermost_req->has_index_request()) {
-        innermost_req = innermost_req->mutable_index_request();
-      }
-      *innermost_req->mutable_paging_state() = std::move(*res.mutable_paging_state());
-      if (innermost_req->paging_state().has_read_time()) {
-        read_op->SetReadTime(ReadHybridTime::FromPB(innermost_req->paging_state().read_time()));
-      }
-
-      // Setup backfill_spec for the next request.
-      if (res.has_backfill_spec()) {
-        *innermost_req->mutable_backfill_spec() = std::move(*res.mutable_backfill_spec());
-      }
-
-      // Parse/Analysis/Rewrite catalog version has already been checked on the first request.
-      // The docdb layer will check the target table's schema version is compatible.
-      // This allows long-running queries to continue in the presence of other DDL statements
-      // as long as they do not affect the table(s) being queried.
-      req->clear_ysql_catalog_version();
+      SetNextPageRequest(read_op);
     }
 
     // Check for batch execution.
@@ -848,6 +1062,10 @@ Status PgDocReadOp::ProcessResponseReadStates() {
         // sampling state is the samplerows. We use that number to either estimate liverows, or to
         // update numrows and samplerows in next partition's sampling state.
         sample_rows_ = res.mutable_sampling_state()->samplerows();
+        // In block sampling mode whole sampling state is passed to the next partition.
+        if (template_op_->request().sampling_state().block_sample_rows() > 0) {
+          block_sampling_state_ = std::move(*res.mutable_sampling_state());
+        }
       }
     }
 
@@ -874,7 +1092,14 @@ Status PgDocReadOp::ProcessResponseReadStates() {
       // Current sampling op without paging state means that previous one was completed and moved
       // outside.
       auto sampling_state = req->mutable_sampling_state();
-      if (sample_rows_ < sampling_state->targrows()) {
+      if (sampling_state->block_sample_rows() > 0) {
+        // Each partition sample represents the whole partition, so all of them are sampled and
+        // sample_rows_ is the total table rows estimate when the last one is completed.
+        VLOG(1) << "Continue block sampling next partition from " << sample_rows_;
+        const auto block_sample_rows = sampling_state->block_sample_rows();
+        *sampling_state = block_sampling_state_;
+        sampling_state->set_block_sample_rows(block_sample_rows);
+      } else if (sample_rows_ < sampling_state->targrows()) {
         // More sample rows are needed, update sampling state and let next partition be scanned
         VLOG(1) << "Continue sampling next partition from " << sample_rows_;
         sampling_state->set_numrows(static_cast<int32>(sample_rows_));
@@ -21,7 +21,9 @@
 
 #include "yb/util/locks.h"
 #include "yb/client/yb_op.h"
+#include "yb/common/pgsql_protocol.pb.h"
 #include "yb/yql/pggate/pg_session.h"
+#include "yb/yql/pggate/util/pg_doc_data.h"
 
 namespace yb {
 namespace pggate {
@@ -46,7 +48,7 @@ class PgDocResult {
 
   // End of this batch.
   bool is_eof() const {
-    return row_count_ == 0 || row_iterator_.empty();
+    return row_count_ == 0 || (is_columnar_ ? next_row_ >= row_count_ : row_iterator_.empty());
   }
 
   // Get the postgres tuple from this batch.
@@ -73,6 +75,9 @@ class PgDocResult {
     return row_count_;
   }
 
+  // Load rows data in columnar format. Should be called right after construction.
+  CHECKED_STATUS LoadColumns();
+
  private:
   // Data selected from DocDB.
   string data_;
@@ -83,6 +88,11 @@ class PgDocResult {
   // The row number of only this batch.
   int64_t row_count_ = 0;
 
+  // Columns of rows data in columnar format, and the next row to be read from them.
+  bool is_columnar_ = false;
+  std::vector<PgColumnarColumn> columns_;
+  int64_t next_row_ = 0;
+
   // The indexing order of the row in this batch.
   // These order values help to identify the row order across all batches.
   std::list<int64_t> row_orders_;
@@ -442,6 +452,24 @@ class PgDocReadOp : public PgDocOp {
   //     Create parallel request for SELECT COUNT().
   CHECKED_STATUS PopulateParallelSelectCountOps();
 
+  // Get the number of partitions to read in parallel.
+  Result<size_t> GetSelectParallelism();
+
+  // Create operators by partitions.
+  // - Optimization for full and range scans of a multi-tablet table.
+  // - Partitions are read in parallel, and their rows are returned in the order of the scan.
+  bool CanUseParallelScan() const;
+  CHECKED_STATUS PopulateParallelScanOps();
+
+  // Pick the parallel scan streams to be read by the next request.
+  CHECKED_STATUS SelectParallelScanStreams();
+
+  // Part of the parallel scan buffer, that a single stream may use.
+  size_t ParallelScanBufferShare() const;
+
+  // Process response to the parallel scan request.
+  Result<std::list<PgDocResult>> ProcessParallelScanResponse();
+
   // Create one sampling operator per partition and arrange their execution in random order
   CHECKED_STATUS PopulateSamplingOps();
 
@@ -454,6 +482,9 @@ class PgDocReadOp : public PgDocOp {
   // Process response read state from DocDB.
   CHECKED_STATUS ProcessResponseReadStates();
 
+  // Set up the request of read_op to fetch the next page, using the paging state of its response.
+  void SetNextPageRequest(client::YBPgsqlReadOp *read_op);
+
   // Reset pgsql operators before reusing them with new arguments / inputs from Postgres.
   CHECKED_STATUS ResetInactivePgsqlOps();
 
@@ -492,6 +523,10 @@ class PgDocReadOp : public PgDocOp {
   // total number of rows in the table.
   double sample_rows_ = 0;
 
+  // Sampling state returned by the last completed partition in block sampling mode. Every partition
+  // is sampled, and the next one continues with this state.
+  PgsqlSamplingStatePB block_sampling_state_;
+
   // Used internally for PopulateNextHashPermutationOps to keep track of which permutation should
   // be used to construct the next read_op.
   // Is valid as long as request_population_completed_ is false.
@@ -512,6 +547,26 @@ class PgDocReadOp : public PgDocOp {
   // For a query clause "h1 = 1 AND h2 IN (2,3) AND h3 IN (4,5,6) AND h4 = 7",
   // this will be initialized to [[1], [2, 3], [4, 5, 6], [7]]
   std::vector<std::vector<const PgsqlExpressionPB*>> partition_exprs_;
+
+  // Used internally for parallel scan, one stream per partition in the order of the scan.
+  // - The first stream is the one its rows are returned to Postgres from.
+  // - Up to parallelism_level_ streams are read at one time. The following streams buffer their
+  //   rows until all preceding streams are completed, up to FLAGS_ysql_parallel_scan_buffer_size
+  //   in total.
+  // - Completed streams are removed, the scan ends when no stream is left.
+  struct ParallelScanStream {
+    std::shared_ptr<client::YBPgsqlOp> op;
+    std::list<PgDocResult> rows;
+    size_t buffered_bytes = 0;
+    bool done = false;
+  };
+  std::deque<ParallelScanStream> parallel_scan_streams_;
+
+  // Streams which operators are sent by the current request, in the same order as pgsql_ops_.
+  std::vector<ParallelScanStream*> parallel_scan_sent_streams_;
+
+  // Total size of rows buffered by all parallel scan streams.
+  size_t parallel_scan_buffered_bytes_ = 0;
 };
 
 //--------------------------------------------------------------------------------------------------
@@ -15,8 +15,12 @@
 
 #include "yb/yql/pggate/pg_sample.h"
 
+#include <algorithm>
+
 #include "yb/gutil/casts.h"
 
+#include "yb/yql/pggate/pggate_flags.h"
+
 namespace yb {
 namespace pggate {
 
@@ -105,6 +109,13 @@ Status PgSamplePicker::PrepareSamplingState(int targrows, double rstate_w, uint6
   sampling_state->set_rowstoskip(-1);          // rows to skip before selecting another
   sampling_state->set_rstate_w(rstate_w);      // Vitter algorithm's W
   sampling_state->set_rand_state(rand_state);  // random generator's state
+  if (FLAGS_ysql_enable_block_sampling) {
+    // Every tablet contributes its share of the sample plus some extra rows for the reservoir to
+    // choose from.
+    const auto num_partitions = std::max<size_t>(target_->GetPartitionCount(), 1);
+    sampling_state->set_block_sample_rows(
+        static_cast<int32>(2 * ((targrows + num_partitions - 1) / num_partitions)));
+  }
   reservoir_ = std::make_unique<std::string[]>(targrows);
   return Status::OK();
 }
@@ -37,6 +37,7 @@
 #include "yb/common/row_mark.h"
 #include "yb/common/schema.h"
 #include "yb/common/transaction_error.h"
+#include "yb/common/wire_protocol.h"
 
 #include "yb/docdb/doc_key.h"
 #include "yb/docdb/primitive_value.h"
@@ -209,6 +210,86 @@ CHECKED_STATUS CombineErrorsToStatus(const client::CollectedErrors& errors, cons
   return AppendTxnErrorCode(AppendPsqlErrorCode(result, errors), errors);
 }
 
+// Fills Perform request with operations and with the state of the transaction or the read point,
+// that operations belong to.
+CHECKED_STATUS PreparePerformRequest(
+    client::YBSession* session, const PgsqlOps& ops, CoarseTimePoint deadline,
+    uint64_t cached_catalog_version, tserver::PgPerformRequestPB* req) {
+  const auto& transaction = session->transaction();
+  if (transaction) {
+    *req->mutable_child_transaction_data() = VERIFY_RESULT(transaction->PrepareChildFuture(
+        client::ForceConsistentRead::kTrue, deadline).get());
+  } else if (session->read_point()) {
+    session->read_point()->PrepareChildTransactionData(req->mutable_child_transaction_data());
+  }
+  req->set_cached_catalog_version(cached_catalog_version);
+  req->mutable_ops()->Reserve(narrow_cast<int>(ops.size()));
+  for (const auto& op : ops) {
+    auto& out = *req->add_ops();
+    if (op->type() == YBOperation::Type::PGSQL_READ) {
+      auto& read_op = down_cast<client::YBPgsqlReadOp&>(*op);
+      *out.mutable_read() = read_op.request();
+      out.set_read_from_followers(
+          read_op.yb_consistency_level() == YBConsistencyLevel::CONSISTENT_PREFIX);
+    } else {
+      const auto& write_op = down_cast<const client::YBPgsqlWriteOp&>(*op);
+      *out.mutable_write() = write_op.request();
+      out.set_is_single_row_txn(write_op.is_single_row_txn());
+      out.set_check_read_time_conflicts(write_op.check_read_time_conflicts());
+    }
+  }
+  return Status::OK();
+}
+
+// Moves responses of Perform call to operations, and applies result of the child transaction
+// to the transaction or the read point of session. Returns status in the same form as YBSession
+// flush does.
+client::FlushStatus ProcessPerformResponse(
+    const Status& status, tserver::PgPerformResponsePB* resp,
+    const client::YBTransactionPtr& transaction, client::YBSession* session,
+    const PgsqlOps& ops) {
+  client::FlushStatus result;
+  if (!status.ok()) {
+    result.status = status;
+    return result;
+  }
+  if (resp->has_status()) {
+    result.status = StatusFromPB(resp->status());
+  }
+  if (resp->has_child_transaction_result()) {
+    if (transaction) {
+      auto apply_status = transaction->ApplyChildResult(resp->child_transaction_result());
+      if (!apply_status.ok() && result.status.ok()) {
+        result.status = std::move(apply_status);
+      }
+    } else if (session->read_point()) {
+      session->read_point()->ApplyChildTransactionResult(resp->child_transaction_result());
+    }
+  }
+  if (static_cast<size_t>(resp->responses().size()) != ops.size()) {
+    if (result.status.ok()) {
+      result.status = STATUS_FORMAT(
+          IllegalState, "Wrong number of responses: $0, expected $1",
+          resp->responses().size(), ops.size());
+    }
+    return result;
+  }
+  for (size_t i = 0; i != ops.size(); ++i) {
+    auto& op_resp = *resp->mutable_responses(narrow_cast<int>(i));
+    const auto& op = ops[i];
+    op->mutable_response()->Swap(op_resp.mutable_response());
+    op->mutable_rows_data()->swap(*op_resp.mutable_rows_data());
+    if (op_resp.has_used_read_time()) {
+      down_cast<client::YBPgsqlReadOp&>(*op).SetUsedReadTime(
+          ReadHybridTime::FromPB(op_resp.used_read_time()));
+    }
+    if (op_resp.has_error()) {
+      result.errors.push_back(std::make_unique<client::YBError>(op, StatusFromPB(op_resp.error())));
+    }
+  }
+  return result;
+}
+
 docdb::PrimitiveValue NullValue(SortingType sorting) {
   using SortingType = SortingType;
 
@@ -426,7 +507,7 @@ Status PgSession::RunHelper::Apply(std::shared_ptr<client::YBPgsqlOp> op,
       yb_session_->SetInTxnLimit(HybridTime(*read_time));
     }
     for (const auto& bop : pending_ops_) {
-      RETURN_NOT_OK(pg_session_.ApplyOperation(yb_session_.get(), transactional_, bop));
+      RETURN_NOT_OK(pg_session_.ApplyOperation(transactional_, bop, &ops_));
     }
   } else {
     // Session must not be changed as all operations belong to single session
@@ -436,13 +517,13 @@ Status PgSession::RunHelper::Apply(std::shared_ptr<client::YBPgsqlOp> op,
   if (PREDICT_FALSE(yb_debug_log_docdb_requests)) {
     LOG(INFO) << "Applying operation: " << op->ToString();
   }
-  yb_session_->Apply(std::move(op));
+  ops_.push_back(std::move(op));
   return Status::OK();
 }
 
 Result<PgSessionAsyncRunResult> PgSession::RunHelper::Flush() {
   if (yb_session_) {
-    auto future_status = yb_session_->FlushFuture();
+    auto future_status = pg_session_.FlushAsync(yb_session_.get(), std::move(ops_));
     return PgSessionAsyncRunResult(
         std::move(pending_ops_), std::move(future_status), std::move(yb_session_));
   }
@@ -838,7 +919,17 @@ Status PgSession::StartOperationsBuffering() {
 Status PgSession::StopOperationsBuffering() {
   SCHECK(buffering_enabled_, IllegalState, "Buffering hasn't been started");
   buffering_enabled_ = false;
-  return FlushBufferedOperations();
+  if (!single_statement_modify_txn_) {
+    return FlushBufferedOperations();
+  }
+  // Buffering stops at the end of the statement, so buffered operations are the last writes
+  // of single statement transaction.
+  return FlushBufferedOperationsImpl([this](auto ops, auto transactional) -> Status {
+    if (transactional && VERIFY_RESULT(FlushSingleTabletOperations(&ops))) {
+      return Status::OK();
+    }
+    return this->FlushOperations(std::move(ops), transactional);
+  });
 }
 
 void PgSession::ResetOperationsBuffering() {
@@ -877,6 +968,51 @@ Status PgSession::FlushBufferedOperationsImpl(const Flusher& flusher) {
   return Status::OK();
 }
 
+Result<bool> PgSession::FlushSingleTabletOperations(PgsqlOpBuffer* ops) {
+  if (!FLAGS_ysql_single_tablet_statement_writes ||
+      !pg_txn_manager_->CanWriteWithoutTransaction()) {
+    return false;
+  }
+  // All operations should be writes to the same tablet, so they could be sent in one RPC.
+  const client::YBTable* table = nullptr;
+  size_t partition_idx = 0;
+  std::string partition_key;
+  for (const auto& bop : *ops) {
+    const auto& op = *bop.operation;
+    if (op.type() != YBOperation::Type::PGSQL_WRITE) {
+      return false;
+    }
+    RETURN_NOT_OK(op.GetPartitionKey(&partition_key));
+    const auto idx = op.table()->FindPartitionStartIndex(partition_key);
+    if (!table) {
+      table = op.table().get();
+      partition_idx = idx;
+    } else if (table != op.table().get() || idx != partition_idx) {
+      return false;
+    }
+  }
+
+  // Transactional session does not have transaction yet, so operations are sent as a single
+  // non transactional write, with read time of the statement.
+  auto* session = VERIFY_RESULT(pg_txn_manager_->GetTransactionalSession());
+  if (PREDICT_FALSE(yb_debug_log_docdb_requests)) {
+    LOG(INFO) << "Flushing buffered operations as single tablet write (num ops: "
+              << ops->size() << ")";
+  }
+  PgsqlOps session_ops;
+  session_ops.reserve(ops->size());
+  for (const auto& bop : *ops) {
+    down_cast<client::YBPgsqlWriteOp*>(bop.operation.get())->set_check_read_time_conflicts(true);
+    RETURN_NOT_OK(ApplyOperation(true /* transactional */, bop, &session_ops));
+  }
+  const auto flush_status = FlushAsync(session, std::move(session_ops)).get();
+  RETURN_NOT_OK(CombineErrorsToStatus(flush_status.errors, flush_status.status));
+  for (const auto& bop : *ops) {
+    RETURN_NOT_OK(HandleResponse(*bop.operation, bop.relation_id));
+  }
+  return true;
+}
+
 Result<bool> PgSession::ShouldHandleTransactionally(const client::YBPgsqlOp& op) {
   if (!op.IsTransactional() || YBCIsInitDbModeEnvVarSet()) {
     return false;
@@ -923,9 +1059,9 @@ Result<bool> PgSession::IsInitDbDone() {
   return pg_client_.IsInitDbDone();
 }
 
-Status PgSession::ApplyOperation(client::YBSession *session,
-                                 bool transactional,
-                                 const BufferableOperation& bop) {
+Status PgSession::ApplyOperation(bool transactional,
+                                 const BufferableOperation& bop,
+                                 PgsqlOps* ops) {
   const auto& op = bop.operation;
   SCHECK_EQ(VERIFY_RESULT(ShouldHandleTransactionally(*op)),
             transactional,
@@ -934,10 +1070,54 @@ Status PgSession::ApplyOperation(client::YBSession *session,
                    op->table()->name(),
                    op->table()->schema().table_properties().is_transactional(),
                    YBCIsInitDbModeEnvVarSet()));
-  session->Apply(op);
+  ops->push_back(op);
   return Status::OK();
 }
 
+std::future<client::FlushStatus> PgSession::FlushAsync(
+    client::YBSession* session, PgsqlOps ops) {
+  // Operations of subtransaction are not performed remotely, since child transaction does not
+  // carry subtransaction state of the parent.
+  const auto& transaction = session->transaction();
+  // Catalog reads of the catalog cache loading are always performed by the local tablet server,
+  // so responses could be shared with other backends.
+  const auto cached_catalog_version =
+      session == catalog_session_.get() ? catalog_read_caching_version_ : 0;
+  if ((FLAGS_ysql_dml_via_local_tserver || cached_catalog_version) &&
+      (!transaction || !transaction->HasSubTransactionState())) {
+    return PerformAsync(session, std::move(ops), cached_catalog_version);
+  }
+  for (auto& op : ops) {
+    session->Apply(std::move(op));
+  }
+  return session->FlushFuture();
+}
+
+std::future<client::FlushStatus> PgSession::PerformAsync(
+    client::YBSession* session, PgsqlOps ops, uint64_t cached_catalog_version) {
+  auto promise = std::make_shared<std::promise<client::FlushStatus>>();
+  auto result = promise->get_future();
+  const auto deadline = CoarseMonoClock::now() + FLAGS_pggate_rpc_timeout_secs * 1s;
+  tserver::PgPerformRequestPB req;
+  auto status = PreparePerformRequest(session, ops, deadline, cached_catalog_version, &req);
+  if (!status.ok()) {
+    client::FlushStatus flush_status;
+    flush_status.status = std::move(status);
+    promise->set_value(std::move(flush_status));
+    return result;
+  }
+  if (PREDICT_FALSE(yb_debug_log_docdb_requests)) {
+    LOG(INFO) << "Performing " << ops.size() << " operations via local tablet server";
+  }
+  pg_client_.PerformAsync(
+      &req, deadline,
+      [promise, session = session->shared_from_this(), transaction = session->transaction(),
+       ops = std::move(ops)](const Status& status, tserver::PgPerformResponsePB* resp) {
+    promise->set_value(ProcessPerformResponse(status, resp, transaction, session.get(), ops));
+  });
+  return result;
+}
+
 Status PgSession::FlushOperations(PgsqlOpBuffer ops, IsTransactionalSession transactional) {
   DCHECK(ops.size() > 0 && ops.size() <= FLAGS_ysql_session_max_batch_size);
   auto session = VERIFY_RESULT(GetSession(transactional, IsReadOnlyOperation::kFalse));
@@ -950,10 +1130,12 @@ Status PgSession::FlushOperations(PgsqlOpBuffer ops, IsTransactionalSession tran
               << (transactional ? "transactional" : "non-transactional")
               << " session (num ops: " << ops.size() << ")";
   }
+  PgsqlOps session_ops;
+  session_ops.reserve(ops.size());
   for (const auto& buffered_op : ops) {
-    RETURN_NOT_OK(ApplyOperation(session, transactional, buffered_op));
+    RETURN_NOT_OK(ApplyOperation(transactional, buffered_op, &session_ops));
   }
-  const auto flush_status = session->FlushFuture().get();
+  const auto flush_status = FlushAsync(session, std::move(session_ops)).get();
   RETURN_NOT_OK(CombineErrorsToStatus(flush_status.errors, flush_status.status));
   for (const auto& buffered_op : ops) {
     RETURN_NOT_OK(HandleResponse(*buffered_op.operation, buffered_op.relation_id));
@@ -1118,6 +1300,16 @@ void PgSession::ResetCatalogReadPoint() {
   catalog_session_->SetReadPoint(ReadHybridTime());
 }
 
+void PgSession::SetCatalogReadCaching(uint64_t catalog_version) {
+  catalog_read_caching_version_ =
+      FLAGS_ysql_enable_catalog_response_cache ? catalog_version : 0;
+  if (catalog_read_caching_version_) {
+    // Read time of the first cached catalog read is picked by the tablet server, so backends
+    // loading catalog of the same version concurrently would use the same read point.
+    ResetCatalogReadPoint();
+  }
+}
+
 void PgSession::SetCatalogReadPoint(const ReadHybridTime& read_ht) {
   catalog_session_->SetReadPoint(read_ht);
 }
@@ -59,6 +59,7 @@ struct BufferableOperation {
 };
 
 typedef std::vector<BufferableOperation> PgsqlOpBuffer;
+typedef std::vector<std::shared_ptr<client::YBPgsqlOp>> PgsqlOps;
 
 // This class provides access to run operation's result by reading std::future<Status>
 // and analyzing possible pending errors of YBSession object in GetStatus() method.
@@ -129,6 +130,10 @@ class PgSession : public RefCountedThreadSafe<PgSession> {
   // Next catalog read operation will read the very latest catalog's state.
   void ResetCatalogReadPoint();
 
+  // While catalog_version is not zero, catalog reads are served by the response cache of the local
+  // tablet server, that is shared by backends reading catalog of the same version.
+  void SetCatalogReadCaching(uint64_t catalog_version);
+
   //------------------------------------------------------------------------------------------------
   // Operations on Session.
   //------------------------------------------------------------------------------------------------
@@ -208,6 +213,13 @@ class PgSession : public RefCountedThreadSafe<PgSession> {
   // Drop all pending buffered operations and stop further buffering. Buffering may be in any state.
   void ResetOperationsBuffering();
 
+  // Whether current transaction consists of a single statement, that modifies a single table
+  // without secondary indexes and triggers. Buffered writes of such statement are flushed
+  // atomically without distributed transaction, when they all belong to the same tablet.
+  void SetSingleStatementModifyTxn(bool value) {
+    single_statement_modify_txn_ = value;
+  }
+
   // Flush all pending buffered operations. Buffering mode remain unchanged.
   CHECKED_STATUS FlushBufferedOperations();
   // Drop all pending buffered operations. Buffering mode remain unchanged.
@@ -337,9 +349,18 @@ class PgSession : public RefCountedThreadSafe<PgSession> {
 
   CHECKED_STATUS FlushBufferedOperationsImpl(const Flusher& flusher);
   CHECKED_STATUS FlushOperations(PgsqlOpBuffer ops, IsTransactionalSession transactional);
-  CHECKED_STATUS ApplyOperation(client::YBSession* session,
-                                bool transactional,
-                                const BufferableOperation& bop);
+  // Flushes transactional operations of single statement transaction as atomic single tablet
+  // write, if possible. Returns false when operations should be flushed in a regular way.
+  Result<bool> FlushSingleTabletOperations(PgsqlOpBuffer* ops);
+  // Checks that operation matches session type and adds it to ops, that are flushed together.
+  CHECKED_STATUS ApplyOperation(bool transactional,
+                                const BufferableOperation& bop,
+                                PgsqlOps* ops);
+  // Flushes ops using session. When ysql_dml_via_local_tserver is set, ops are performed by the
+  // local tablet server on behalf of the session's transaction or read point.
+  std::future<client::FlushStatus> FlushAsync(client::YBSession* session, PgsqlOps ops);
+  std::future<client::FlushStatus> PerformAsync(
+      client::YBSession* session, PgsqlOps ops, uint64_t cached_catalog_version);
 
   // Helper class to run multiple operations on single session.
   // This class allows to keep implementation of RunAsync template method simple
@@ -363,6 +384,8 @@ class PgSession : public RefCountedThreadSafe<PgSession> {
     // by the PgSessionAsyncRunResult object returned from the Flush() method.
     PgsqlOpBuffer pending_ops_;
     client::YBSessionPtr yb_session_;
+    // Operations to be flushed using yb_session_.
+    PgsqlOps ops_;
   };
 
   // Returns the appropriate session to use, in most cases the one used by the current transaction.
@@ -404,6 +427,9 @@ class PgSession : public RefCountedThreadSafe<PgSession> {
   // YBSession to read data from catalog tables.
   std::shared_ptr<client::YBSession> catalog_session_;
 
+  // Catalog version, for which catalog reads are cached by the local tablet server, or zero.
+  uint64_t catalog_read_caching_version_ = 0;
+
   // Execution status.
   Status status_;
   string errmsg_;
@@ -414,6 +440,7 @@ class PgSession : public RefCountedThreadSafe<PgSession> {
 
   // Should write operations be buffered?
   bool buffering_enabled_ = false;
+  bool single_statement_modify_txn_ = false;
   PgsqlOpBuffer buffered_ops_;
   PgsqlOpBuffer buffered_txn_ops_;
   std::unordered_set<RowIdentifier, boost::hash<RowIdentifier>> buffered_keys_;
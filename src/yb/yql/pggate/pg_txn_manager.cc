@@ -350,6 +350,13 @@ Status PgTxnManager::BeginWriteTransactionIfNecessary(bool read_only_op,
   return Status::OK();
 }
 
+bool PgTxnManager::CanWriteWithoutTransaction() const {
+  // Serializable isolation requires read intents for rows that were read, so it could not be
+  // emulated by non transactional write.
+  return txn_in_progress_ && !txn_ && !ddl_txn_ && !read_only_ &&
+         pg_isolation_level_ != PgIsolationLevel::SERIALIZABLE;
+}
+
 Status PgTxnManager::SetActiveSubTransaction(SubTransactionId id) {
   RETURN_NOT_OK(BeginWriteTransactionIfNecessary(
       false /* read_only_op */, false /* needs_pessimistic_locking */));
@@ -90,6 +90,10 @@ class PgTxnManager : public RefCountedThreadSafe<PgTxnManager> {
 
   bool IsDdlMode() const { return ddl_session_.get() != nullptr; }
   bool IsTxnInProgress() const { return txn_in_progress_; }
+
+  // Whether writes of current transaction could be performed without starting distributed
+  // transaction, provided that they are applied atomically at read time of the transaction.
+  bool CanWriteWithoutTransaction() const;
   bool ShouldUseFollowerReads() const { return updated_read_time_for_follower_reads_; }
 
  private:
@@ -891,6 +891,20 @@ Status PgApiImpl::DmlAppendTarget(PgStatement *handle, PgExpr *target) {
   return down_cast<PgDml*>(handle)->AppendTarget(target);
 }
 
+Status PgApiImpl::DmlAppendGroupBy(PgStatement *handle, PgExpr *expr) {
+  return down_cast<PgDmlRead*>(handle)->AppendGroupBy(expr);
+}
+
+Status PgApiImpl::DmlAppendOrderBy(PgStatement *handle, PgExpr *expr, bool is_descending,
+                                   bool nulls_first) {
+  return down_cast<PgDmlRead*>(handle)->AppendOrderBy(expr, is_descending, nulls_first);
+}
+
+Status PgApiImpl::DmlSetOrderByLimit(PgStatement *handle, uint64_t limit) {
+  down_cast<PgDmlRead*>(handle)->SetOrderByLimit(limit);
+  return Status::OK();
+}
+
 Status PgApiImpl::DmlBindColumn(PgStatement *handle, int attr_num, PgExpr *attr_value) {
   return down_cast<PgDml*>(handle)->BindColumn(attr_num, attr_value);
 }
@@ -1104,6 +1118,45 @@ Status PgApiImpl::NewUpdate(const PgObjectId& table_id,
   return Status::OK();
 }
 
+Status PgApiImpl::NewSingleRowWrite(const StmtOp stmt_op,
+                                    const PgObjectId& table_id,
+                                    PgStatement **handle) {
+  *handle = nullptr;
+  SCHECK(stmt_op == StmtOp::STMT_INSERT || stmt_op == StmtOp::STMT_UPDATE, InvalidArgument,
+         "Only INSERT and UPDATE statements could be reused");
+  if (!FLAGS_ysql_reuse_single_row_write_statements) {
+    return stmt_op == StmtOp::STMT_INSERT
+        ? NewInsert(table_id, true /* is_single_row_txn */, handle)
+        : NewUpdate(table_id, true /* is_single_row_txn */, handle);
+  }
+
+  auto& stmts = stmt_op == StmtOp::STMT_INSERT ? single_row_inserts_ : single_row_updates_;
+  auto& stmt = stmts[table_id];
+  if (stmt) {
+    // Drop the statement when it could not be reused, e.g. because the table was altered. Also
+    // drop it on failure, so a broken statement is not served again.
+    auto reused = stmt->PrepareForReuse();
+    if (reused.ok() && *reused) {
+      ++single_row_write_reuse_count_;
+      *handle = stmt.get();
+      return Status::OK();
+    }
+    stmt.reset();
+    RETURN_NOT_OK(reused);
+  }
+
+  std::unique_ptr<PgDmlWrite> new_stmt;
+  if (stmt_op == StmtOp::STMT_INSERT) {
+    new_stmt = std::make_unique<PgInsert>(pg_session_, table_id, true /* is_single_row_txn */);
+  } else {
+    new_stmt = std::make_unique<PgUpdate>(pg_session_, table_id, true /* is_single_row_txn */);
+  }
+  RETURN_NOT_OK(new_stmt->Prepare());
+  stmt = std::move(new_stmt);
+  *handle = stmt.get();
+  return Status::OK();
+}
+
 Status PgApiImpl::ExecUpdate(PgStatement *handle) {
   if (!PgStatement::IsValidStmt(handle, StmtOp::STMT_UPDATE)) {
     // Invalid handle.
@@ -1405,16 +1458,22 @@ Status PgApiImpl::MaybeResetTransactionReadPoint() {
 
 Status PgApiImpl::CommitTransaction() {
   pg_session_->InvalidateForeignKeyReferenceCache();
+  pg_session_->SetSingleStatementModifyTxn(false);
   RETURN_NOT_OK(pg_session_->FlushBufferedOperations());
   return pg_txn_manager_->CommitTransaction();
 }
 
 void PgApiImpl::AbortTransaction() {
   pg_session_->InvalidateForeignKeyReferenceCache();
+  pg_session_->SetSingleStatementModifyTxn(false);
   pg_session_->DropBufferedOperations();
   pg_txn_manager_->AbortTransaction();
 }
 
+void PgApiImpl::SetSingleStatementModifyTxn(bool value) {
+  pg_session_->SetSingleStatementModifyTxn(value);
+}
+
 Status PgApiImpl::SetTransactionIsolationLevel(int isolation) {
   return pg_txn_manager_->SetIsolationLevel(isolation);
 }
@@ -1465,6 +1524,10 @@ void PgApiImpl::ResetCatalogReadTime() {
   pg_session_->ResetCatalogReadPoint();
 }
 
+void PgApiImpl::SetCatalogReadCaching(uint64_t catalog_version) {
+  pg_session_->SetCatalogReadCaching(catalog_version);
+}
+
 Result<bool> PgApiImpl::ForeignKeyReferenceExists(
     PgOid table_id, const Slice& ybctid, PgOid database_id) {
   return pg_session_->ForeignKeyReferenceExists(
@@ -44,6 +44,8 @@
 namespace yb {
 namespace pggate {
 
+class PgDmlWrite;
+
 //--------------------------------------------------------------------------------------------------
 
 class PggateOptions : public yb::server::ServerBaseOptions {
@@ -99,6 +101,8 @@ class PgApiImpl {
 
   void ResetCatalogReadTime();
 
+  void SetCatalogReadCaching(uint64_t catalog_version);
+
   // Initialize ENV within which PGSQL calls will be executed.
   CHECKED_STATUS CreateEnv(PgEnv **pg_env);
   CHECKED_STATUS DestroyEnv(PgEnv *pg_env);
@@ -333,6 +337,14 @@ class PgApiImpl {
   // All DML statements
   CHECKED_STATUS DmlAppendTarget(PgStatement *handle, PgExpr *expr);
 
+  // Append a grouping column of aggregate targets to SELECT.
+  CHECKED_STATUS DmlAppendGroupBy(PgStatement *handle, PgExpr *expr);
+
+  // Append a sort key of top-N read and set its number of rows.
+  CHECKED_STATUS DmlAppendOrderBy(PgStatement *handle, PgExpr *expr, bool is_descending,
+                                  bool nulls_first);
+  CHECKED_STATUS DmlSetOrderByLimit(PgStatement *handle, uint64_t limit);
+
   // Binding Columns: Bind column with a value (expression) in a statement.
   // + This API is used to identify the rows you want to operate on. If binding columns are not
   //   there, that means you want to operate on all rows (full scan). You can view this as a
@@ -424,6 +436,20 @@ class PgApiImpl {
 
   CHECKED_STATUS ExecUpdate(PgStatement *handle);
 
+  //------------------------------------------------------------------------------------------------
+  // Single row writes.
+  // Returns INSERT or UPDATE statement of a single row transaction, that is owned by PgGate and
+  // reused by the following single row writes of the same kind to the same table. The returned
+  // statement is valid until the next call for the same table and must not be deleted.
+  CHECKED_STATUS NewSingleRowWrite(StmtOp stmt_op,
+                                   const PgObjectId& table_id,
+                                   PgStatement **handle);
+
+  // Number of single row writes that were served by a reused statement.
+  uint64_t GetSingleRowWriteReuseCount() const {
+    return single_row_write_reuse_count_;
+  }
+
   //------------------------------------------------------------------------------------------------
   // Delete.
   CHECKED_STATUS NewDelete(const PgObjectId& table_id,
@@ -477,6 +503,7 @@ class PgApiImpl {
   CHECKED_STATUS MaybeResetTransactionReadPoint();
   CHECKED_STATUS CommitTransaction();
   void AbortTransaction();
+  void SetSingleStatementModifyTxn(bool value);
   CHECKED_STATUS SetTransactionIsolationLevel(int isolation);
   CHECKED_STATUS SetTransactionReadOnly(bool read_only);
   CHECKED_STATUS SetTransactionDeferrable(bool deferrable);
@@ -579,6 +606,11 @@ class PgApiImpl {
   std::unordered_map<int, const YBCPgTypeEntity *> type_map_;
 
   scoped_refptr<PgSession> pg_session_;
+
+  // Statements reused by single row writes, see NewSingleRowWrite.
+  std::unordered_map<PgObjectId, std::unique_ptr<PgDmlWrite>, PgObjectIdHash> single_row_inserts_;
+  std::unordered_map<PgObjectId, std::unique_ptr<PgDmlWrite>, PgObjectIdHash> single_row_updates_;
+  uint64_t single_row_write_reuse_count_ = 0;
 };
 
 }  // namespace pggate
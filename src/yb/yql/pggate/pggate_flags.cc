@@ -119,6 +119,46 @@ DEFINE_int32(ysql_max_write_restart_attempts, 20,
 DEFINE_bool(ysql_sleep_before_retry_on_txn_conflict, true,
             "Whether to sleep before retrying the write on transaction conflicts.");
 
+DEFINE_bool(ysql_single_tablet_statement_writes, false,
+            "Whether multi-row writes of a single statement transaction, that all belong to the "
+            "same tablet, are performed atomically by this tablet without distributed "
+            "transaction.");
+
+DEFINE_bool(ysql_dml_via_local_tserver, false,
+            "Whether DML operations are sent to the local tablet server, that performs them on "
+            "behalf of the backend, instead of being sent to tablets by the backend's own client.");
+
+DEFINE_int32(ysql_max_pushdown_order_by_limit, 10000,
+             "Maximum LIMIT of ORDER BY ... LIMIT query, for which every tablet returns only its "
+             "first rows in the requested order instead of all the scanned rows. 0 to disable.");
+
+DEFINE_bool(ysql_enable_catalog_response_cache, false,
+            "Whether catalog reads performed while loading catalog caches are served by the local "
+            "tablet server, that shares responses between backends of the same catalog version.");
+
+DEFINE_bool(ysql_enable_parallel_scan, false,
+            "Whether full and range scans of a multi-tablet table read up to "
+            "ysql_select_parallelism tablets in parallel. Rows are still returned in the order of "
+            "the scan.");
+
+DEFINE_uint64(ysql_parallel_scan_buffer_size, 16 * 1024 * 1024,
+              "Maximum size in bytes of rows that a parallel scan prefetches from tablets that are "
+              "ahead of the tablet being returned.");
+TAG_FLAG(ysql_parallel_scan_buffer_size, advanced);
+
+DEFINE_bool(ysql_enable_columnar_result, false,
+            "Whether scans ask tablet servers to return rows in columnar format, which is faster "
+            "to produce and to translate to Postgres tuples.");
+
+DEFINE_bool(ysql_reuse_single_row_write_statements, true,
+            "Whether INSERT and UPDATE statements of single row transactions are kept by the "
+            "backend and reused by the following single row writes to the same table, instead of "
+            "being allocated and prepared for every written row.");
+
+DEFINE_bool(ysql_enable_block_sampling, false,
+            "Whether ANALYZE samples every tablet by reading rows of its randomly picked SST data "
+            "blocks, instead of scanning tablets one by one until enough rows are scanned.");
+
 // Flag for disabling runContext to Postgres's portal. Currently, each portal has two contexts.
 // - PortalContext whose lifetime lasts for as long as the Portal object.
 // - TmpContext whose lifetime lasts until one associated row of SELECT result set is sent out.
@@ -45,6 +45,15 @@ DECLARE_bool(ysql_beta_feature_tablespace_alteration);
 DECLARE_bool(ysql_serializable_isolation_for_ddl_txn);
 DECLARE_int32(ysql_max_write_restart_attempts);
 DECLARE_bool(ysql_sleep_before_retry_on_txn_conflict);
+DECLARE_bool(ysql_single_tablet_statement_writes);
+DECLARE_bool(ysql_dml_via_local_tserver);
+DECLARE_bool(ysql_enable_catalog_response_cache);
+DECLARE_bool(ysql_enable_parallel_scan);
+DECLARE_uint64(ysql_parallel_scan_buffer_size);
+DECLARE_bool(ysql_enable_columnar_result);
+DECLARE_bool(ysql_reuse_single_row_write_statements);
+DECLARE_bool(ysql_enable_block_sampling);
+DECLARE_int32(ysql_max_pushdown_order_by_limit);
 DECLARE_bool(ysql_disable_portal_run_context);
 
 #endif  // YB_YQL_PGGATE_PGGATE_FLAGS_H
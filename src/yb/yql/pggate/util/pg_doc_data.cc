@@ -19,6 +19,8 @@
 
 #include "yb/common/ql_value.h"
 
+#include "yb/gutil/endian.h"
+
 #include "yb/util/format.h"
 #include "yb/util/status_format.h"
 
@@ -39,6 +41,10 @@ Status WriteColumn(const QLValuePB& col_value, faststring *buffer) {
     return Status::OK();
   }
 
+  return WriteColumnValue(col_value, buffer);
+}
+
+Status WriteColumnValue(const QLValuePB& col_value, faststring *buffer) {
   switch (col_value.value_case()) {
     case InternalType::VALUE_NOT_SET:
       break;
@@ -107,6 +113,123 @@ Status WriteColumn(const QLValuePB& col_value, faststring *buffer) {
   return Status::OK();
 }
 
+//--------------------------------------------------------------------------------------------------
+// Columnar format.
+//--------------------------------------------------------------------------------------------------
+
+PgColumnarResultWriter::PgColumnarResultWriter(size_t num_columns) : columns_(num_columns) {
+}
+
+Status PgColumnarResultWriter::AppendValue(const QLValuePB& value) {
+  auto& column = columns_[next_column_];
+  next_column_ = (next_column_ + 1) % columns_.size();
+
+  const size_t row = column.value_ends.size();
+  if ((row & 7) == 0) {
+    column.nulls.push_back(0);
+  }
+  if (QLValue::IsNull(value)) {
+    column.nulls.back() |= static_cast<uint8_t>(1 << (row & 7));
+  } else {
+    const size_t begin = column.values.size();
+    RETURN_NOT_OK(WriteColumnValue(value, &column.values));
+    const size_t width = column.values.size() - begin;
+    if (column.width == kUnknownWidth) {
+      column.width = width;
+    } else if (column.width != width) {
+      column.width = kMixedWidth;
+    }
+  }
+  SCHECK_LE(column.values.size(), std::numeric_limits<uint32_t>::max(), InvalidArgument,
+            "Too big column for columnar format");
+  column.value_ends.push_back(static_cast<uint32_t>(column.values.size()));
+  return Status::OK();
+}
+
+void PgColumnarResultWriter::Serialize(faststring *buffer) const {
+  DCHECK_EQ(next_column_, 0U);
+  PgWire::WriteUint32(static_cast<uint32_t>(columns_.size()), buffer);
+  for (const auto& column : columns_) {
+    const size_t row_count = column.value_ends.size();
+    if (column.width == kMixedWidth) {
+      PgWire::WriteUint8(to_underlying(PgColumnarFormat::kVariableWidth), buffer);
+      buffer->append(column.nulls.data(), column.nulls.size());
+      PgWire::WriteUint32(0, buffer);
+      for (auto end : column.value_ends) {
+        PgWire::WriteUint32(end, buffer);
+      }
+      buffer->append(column.values.data(), column.values.size());
+      continue;
+    }
+
+    // All values have the same width, so values of NULL rows are filled with zeros, and the value
+    // of any row is found by its index.
+    const size_t width = column.width == kUnknownWidth ? 0 : column.width;
+    PgWire::WriteUint8(to_underlying(PgColumnarFormat::kFixedWidth), buffer);
+    buffer->append(column.nulls.data(), column.nulls.size());
+    PgWire::WriteUint32(static_cast<uint32_t>(width), buffer);
+    if (column.values.size() == row_count * width) {
+      buffer->append(column.values.data(), column.values.size());
+      continue;
+    }
+    uint32_t begin = 0;
+    for (auto end : column.value_ends) {
+      if (end == begin) {
+        buffer->resize(buffer->size() + width);
+        memset(buffer->data() + buffer->size() - width, 0, width);
+      } else {
+        buffer->append(column.values.data() + begin, width);
+      }
+      begin = end;
+    }
+  }
+}
+
+Status PgColumnarColumn::Load(int64_t row_count, Slice *cursor) {
+  const size_t nulls_size = static_cast<size_t>(row_count + 7) / 8;
+  SCHECK_GE(cursor->size(), 1 + nulls_size + sizeof(uint32_t), Corruption,
+            "Columnar rows data is truncated");
+  const auto format = static_cast<PgColumnarFormat>(cursor->data()[0]);
+  nulls_ = cursor->data() + 1;
+  cursor->remove_prefix(1 + nulls_size);
+
+  size_t values_size;
+  switch (format) {
+    case PgColumnarFormat::kFixedWidth: {
+      uint32_t width;
+      cursor->remove_prefix(PgWire::ReadNumber(cursor, &width));
+      width_ = width;
+      offsets_ = nullptr;
+      values_size = width_ * static_cast<size_t>(row_count);
+      break;
+    }
+    case PgColumnarFormat::kVariableWidth: {
+      const size_t offsets_size = static_cast<size_t>(row_count + 1) * sizeof(uint32_t);
+      SCHECK_GE(cursor->size(), offsets_size, Corruption, "Columnar rows data is truncated");
+      offsets_ = cursor->data();
+      values_size = NetworkByteOrder::Load32(offsets_ + offsets_size - sizeof(uint32_t));
+      cursor->remove_prefix(offsets_size);
+      break;
+    }
+    default:
+      return STATUS_FORMAT(Corruption, "Unknown columnar format: $0", format);
+  }
+
+  SCHECK_GE(cursor->size(), values_size, Corruption, "Columnar rows data is truncated");
+  values_ = cursor->data();
+  cursor->remove_prefix(values_size);
+  return Status::OK();
+}
+
+Slice PgColumnarColumn::Value(size_t row) const {
+  if (offsets_ == nullptr) {
+    return Slice(values_ + row * width_, width_);
+  }
+  const auto* offset = offsets_ + row * sizeof(uint32_t);
+  return Slice(values_ + NetworkByteOrder::Load32(offset),
+               values_ + NetworkByteOrder::Load32(offset + sizeof(uint32_t)));
+}
+
 //--------------------------------------------------------------------------------------------------
 // Read Tuple Routine in DocDB Format (wire_protocol).
 //--------------------------------------------------------------------------------------------------
@@ -123,6 +246,19 @@ void PgDocData::LoadCache(const string& cache, int64_t *total_row_count, Slice *
   cursor->remove_prefix(read_size);
 }
 
+Status PgDocData::LoadColumns(
+    int64_t row_count, Slice *cursor, std::vector<PgColumnarColumn> *columns) {
+  SCHECK_GE(cursor->size(), sizeof(uint32_t), Corruption, "Columnar rows data is truncated");
+  uint32_t column_count;
+  cursor->remove_prefix(ReadNumber(cursor, &column_count));
+  columns->resize(column_count);
+  for (auto& column : *columns) {
+    RETURN_NOT_OK(column.Load(row_count, cursor));
+  }
+  SCHECK(cursor->empty(), Corruption, "Unexpected data after columnar rows data");
+  return Status::OK();
+}
+
 PgWireDataHeader PgDocData::ReadDataHeader(Slice *cursor) {
   // Read for NULL value.
   uint8_t header_data;
@@ -14,8 +14,14 @@
 #ifndef YB_YQL_PGGATE_UTIL_PG_DOC_DATA_H_
 #define YB_YQL_PGGATE_UTIL_PG_DOC_DATA_H_
 
+#include <limits>
+#include <vector>
+
 #include "yb/common/common_fwd.h"
 
+#include "yb/util/enums.h"
+#include "yb/util/faststring.h"
+
 #include "yb/yql/pggate/util/pg_wire.h"
 
 namespace yb {
@@ -23,11 +29,78 @@ namespace pggate {
 
 CHECKED_STATUS WriteColumn(const QLValuePB& col_value, faststring *buffer);
 
+// Write value of a column without data header.
+CHECKED_STATUS WriteColumnValue(const QLValuePB& col_value, faststring *buffer);
+
+// Rows data in columnar format. It starts with the number of rows (int64) as in row format,
+// followed by the number of columns (uint32) and the columns. Every column consists of
+// - Column format (uint8).
+// - NULL bitmap, one bit per row: (row_count + 7) / 8 bytes.
+// - kFixedWidth: value width (uint32), followed by values of all rows. NULL values are zeros.
+// - kVariableWidth: row_count + 1 offsets (uint32) in value data, followed by the value data.
+// Values are encoded the same way as in row format, except that data header is not written, so
+// the same functions translate them to Postgres. But the value of any row is accessed directly,
+// without reading all the preceding values.
+YB_DEFINE_ENUM(PgColumnarFormat, ((kFixedWidth, 1))((kVariableWidth, 2)));
+
+class PgColumnarResultWriter {
+ public:
+  explicit PgColumnarResultWriter(size_t num_columns);
+
+  // Append value of the next column of the current row. Rows are completed when values of all
+  // columns are appended.
+  CHECKED_STATUS AppendValue(const QLValuePB& value);
+
+  // Append columns to the buffer, that already contains the number of rows.
+  void Serialize(faststring *buffer) const;
+
+ private:
+  struct Column {
+    // Values of rows, and the offset of the end of every row value.
+    faststring values;
+    std::vector<uint32_t> value_ends;
+    std::vector<uint8_t> nulls;
+
+    // Width of all non NULL values, or kMixedWidth if widths are different.
+    size_t width = kUnknownWidth;
+  };
+
+  static constexpr size_t kUnknownWidth = std::numeric_limits<size_t>::max();
+  static constexpr size_t kMixedWidth = kUnknownWidth - 1;
+
+  std::vector<Column> columns_;
+  size_t next_column_ = 0;
+};
+
+// Column of rows data in columnar format.
+class PgColumnarColumn {
+ public:
+  // Load column from the beginning of cursor, and remove it from cursor.
+  CHECKED_STATUS Load(int64_t row_count, Slice *cursor);
+
+  bool IsNull(size_t row) const {
+    return (nulls_[row >> 3] >> (row & 7)) & 1;
+  }
+
+  // Encoded value of the row, as in row format without data header.
+  Slice Value(size_t row) const;
+
+ private:
+  const uint8_t* nulls_ = nullptr;
+  const uint8_t* offsets_ = nullptr;
+  const uint8_t* values_ = nullptr;
+  size_t width_ = 0;
+};
+
 class PgDocData : public PgWire {
  public:
   static void LoadCache(const std::string& data, int64_t *total_row_count, Slice *cursor);
 
   static PgWireDataHeader ReadDataHeader(Slice *cursor);
+
+  // Load columns of rows data in columnar format, that follow the number of rows.
+  static CHECKED_STATUS LoadColumns(
+      int64_t row_count, Slice *cursor, std::vector<PgColumnarColumn> *columns);
 };
 
 }  // namespace pggate
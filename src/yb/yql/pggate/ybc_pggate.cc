@@ -165,6 +165,10 @@ void YBCPgResetCatalogReadTime() {
   return pgapi->ResetCatalogReadTime();
 }
 
+void YBCPgSetCatalogReadCaching(uint64_t catalog_version) {
+  pgapi->SetCatalogReadCaching(catalog_version);
+}
+
 YBCStatus YBCPgResetMemctx(YBCPgMemctx memctx) {
   return ToYBCStatus(pgapi->ResetMemctx(memctx));
 }
@@ -576,6 +580,19 @@ YBCStatus YBCPgDmlAppendTarget(YBCPgStatement handle, YBCPgExpr target) {
   return ToYBCStatus(pgapi->DmlAppendTarget(handle, target));
 }
 
+YBCStatus YBCPgDmlAppendGroupBy(YBCPgStatement handle, YBCPgExpr expr) {
+  return ToYBCStatus(pgapi->DmlAppendGroupBy(handle, expr));
+}
+
+YBCStatus YBCPgDmlAppendOrderBy(YBCPgStatement handle, YBCPgExpr expr, bool is_descending,
+                                bool nulls_first) {
+  return ToYBCStatus(pgapi->DmlAppendOrderBy(handle, expr, is_descending, nulls_first));
+}
+
+YBCStatus YBCPgDmlSetOrderByLimit(YBCPgStatement handle, uint64_t limit) {
+  return ToYBCStatus(pgapi->DmlSetOrderByLimit(handle, limit));
+}
+
 YBCStatus YBCPgDmlBindColumn(YBCPgStatement handle, int attr_num, YBCPgExpr attr_value) {
   return ToYBCStatus(pgapi->DmlBindColumn(handle, attr_num, attr_value));
 }
@@ -718,6 +735,25 @@ bool YBCGetEnableUpdateBatching() {
   return FLAGS_ysql_enable_update_batching;
 }
 
+// Single row INSERT and UPDATE Operations ---------------------------------------------------------
+YBCStatus YBCPgNewSingleRowInsert(const YBCPgOid database_oid,
+                                  const YBCPgOid table_oid,
+                                  YBCPgStatement *handle) {
+  const PgObjectId table_id(database_oid, table_oid);
+  return ToYBCStatus(pgapi->NewSingleRowWrite(StmtOp::STMT_INSERT, table_id, handle));
+}
+
+YBCStatus YBCPgNewSingleRowUpdate(const YBCPgOid database_oid,
+                                  const YBCPgOid table_oid,
+                                  YBCPgStatement *handle) {
+  const PgObjectId table_id(database_oid, table_oid);
+  return ToYBCStatus(pgapi->NewSingleRowWrite(StmtOp::STMT_UPDATE, table_id, handle));
+}
+
+uint64_t YBCPgGetSingleRowWriteReuseCount() {
+  return pgapi->GetSingleRowWriteReuseCount();
+}
+
 // DELETE Operations -------------------------------------------------------------------------------
 YBCStatus YBCPgNewDelete(const YBCPgOid database_oid,
                          const YBCPgOid table_oid,
@@ -940,6 +976,10 @@ YBCStatus YBCPgExitSeparateDdlTxnMode() {
   return ToYBCStatus(pgapi->ExitSeparateDdlTxnMode());
 }
 
+void YBCPgSetSingleStatementModifyTxn(bool value) {
+  pgapi->SetSingleStatementModifyTxn(value);
+}
+
 void YBCPgClearSeparateDdlTxnMode() {
   pgapi->ClearSeparateDdlTxnMode();
 }
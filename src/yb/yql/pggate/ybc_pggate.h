@@ -290,6 +290,18 @@ YBCStatus YBCPgBackfillIndex(
 // - INSERT / UPDATE / DELETE ... RETURNING target_expr1, target_expr2, ...
 YBCStatus YBCPgDmlAppendTarget(YBCPgStatement handle, YBCPgExpr target);
 
+// This function is for specifying the grouping columns of aggregate targets. Grouping columns
+// should also be appended as targets, and partial aggregate results are returned per group.
+// - SELECT column_l, count(*) FROM a_table GROUP BY column_l;
+YBCStatus YBCPgDmlAppendGroupBy(YBCPgStatement handle, YBCPgExpr expr);
+
+// These functions are for specifying the sort keys and the number of rows of top-N read. Every
+// tablet returns only its first rows in the requested order, and the caller has to merge them.
+// - SELECT * FROM a_table ORDER BY column_l DESC LIMIT 100;
+YBCStatus YBCPgDmlAppendOrderBy(YBCPgStatement handle, YBCPgExpr expr, bool is_descending,
+                                bool nulls_first);
+YBCStatus YBCPgDmlSetOrderByLimit(YBCPgStatement handle, uint64_t limit);
+
 // Binding Columns: Bind column with a value (expression) in a statement.
 // + This API is used to identify the rows you want to operate on. If binding columns are not
 //   there, that means you want to operate on all rows (full scan). You can view this as a
@@ -400,6 +412,21 @@ YBCStatus YBCPgExecUpdate(YBCPgStatement handle);
 // Retrieve value of ysql_enable_update_batching gflag.
 bool YBCGetEnableUpdateBatching();
 
+// Single row INSERT and UPDATE --------------------------------------------------------------------
+// Return statement of a single row transaction that is kept by PgGate and reused by the following
+// single row writes of the same kind to the same table. Such statement must not be deleted with
+// YBCPgDeleteStatement().
+YBCStatus YBCPgNewSingleRowInsert(YBCPgOid database_oid,
+                                  YBCPgOid table_oid,
+                                  YBCPgStatement *handle);
+
+YBCStatus YBCPgNewSingleRowUpdate(YBCPgOid database_oid,
+                                  YBCPgOid table_oid,
+                                  YBCPgStatement *handle);
+
+// Number of single row writes that reused the statement of a previous write.
+uint64_t YBCPgGetSingleRowWriteReuseCount();
+
 // DELETE ------------------------------------------------------------------------------------------
 YBCStatus YBCPgNewDelete(YBCPgOid database_oid,
                          YBCPgOid table_oid,
@@ -443,6 +470,7 @@ YBCStatus YBCPgEnableFollowerReads(bool enable_follower_reads, int32_t staleness
 YBCStatus YBCPgEnterSeparateDdlTxnMode();
 YBCStatus YBCPgExitSeparateDdlTxnMode();
 void YBCPgClearSeparateDdlTxnMode();
+void YBCPgSetSingleStatementModifyTxn(bool value);
 YBCStatus YBCPgSetActiveSubTransaction(uint32_t id);
 YBCStatus YBCPgRollbackSubTransaction(uint32_t id);
 
@@ -560,6 +588,10 @@ const void* YBCPgGetThreadLocalErrMsg();
 
 void YBCPgResetCatalogReadTime();
 
+// While catalog_version is not zero, catalog reads could be served from the responses of other
+// backends of the node, that read catalog of the same version.
+void YBCPgSetCatalogReadCaching(uint64_t catalog_version);
+
 YBCStatus YBCGetTabletServerHosts(YBCServerDescriptor **tablet_servers, size_t* numservers);
 
 #ifdef __cplusplus
@@ -34,12 +34,14 @@
 #include "yb/server/skewed_clock.h"
 
 #include "yb/tablet/tablet.h"
+#include "yb/tablet/tablet_metrics.h"
 #include "yb/tablet/tablet_peer.h"
 #include "yb/tablet/transaction_participant.h"
 
 #include "yb/tools/tools_test_utils.h"
 
 #include "yb/util/atomic.h"
+#include "yb/util/metrics.h"
 #include "yb/util/random_util.h"
 #include "yb/util/scope_exit.h"
 #include "yb/util/status_log.h"
@@ -61,6 +63,7 @@ DECLARE_double(TEST_transaction_ignore_applying_probability);
 DECLARE_int32(history_cutoff_propagation_interval_ms);
 DECLARE_int32(timestamp_history_retention_interval_sec);
 DECLARE_int32(txn_max_apply_batch_records);
+DECLARE_int32(txn_apply_ingest_min_records);
 DECLARE_int64(apply_intents_task_injected_delay_ms);
 DECLARE_uint64(max_clock_skew_usec);
 DECLARE_int64(db_write_buffer_size);
@@ -81,6 +84,9 @@ DECLARE_int64(db_filter_block_size_bytes);
 DECLARE_int64(db_index_block_size_bytes);
 DECLARE_int64(tablet_force_split_threshold_bytes);
 DECLARE_int64(TEST_inject_random_delay_on_txn_status_response_ms);
+DECLARE_int32(ysql_prepared_pushdown_expr_cache_size);
+DECLARE_uint64(pgsql_grouped_aggregate_memory_limit_bytes);
+DECLARE_bool(pgsql_enable_columnar_result);
 
 namespace yb {
 namespace pgwrapper {
@@ -1631,6 +1637,33 @@ TEST_F_EX(PgMiniTest, YB_DISABLE_TEST_IN_TSAN(ManyRowsInsert), PgMiniSingleTServ
   LOG(INFO) << "Time: " << finish - start;
 }
 
+// Compares single row updates with pushed down SET expression, when expression is deserialized
+// for each row and when prepared expression is reused.
+TEST_F_EX(PgMiniTest, YB_DISABLE_TEST_IN_TSAN(PushdownExprPerf), PgMiniSingleTServerTest) {
+  constexpr int kRows = RegularBuildVsSanitizers(5000, 500);
+  auto conn = ASSERT_RESULT(Connect());
+
+  ASSERT_OK(conn.Execute("CREATE TABLE t (key INT PRIMARY KEY, value BIGINT)"));
+  ASSERT_OK(conn.ExecuteFormat(
+      "INSERT INTO t SELECT i, i FROM generate_series(1, $0) AS i", kRows));
+
+  int64_t expected_sum = kRows * (kRows + 1) / 2;
+  for (int cache_size : {0, 64}) {
+    FLAGS_ysql_prepared_pushdown_expr_cache_size = cache_size;
+    auto start = MonoTime::Now();
+    for (int i = 1; i <= kRows; ++i) {
+      ASSERT_OK(conn.ExecuteFormat(
+          "UPDATE t SET value = value * 3 - value * 2 + 1 WHERE key = $0", i));
+    }
+    auto finish = MonoTime::Now();
+    LOG(INFO) << "Cache size: " << cache_size << ", time: " << finish - start;
+
+    expected_sum += kRows;
+    auto sum = ASSERT_RESULT(conn.FetchValue<int64_t>("SELECT SUM(value)::BIGINT FROM t"));
+    ASSERT_EQ(sum, expected_sum);
+  }
+}
+
 TEST_F(PgMiniTest, YB_DISABLE_TEST_IN_TSAN(MoveMaster)) {
   ShutdownAllMasters(cluster_.get());
   cluster_->mini_master(0)->set_pass_master_addresses(false);
@@ -1996,6 +2029,456 @@ TEST_F(PgMiniTest, YB_DISABLE_TEST_IN_TSAN(BigInsertWithRestart)) {
   TestBigInsert(/* restart= */ true);
 }
 
+TEST_F(PgMiniTest, YB_DISABLE_TEST_IN_TSAN(BigInsertWithIngestion)) {
+  FLAGS_txn_apply_ingest_min_records = 1;
+  TestBigInsert(/* restart= */ false);
+
+  // Batch that overlaps the initially inserted row is written through the memtable, but the
+  // other batches should be ingested.
+  int64_t ingested_files = 0;
+  for (const auto& peer : ListTabletPeers(cluster_.get(), ListPeersFilter::kAll)) {
+    auto tablet = peer->shared_tablet();
+    if (tablet) {
+      ingested_files += tablet->metrics()->transaction_apply_ingested_files->value();
+    }
+  }
+  ASSERT_GT(ingested_files, 0);
+}
+
+class PgMiniSingleTabletStatementTest : public PgMiniTest {
+ protected:
+  void BeforePgProcessStart() override {
+    FLAGS_ysql_single_tablet_statement_writes = true;
+  }
+};
+
+// Concurrent multi-row updates of the same hash key are written without distributed transaction,
+// so check that none of them is lost.
+TEST_F_EX(PgMiniTest, YB_DISABLE_TEST_IN_TSAN(SingleTabletStatementUpdate),
+          PgMiniSingleTabletStatementTest) {
+  constexpr int kNumRows = 10;
+  constexpr int kNumThreads = 4;
+
+  auto conn = ASSERT_RESULT(Connect());
+  ASSERT_OK(conn.Execute("CREATE TABLE t (h INT, r INT, v INT, PRIMARY KEY (h HASH, r ASC))"));
+  ASSERT_OK(conn.ExecuteFormat(
+      "INSERT INTO t SELECT 1, generate_series(1, $0), 0", kNumRows));
+
+  std::atomic<int> num_updates(0);
+  TestThreadHolder thread_holder;
+  for (int i = 0; i != kNumThreads; ++i) {
+    thread_holder.AddThreadFunctor([this, &num_updates, &stop = thread_holder.stop_flag()] {
+      auto update_conn = ASSERT_RESULT(Connect());
+      while (!stop.load(std::memory_order_acquire)) {
+        auto status = update_conn.Execute("UPDATE t SET v = v + 1 WHERE h = 1");
+        if (status.ok()) {
+          ++num_updates;
+        } else {
+          ASSERT_EQ(PgsqlError(status), YBPgErrorCode::YB_PG_T_R_SERIALIZATION_FAILURE)
+              << status;
+        }
+      }
+    });
+  }
+  thread_holder.WaitAndStop(10s);
+
+  ASSERT_GT(num_updates.load(), 0);
+  auto values = ASSERT_RESULT(conn.FetchMatrix("SELECT DISTINCT v FROM t", 1, 1));
+  ASSERT_EQ(ASSERT_RESULT(GetInt32(values.get(), 0, 0)), num_updates.load());
+}
+
+class PgMiniDmlViaLocalTServerTest : public PgMiniTest {
+ protected:
+  void BeforePgProcessStart() override {
+    FLAGS_ysql_dml_via_local_tserver = true;
+  }
+};
+
+// Operations performed by the local tablet server should belong to the transaction of backend,
+// so they are committed and rolled back together with it.
+TEST_F_EX(PgMiniTest, YB_DISABLE_TEST_IN_TSAN(DmlViaLocalTServer), PgMiniDmlViaLocalTServerTest) {
+  constexpr int kNumRows = 100;
+
+  auto conn = ASSERT_RESULT(Connect());
+  ASSERT_OK(conn.Execute("CREATE TABLE t (key INT PRIMARY KEY, value INT)"));
+  ASSERT_OK(conn.ExecuteFormat(
+      "INSERT INTO t SELECT generate_series(1, $0), 0", kNumRows));
+
+  for (bool commit : {false, true}) {
+    ASSERT_OK(conn.StartTransaction(IsolationLevel::SNAPSHOT_ISOLATION));
+    ASSERT_OK(conn.ExecuteFormat("UPDATE t SET value = value + 1 WHERE key <= $0", kNumRows / 2));
+    auto sum = ASSERT_RESULT(conn.FetchValue<int64_t>("SELECT SUM(value) FROM t"));
+    ASSERT_EQ(sum, kNumRows / 2);
+    if (commit) {
+      ASSERT_OK(conn.CommitTransaction());
+    } else {
+      ASSERT_OK(conn.RollbackTransaction());
+    }
+    sum = ASSERT_RESULT(conn.FetchValue<int64_t>("SELECT SUM(value) FROM t"));
+    ASSERT_EQ(sum, commit ? kNumRows / 2 : 0);
+  }
+
+  auto count = ASSERT_RESULT(conn.FetchValue<int64_t>("SELECT COUNT(*) FROM t"));
+  ASSERT_EQ(count, kNumRows);
+}
+
+class PgMiniCatalogResponseCacheTest : public PgMiniSingleTServerTest {
+ protected:
+  void BeforePgProcessStart() override {
+    FLAGS_ysql_enable_catalog_response_cache = true;
+  }
+};
+
+// Backends connecting concurrently share catalog reads, while catalog changes should be visible
+// to backends that connect after them.
+TEST_F_EX(PgMiniTest, YB_DISABLE_TEST_IN_TSAN(CatalogResponseCache),
+          PgMiniCatalogResponseCacheTest) {
+  constexpr int kNumThreads = 8;
+  constexpr int kConnectionsPerThread = RegularBuildVsSanitizers(10, 2);
+
+  auto conn = ASSERT_RESULT(Connect());
+  ASSERT_OK(conn.Execute("CREATE TABLE t (key INT PRIMARY KEY)"));
+  ASSERT_OK(conn.Execute("INSERT INTO t VALUES (1)"));
+
+  for (int columns = 1; columns <= 2; ++columns) {
+    TestThreadHolder thread_holder;
+    auto start = MonoTime::Now();
+    for (int i = 0; i != kNumThreads; ++i) {
+      thread_holder.AddThreadFunctor([this, columns] {
+        for (int j = 0; j != kConnectionsPerThread; ++j) {
+          auto thread_conn = ASSERT_RESULT(Connect());
+          auto result = ASSERT_RESULT(thread_conn.Fetch("SELECT * FROM t"));
+          ASSERT_EQ(PQnfields(result.get()), columns);
+        }
+      });
+    }
+    thread_holder.JoinAll();
+    LOG(INFO) << "Columns: " << columns << ", connection time: "
+              << (MonoTime::Now() - start) / (kNumThreads * kConnectionsPerThread);
+
+    ASSERT_OK(conn.Execute("ALTER TABLE t ADD COLUMN value INT"));
+  }
+}
+
+// Batched nested loop join should return the same rows as the regular one, including outer rows
+// with null or duplicate join keys and outer rows without match.
+TEST_F(PgMiniTest, YB_DISABLE_TEST_IN_TSAN(BatchedNestLoopJoin)) {
+  constexpr int kOuterRows = 500;
+  constexpr int kInnerRows = 100;
+  constexpr int kBatchSize = 16;
+
+  auto conn = ASSERT_RESULT(Connect());
+  ASSERT_OK(conn.Execute("CREATE TABLE o (k INT PRIMARY KEY, v INT)"));
+  ASSERT_OK(conn.Execute("CREATE TABLE i (k INT PRIMARY KEY, v INT)"));
+  ASSERT_OK(conn.ExecuteFormat(
+      "INSERT INTO o SELECT s, CASE WHEN s % 7 = 0 THEN NULL ELSE s % $0 END "
+      "FROM generate_series(1, $1) AS s", kInnerRows * 2, kOuterRows));
+  ASSERT_OK(conn.ExecuteFormat(
+      "INSERT INTO i SELECT s, s * 10 FROM generate_series(1, $0) AS s", kInnerRows));
+  ASSERT_OK(conn.Execute("SET enable_hashjoin = off"));
+  ASSERT_OK(conn.Execute("SET enable_mergejoin = off"));
+
+  const std::string kQueries[] = {
+    "SELECT COUNT(*), SUM(i.v) FROM o JOIN i ON i.k = o.v",
+    "SELECT COUNT(*), SUM(i.v) FROM o LEFT JOIN i ON o.v = i.k",
+    "SELECT COUNT(*), SUM(o.k) FROM o WHERE EXISTS (SELECT 1 FROM i WHERE i.k = o.v)",
+    "SELECT COUNT(*), SUM(o.k) FROM o WHERE NOT EXISTS (SELECT 1 FROM i WHERE i.k = o.v)",
+  };
+  for (const auto& query : kQueries) {
+    std::string expected;
+    for (int batch_size : {1, kBatchSize}) {
+      ASSERT_OK(conn.ExecuteFormat("SET yb_bnl_batch_size = $0", batch_size));
+      auto plan = ASSERT_RESULT(conn.Fetch("EXPLAIN " + query));
+      bool batched = false;
+      for (int row = 0; row != PQntuples(plan.get()); ++row) {
+        auto line = ASSERT_RESULT(GetString(plan.get(), row, 0));
+        batched = batched || line.find("Batch Size") != std::string::npos;
+      }
+      // Plain join is always batched, other joins could be planned differently.
+      if (batch_size == 1 || &query == kQueries) {
+        ASSERT_EQ(batched, batch_size > 1) << query;
+      }
+
+      auto start = MonoTime::Now();
+      auto result = ASSERT_RESULT(conn.FetchMatrix(query, 1, 2));
+      auto finish = MonoTime::Now();
+      auto row = ASSERT_RESULT(GetString(result.get(), 0, 0)) + ", " +
+                 ASSERT_RESULT(GetString(result.get(), 0, 1));
+      LOG(INFO) << query << ", batch size: " << batch_size << ", result: " << row
+                << ", time: " << finish - start;
+      if (batch_size == 1) {
+        expected = row;
+      } else {
+        ASSERT_EQ(row, expected) << query;
+      }
+    }
+  }
+}
+
+TEST_F(PgMiniTest, YB_DISABLE_TEST_IN_TSAN(GroupByAggregatePushdown)) {
+  constexpr int kNumRows = 1000;
+  constexpr int kNumNullRows = 10;
+  constexpr int kNumGroups = 10;
+
+  auto conn = ASSERT_RESULT(Connect());
+  ASSERT_OK(conn.Execute("CREATE TABLE t (k INT PRIMARY KEY, g INT, v INT) SPLIT INTO 3 TABLETS"));
+  ASSERT_OK(conn.ExecuteFormat(
+      "INSERT INTO t SELECT s, CASE WHEN s > $0 THEN NULL ELSE s % $1 END, s "
+      "FROM generate_series(1, $2) AS s", kNumRows, kNumGroups, kNumRows + kNumNullRows));
+  // Make hash aggregation preferable to sorting the scan output.
+  ASSERT_OK(conn.Execute("SET enable_sort = off"));
+
+  const std::string kQuery = "SELECT g, COUNT(*), SUM(v), MIN(v), MAX(v) FROM t GROUP BY g";
+  auto plan = ASSERT_RESULT(conn.Fetch("EXPLAIN " + kQuery));
+  auto plan_root = ASSERT_RESULT(GetString(plan.get(), 0, 0));
+  ASSERT_NE(plan_root.find("HashAggregate"), std::string::npos) << plan_root;
+
+  // Small memory limit makes DocDB return partial results of the same group several times.
+  for (uint64_t memory_limit : {FLAGS_pgsql_grouped_aggregate_memory_limit_bytes, 1UL}) {
+    FLAGS_pgsql_grouped_aggregate_memory_limit_bytes = memory_limit;
+    auto result = ASSERT_RESULT(conn.FetchMatrix(kQuery, kNumGroups + 1, 5));
+    for (int row = 0; row != kNumGroups + 1; ++row) {
+      auto count = ASSERT_RESULT(GetInt64(result.get(), row, 1));
+      auto sum = ASSERT_RESULT(GetInt64(result.get(), row, 2));
+      auto min = ASSERT_RESULT(GetInt32(result.get(), row, 3));
+      auto max = ASSERT_RESULT(GetInt32(result.get(), row, 4));
+      if (PQgetisnull(result.get(), row, 0)) {
+        ASSERT_EQ(count, kNumNullRows);
+        ASSERT_EQ(min, kNumRows + 1);
+        ASSERT_EQ(max, kNumRows + kNumNullRows);
+        ASSERT_EQ(sum, (2 * kNumRows + kNumNullRows + 1) * kNumNullRows / 2);
+        continue;
+      }
+      auto group = ASSERT_RESULT(GetInt32(result.get(), row, 0));
+      auto first = group == 0 ? kNumGroups : group;
+      auto last = kNumRows - kNumGroups + first;
+      ASSERT_EQ(count, kNumRows / kNumGroups) << "group: " << group;
+      ASSERT_EQ(min, first) << "group: " << group;
+      ASSERT_EQ(max, last) << "group: " << group;
+      ASSERT_EQ(sum, (first + last) * count / 2) << "group: " << group;
+    }
+  }
+}
+
+TEST_F(PgMiniTest, YB_DISABLE_TEST_IN_TSAN(OrderByLimitPushdown)) {
+  constexpr int kNumRows = 1000;
+  constexpr int kNumNullRows = 5;
+  constexpr int kLimit = 10;
+
+  auto conn = ASSERT_RESULT(Connect());
+  ASSERT_OK(conn.Execute(
+      "CREATE TABLE t (k INT PRIMARY KEY, ts INT, name TEXT) SPLIT INTO 3 TABLETS"));
+  ASSERT_OK(conn.ExecuteFormat(
+      "INSERT INTO t SELECT s, CASE WHEN s > $0 THEN NULL ELSE s * 7919 % $0 END, 'name_' || s "
+      "FROM generate_series(1, $1) AS s", kNumRows, kNumRows + kNumNullRows));
+
+  // Sort by expression is not pushed down, so it provides the expected result.
+  const std::pair<std::string, std::string> kOrders[] = {
+    {"ts DESC, k", "ts + 0 DESC, k"},
+    {"ts, k", "ts + 0, k"},
+    {"ts DESC NULLS LAST, k", "ts + 0 DESC NULLS LAST, k"},
+    {"name DESC", "name || '' DESC"},
+  };
+  for (const auto& order : kOrders) {
+    for (const auto& limit : {Format("LIMIT $0", kLimit), Format("LIMIT $0 OFFSET 3", kLimit)}) {
+      std::vector<int32_t> keys[2];
+      for (int i = 0; i != 2; ++i) {
+        auto query = Format(
+            "SELECT k FROM t ORDER BY $0 $1", i == 0 ? order.first : order.second, limit);
+        auto result = ASSERT_RESULT(conn.FetchMatrix(query, kLimit, 1));
+        for (int row = 0; row != kLimit; ++row) {
+          keys[i].push_back(ASSERT_RESULT(GetInt32(result.get(), row, 0)));
+        }
+      }
+      ASSERT_EQ(keys[0], keys[1]) << order.first << " " << limit;
+    }
+  }
+}
+
+class PgMiniParallelScanTest : public PgMiniTest {
+ protected:
+  void BeforePgProcessStart() override {
+    FLAGS_ysql_enable_parallel_scan = true;
+    // Use small pages and buffer, so streams are paused while they are ahead of the scan.
+    FLAGS_ysql_prefetch_limit = 64;
+    FLAGS_ysql_parallel_scan_buffer_size = 4_KB;
+  }
+};
+
+// Parallel scan reads all tablets at once, but rows should be returned in the order of the scan.
+TEST_F_EX(PgMiniTest, YB_DISABLE_TEST_IN_TSAN(ParallelScan), PgMiniParallelScanTest) {
+  constexpr int kNumRows = 1000;
+
+  auto conn = ASSERT_RESULT(Connect());
+  ASSERT_OK(conn.Execute(
+      "CREATE TABLE t (k INT, v TEXT, PRIMARY KEY (k ASC)) "
+      "SPLIT AT VALUES ((100), (200), (300), (500), (700), (800), (900))"));
+  ASSERT_OK(conn.ExecuteFormat(
+      "INSERT INTO t SELECT s, repeat('x', s % 100) FROM generate_series(1, $0) AS s", kNumRows));
+
+  auto result = ASSERT_RESULT(conn.FetchMatrix("SELECT k FROM t", kNumRows, 1));
+  for (int row = 0; row != kNumRows; ++row) {
+    ASSERT_EQ(ASSERT_RESULT(GetInt32(result.get(), row, 0)), row + 1);
+  }
+
+  constexpr int kMinKey = 250;
+  result = ASSERT_RESULT(conn.FetchMatrix(
+      Format("SELECT k, v FROM t WHERE k > $0 ORDER BY k DESC", kMinKey), kNumRows - kMinKey, 2));
+  for (int row = 0; row != kNumRows - kMinKey; ++row) {
+    ASSERT_EQ(ASSERT_RESULT(GetInt32(result.get(), row, 0)), kNumRows - row);
+  }
+
+  ASSERT_OK(conn.Execute("CREATE TABLE h (k INT PRIMARY KEY, v TEXT) SPLIT INTO 8 TABLETS"));
+  ASSERT_OK(conn.ExecuteFormat(
+      "INSERT INTO h SELECT s, repeat('x', s % 100) FROM generate_series(1, $0) AS s", kNumRows));
+  result = ASSERT_RESULT(conn.FetchMatrix("SELECT k FROM h", kNumRows, 1));
+  int64_t sum = 0;
+  for (int row = 0; row != kNumRows; ++row) {
+    sum += ASSERT_RESULT(GetInt32(result.get(), row, 0));
+  }
+  ASSERT_EQ(sum, kNumRows * (kNumRows + 1) / 2);
+}
+
+class PgMiniColumnarResultTest : public PgMiniTest {
+ protected:
+  void BeforePgProcessStart() override {
+    FLAGS_ysql_enable_columnar_result = true;
+  }
+};
+
+// Rows returned in columnar format should be the same as rows returned in row format.
+TEST_F_EX(PgMiniTest, YB_DISABLE_TEST_IN_TSAN(ColumnarResult), PgMiniColumnarResultTest) {
+  constexpr int kNumRows = RegularBuildVsSanitizers(20000, 2000);
+
+  auto conn = ASSERT_RESULT(Connect());
+  ASSERT_OK(conn.Execute(
+      "CREATE TABLE t (k INT PRIMARY KEY, i BIGINT, b BOOL, d DOUBLE PRECISION, t TEXT, "
+      "n NUMERIC, ts TIMESTAMP, y BYTEA) SPLIT INTO 3 TABLETS"));
+  ASSERT_OK(conn.ExecuteFormat(
+      "INSERT INTO t SELECT s, "
+      "CASE WHEN s % 7 = 0 THEN NULL ELSE s * 1000003 END, s % 2 = 0, s / 3.0, "
+      "CASE WHEN s % 5 = 0 THEN NULL ELSE repeat('x', s % 17) END, s / 7.0, "
+      "'2021-01-01'::TIMESTAMP + s * INTERVAL '1 minute', "
+      "CASE WHEN s % 11 = 0 THEN NULL ELSE decode(repeat('ab', s % 5), 'hex') END "
+      "FROM generate_series(1, $0) AS s", kNumRows));
+
+  const std::string kQuery = "SELECT k, i, b, d, t, n, ts, y, ybctid FROM t WHERE k % 3 <> 0";
+  std::vector<std::string> rows[2];
+  for (bool columnar : {false, true}) {
+    FLAGS_pgsql_enable_columnar_result = columnar;
+    auto start = MonoTime::Now();
+    auto result = ASSERT_RESULT(conn.Fetch(kQuery));
+    auto elapsed = MonoTime::Now() - start;
+    const int num_rows = PQntuples(result.get());
+    LOG(INFO) << (columnar ? "Columnar" : "Row") << " format: " << num_rows << " rows in "
+              << elapsed << ", " << elapsed.ToNanoseconds() / std::max(num_rows, 1) << "ns per row";
+    for (int row = 0; row != num_rows; ++row) {
+      std::string line;
+      for (int column = 0; column != PQnfields(result.get()); ++column) {
+        line += PQgetisnull(result.get(), row, column)
+            ? "NULL" : ASSERT_RESULT(GetString(result.get(), row, column));
+        line += "|";
+      }
+      rows[columnar].push_back(std::move(line));
+    }
+    std::sort(rows[columnar].begin(), rows[columnar].end());
+  }
+  ASSERT_EQ(rows[0].size(), static_cast<size_t>(kNumRows - kNumRows / 3));
+  ASSERT_EQ(rows[0], rows[1]);
+
+  // Index scan reads ybctids of the indexed table in columnar format.
+  ASSERT_OK(conn.Execute("CREATE INDEX ON t (i)"));
+  auto count = ASSERT_RESULT(conn.FetchValue<int64_t>(
+      "SELECT COUNT(t) FROM t WHERE i > 1000003 * 100"));
+  ASSERT_EQ(count, (kNumRows - 100) - (kNumRows / 7 - 100 / 7));
+}
+
+// Prepared single row inserts and updates reuse the write statement kept by the backend for the
+// table, which should not change their results, also after the table is altered or a write fails.
+TEST_F(PgMiniTest, YB_DISABLE_TEST_IN_TSAN(SingleRowWriteReuse)) {
+  constexpr int kNumRows = RegularBuildVsSanitizers(5000, 500);
+
+  auto conn = ASSERT_RESULT(Connect());
+  ASSERT_OK(conn.Execute("CREATE TABLE t (k INT PRIMARY KEY, v TEXT)"));
+  ASSERT_OK(conn.Execute("PREPARE ins (INT, TEXT) AS INSERT INTO t VALUES ($1, $2)"));
+  ASSERT_OK(conn.Execute("PREPARE upd (INT, TEXT) AS UPDATE t SET v = $2 WHERE k = $1"));
+
+  auto start = MonoTime::Now();
+  for (int i = 1; i <= kNumRows; ++i) {
+    ASSERT_OK(conn.ExecuteFormat("EXECUTE ins($0, 'v$0')", i));
+  }
+  auto elapsed = MonoTime::Now() - start;
+  LOG(INFO) << "Inserted " << kNumRows << " rows in " << elapsed << ", "
+            << elapsed.ToNanoseconds() / kNumRows << "ns per row";
+
+  // Failed insert should not affect the following ones.
+  ASSERT_NOK(conn.Execute("EXECUTE ins(1, 'duplicate')"));
+  ASSERT_NOK(conn.Execute("EXECUTE ins(NULL, 'null')"));
+
+  for (int i = 1; i <= kNumRows; i += 2) {
+    ASSERT_OK(conn.ExecuteFormat("EXECUTE upd($0, 'u$0')", i));
+  }
+
+  // Statement reused after the table is altered should use the new schema.
+  ASSERT_OK(conn.Execute("ALTER TABLE t ADD COLUMN w INT"));
+  ASSERT_OK(conn.Execute("DEALLOCATE ins"));
+  ASSERT_OK(conn.Execute("PREPARE ins (INT, TEXT, INT) AS INSERT INTO t VALUES ($1, $2, $3)"));
+  for (int i = kNumRows + 1; i <= kNumRows + 10; ++i) {
+    ASSERT_OK(conn.ExecuteFormat("EXECUTE ins($0, 'v$0', $0)", i));
+  }
+  ASSERT_OK(conn.ExecuteFormat("EXECUTE upd($0, 'u$0')", kNumRows + 2));
+
+  auto result = ASSERT_RESULT(conn.Fetch("SELECT k, v, w FROM t ORDER BY k"));
+  ASSERT_EQ(PQntuples(result.get()), kNumRows + 10);
+  for (int row = 0; row != kNumRows + 10; ++row) {
+    const auto key = ASSERT_RESULT(GetInt32(result.get(), row, 0));
+    ASSERT_EQ(key, row + 1);
+    const bool updated = key % 2 == 1 ? key <= kNumRows : key == kNumRows + 2;
+    ASSERT_EQ(ASSERT_RESULT(GetString(result.get(), row, 1)),
+              Format("$0$1", updated ? "u" : "v", key));
+    if (key <= kNumRows) {
+      ASSERT_TRUE(PQgetisnull(result.get(), row, 2));
+    } else {
+      ASSERT_EQ(ASSERT_RESULT(GetInt32(result.get(), row, 2)), key);
+    }
+  }
+}
+
+class PgMiniBlockSamplingTest : public PgMiniTest {
+ protected:
+  void SetUp() override {
+    FLAGS_db_block_size_bytes = 2_KB;
+    PgMiniTest::SetUp();
+  }
+
+  void BeforePgProcessStart() override {
+    FLAGS_ysql_enable_block_sampling = true;
+  }
+};
+
+// ANALYZE reads only some data blocks of each tablet, so row count is estimated by the number of
+// blocks.
+TEST_F_EX(PgMiniTest, YB_DISABLE_TEST_IN_TSAN(BlockSamplingAnalyze), PgMiniBlockSamplingTest) {
+  constexpr int kNumRows = 30000;
+
+  auto conn = ASSERT_RESULT(Connect());
+  ASSERT_OK(conn.Execute("CREATE TABLE t (k INT PRIMARY KEY, v TEXT) SPLIT INTO 3 TABLETS"));
+  ASSERT_OK(conn.ExecuteFormat(
+      "INSERT INTO t SELECT i, repeat('v', 100) FROM generate_series(1, $0) i", kNumRows));
+  ASSERT_OK(cluster_->FlushTablets(tablet::FlushMode::kSync));
+
+  // Small statistics target, so tablets are large enough to be sampled by blocks.
+  ASSERT_OK(conn.Execute("SET default_statistics_target = 1"));
+  ASSERT_OK(conn.Execute("ANALYZE t"));
+  auto reltuples = ASSERT_RESULT(conn.FetchValue<int64_t>(
+      "SELECT reltuples::bigint FROM pg_class WHERE relname = 't'"));
+  LOG(INFO) << "Estimated rows: " << reltuples;
+  ASSERT_GE(reltuples, kNumRows * 0.7);
+  ASSERT_LE(reltuples, kNumRows * 1.3);
+  ASSERT_EQ(ASSERT_RESULT(conn.FetchValue<int64_t>(
+      "SELECT COUNT(*) FROM pg_stats WHERE tablename = 't'")), 2);
+}
+
 TEST_F(PgMiniTest, YB_DISABLE_TEST_IN_TSAN(BigInsertWithDropTable)) {
   constexpr int kNumRows = 10000;
   FLAGS_txn_max_apply_batch_records = kNumRows / 10;